@@ -0,0 +1,183 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the batch drain benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure event throughput of an AbstractEventProcessor fed by bursts of C_BURST_SIZE events
+ * when events are popped one at a time or in batches.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstracteventprocessor.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+static const uint32_t C_EVENT_NB = 2000000u; /*!< Number of events pushed for each measure.*/
+static const uint32_t C_BURST_SIZE = 64u; /*!< Number of events pushed back to back before producer pauses.*/
+
+/*! @class CountingProcessor
+* @brief Event processor counting processed events and batches
+*
+*/
+class CountingProcessor : public EventSystem::AbstractEventProcessor
+{
+public:
+    CountingProcessor() : EventSystem::AbstractEventProcessor(), m_processed_nb(0u), m_batch_nb(0u)
+    {
+    }
+
+    uint32_t processedNb() const
+    {
+        return m_processed_nb.load(std::memory_order_acquire);
+    }
+
+    uint32_t batchNb() const
+    {
+        return m_batch_nb;
+    }
+
+protected:
+    virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&&)
+    {
+        m_processed_nb.store(m_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+    }
+
+    virtual void processEvents(std::vector< std::unique_ptr<EventSystem::DwfEvent> >& events)
+    {
+        ++m_batch_nb;
+        EventSystem::AbstractEventProcessor::processEvents(events);
+    }
+
+private:
+    std::atomic<uint32_t> m_processed_nb; /*!< Number of processed events.*/
+    std::atomic<uint32_t> m_batch_nb; /*!< Number of processed batches.*/
+};
+
+/*!
+* @brief Push C_EVENT_NB events by bursts and print throughput
+* @param name : name of the measured mode
+* @param max_batch_size : maximum number of events popped at once
+*
+*/
+void measure(const char* name, size_t max_batch_size)
+{
+    CountingProcessor processor;
+    processor.setMaxBatchSize(max_batch_size);
+    processor.start();
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < C_EVENT_NB; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfEvent(i));
+        processor.pushEvent(std::move(event));
+        if(i % C_BURST_SIZE == C_BURST_SIZE - 1u) // Let consumer catch up between bursts
+        {
+            std::this_thread::yield();
+        }
+    }
+    while(processor.processedNb() < C_EVENT_NB)
+    {
+        std::this_thread::yield();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    processor.stop();
+
+    printf("   %-14s : %8.2f M events/s (%u batches)\n", name, C_EVENT_NB / duration.count() / 1e6, processor.batchNb());
+}
+
+int main(int, char*[])
+{
+    printf("AbstractEventProcessor throughput, %u events pushed by bursts of %u\n", C_EVENT_NB, C_BURST_SIZE);
+    measure("one at a time", 1u);
+    measure("batches of 16", 16u);
+    measure("drain all", 0u);
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,215 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the event pool benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure throughput of events created by producer threads and deleted by an event processor,
+ * with storage recycled by DwfEventPool and with global operator new and delete.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstracteventprocessor.h"
+#include "eventqueue.h"
+#include "dwfmpscqueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <new>
+#include <thread>
+#include <vector>
+
+static const uint32_t C_MAX_PRODUCER_NB = 8u; /*!< Maximum number of producer threads.*/
+static const uint32_t C_EVENT_NB = 1920000u; /*!< Total number of events pushed for each measure. Multiple of every producer number.*/
+
+/*! @class HeapEvent
+* @brief Event allocated with global operator new, as events were before DwfEventPool
+*
+*/
+class HeapEvent : public EventSystem::DwfEvent
+{
+public:
+    HeapEvent(EventSystem::EventID id) : EventSystem::DwfEvent(id)
+    {
+    }
+
+    static void* operator new(std::size_t size)
+    {
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* event, std::size_t)
+    {
+        ::operator delete(event);
+    }
+};
+
+/*! @class CountingProcessor
+* @brief Event processor counting processed events
+*
+*/
+class CountingProcessor : public EventSystem::AbstractEventProcessor
+{
+public:
+    CountingProcessor() : EventSystem::AbstractEventProcessor(std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfMpscQueue< std::unique_ptr<EventSystem::DwfEvent> > >())), m_processed_nb(0u)
+    {
+    }
+
+    uint32_t processedNb() const
+    {
+        return m_processed_nb.load(std::memory_order_acquire);
+    }
+
+protected:
+    virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&&)
+    {
+        m_processed_nb.store(m_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> m_processed_nb; /*!< Number of processed events.*/
+};
+
+/*!
+* @brief Create C_EVENT_NB events from several threads and push them to an event processor deleting them
+* @tparam Event : type of created events
+* @param producer_nb : number of producer threads
+* @return Number of events processed per second
+*
+*/
+template<class Event>
+double measure(uint32_t producer_nb)
+{
+    CountingProcessor processor;
+    processor.start();
+
+    std::atomic<bool> go(false);
+    std::vector<std::thread> producers;
+    for(uint32_t producer = 0u; producer < producer_nb; ++producer)
+    {
+        producers.emplace_back([&processor, &go, producer_nb]()
+        {
+            while(!go)
+            {
+                std::this_thread::yield();
+            }
+            for(uint32_t i = 0u; i < C_EVENT_NB / producer_nb; ++i)
+            {
+                processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new Event(i)));
+            }
+        });
+    }
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    go = true;
+    for(std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    while(processor.processedNb() < C_EVENT_NB)
+    {
+        std::this_thread::yield();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    processor.stop();
+
+    return C_EVENT_NB / duration.count();
+}
+
+int main(int, char*[])
+{
+    printf("Events created by producers and deleted by event processor, %u events, %u hardware threads\n", C_EVENT_NB, std::thread::hardware_concurrency());
+    printf("   %9s : %18s %18s\n", "producers", "operator new", "DwfEventPool");
+    for(uint32_t producer_nb = 1u; producer_nb <= C_MAX_PRODUCER_NB; producer_nb *= 2u)
+    {
+        const double heap = measure<HeapEvent>(producer_nb);
+        const double pooled = measure<EventSystem::DwfEvent>(producer_nb);
+        printf("   %9u : %10.2f M ev/s %10.2f M ev/s\n", producer_nb, heap / 1e6, pooled / 1e6);
+    }
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
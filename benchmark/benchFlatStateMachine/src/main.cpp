@@ -0,0 +1,246 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the flat state machine benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure event dispatch duration of AbstractStateMachine and FlatStateMachine
+ * for a machine with C_STATE_NB states and C_EVENT_ID_NB event IDs.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstractstatemachine.h"
+#include "flatstatemachine.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static const DwfStateMachine::StateID C_STATE_NB = 200u; /*!< Number of states of the benchmarked machines.*/
+static const EventSystem::EventID C_EVENT_ID_NB = 500u; /*!< Number of event IDs of the benchmarked machines.*/
+static const EventSystem::EventID C_TRANSITION_STEP = 4u; /*!< One event ID out of C_TRANSITION_STEP triggers a transition in each state.*/
+static const uint32_t C_EVENT_NB = 2000000u; /*!< Number of events dispatched for each measure.*/
+
+/*!
+* @brief Fill a transition map of the benchmarked topology
+* @param transition_map : map to fill
+* @param current_state : current state of the machine, updated by transitions
+* @param transition_nb : counter of performed transitions
+*
+* In every state, event IDs multiple of C_TRANSITION_STEP lead to state (state + event ID) % C_STATE_NB. Other events are ignored.
+*
+*/
+void fillTransitionMap(DwfStateMachine::AbstractStateMachine::TransitionMap& transition_map, DwfStateMachine::DwfState& current_state, uint64_t& transition_nb)
+{
+    for(DwfStateMachine::StateID state = 0u; state < C_STATE_NB; ++state)
+    {
+        DwfStateMachine::AbstractStateMachine::EventTransitionMap transitions;
+        for(EventSystem::EventID event = 0u; event < C_EVENT_ID_NB; event += C_TRANSITION_STEP)
+        {
+            DwfStateMachine::DwfState next_state((state + event) % C_STATE_NB);
+            transitions.insert({EventSystem::DwfEvent(event), [&current_state, &transition_nb, next_state](std::unique_ptr<EventSystem::DwfEvent>&&){++transition_nb; current_state = next_state;}});
+        }
+        transition_map.insert({DwfStateMachine::DwfState(state), transitions});
+    }
+}
+
+/*! @class BenchStateMachine
+* @brief Benchmarked hash map based state machine
+*
+* Events are dispatched directly from the calling thread, event processing thread is never started.
+*
+*/
+class BenchStateMachine : public DwfStateMachine::AbstractStateMachine
+{
+public:
+    BenchStateMachine() : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(0u)), m_transition_nb(0u)
+    {
+        setupTransitionMap();
+    }
+
+    void dispatch(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        processEvent(std::move(event));
+    }
+
+    uint64_t transitionNb() const
+    {
+        return m_transition_nb;
+    }
+
+protected:
+    virtual void setupTransitionMap()
+    {
+        fillTransitionMap(m_transition_map, m_current_state, m_transition_nb);
+    }
+
+    virtual void onDeadEndState(const std::exception&)
+    {
+    }
+
+private:
+    uint64_t m_transition_nb; /*!< Number of transitions performed.*/
+};
+
+/*! @class BenchFlatStateMachine
+* @brief Benchmarked flat table based state machine
+*
+* Events are dispatched directly from the calling thread, event processing thread is never started.
+*
+*/
+class BenchFlatStateMachine : public DwfStateMachine::FlatStateMachine
+{
+public:
+    BenchFlatStateMachine() : DwfStateMachine::FlatStateMachine(DwfStateMachine::DwfState(0u)), m_transition_nb(0u)
+    {
+    }
+
+    void dispatch(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        processEvent(std::move(event));
+    }
+
+    uint64_t transitionNb() const
+    {
+        return m_transition_nb;
+    }
+
+protected:
+    virtual void setupTransitionMap()
+    {
+        fillTransitionMap(m_transition_map, m_current_state, m_transition_nb);
+    }
+
+    virtual void onDeadEndState(DwfStateMachine::DeadEndReason)
+    {
+    }
+
+private:
+    uint64_t m_transition_nb; /*!< Number of transitions performed.*/
+};
+
+/*!
+* @brief Dispatch C_EVENT_NB events and print duration per event
+* @param name : name of the measured machine
+* @param events : events to dispatch in a round robin way
+* @param machine : machine to measure
+*
+*/
+template<class Machine>
+void measure(const char* name, std::vector< std::unique_ptr<EventSystem::DwfEvent> >& events, Machine& machine)
+{
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < C_EVENT_NB; ++i)
+    {
+        machine.dispatch(std::move(events[i % events.size()])); // Transitions do not take ownership so events remain available
+    }
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start_time;
+
+    printf("   %-22s : %8.1f ns/event (%lu transitions)\n", name, static_cast<double>(duration.count()) / C_EVENT_NB, static_cast<unsigned long>(machine.transitionNb()));
+}
+
+int main(int, char*[])
+{
+    std::mt19937 generator(42u);
+    std::uniform_int_distribution<EventSystem::EventID> distribution(0u, C_EVENT_ID_NB - 1u);
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > events;
+    for(uint32_t i = 0u; i < 4096u; ++i)
+    {
+        events.emplace_back(new EventSystem::DwfEvent(distribution(generator)));
+    }
+
+    BenchStateMachine machine;
+    BenchFlatStateMachine flat_machine;
+    flat_machine.setupAndStart(); // Compiles transition table
+    flat_machine.stop();
+
+    printf("Dispatch of %u random events on machines with %u states and %u event IDs\n", C_EVENT_NB, C_STATE_NB, C_EVENT_ID_NB);
+    measure("AbstractStateMachine", events, machine);
+    measure("FlatStateMachine", events, flat_machine);
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,235 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the ignored events benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure throughput of AbstractStateMachine when processing events that trigger no transition. <br>
+ * Compares current exception free lookup with the former lookup signaling missing transitions with std::out_of_range.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstractstatemachine.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+static const EventSystem::EventID C_EVENT_ID_NB = 16u; /*!< Number of different event IDs dispatched.*/
+static const uint32_t C_EVENT_NB = 1000000u; /*!< Number of events dispatched for each measure.*/
+
+/*! @class BenchStateMachine
+* @brief State machine ignoring all events
+*
+* State LISTENING(0) has a single transition, never triggered by dispatched events.
+* State DEAD_END(1) has no transition.
+* Events are dispatched directly from the calling thread, event processing thread is never started.
+*
+*/
+class BenchStateMachine : public DwfStateMachine::AbstractStateMachine
+{
+public:
+    enum StatesId
+    {
+        LISTENING=0,
+        DEAD_END=1
+    };
+
+    BenchStateMachine() : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(LISTENING)), m_dead_end_nb(0u)
+    {
+        setupTransitionMap();
+    }
+
+    void setState(StatesId state)
+    {
+        m_current_state = DwfStateMachine::DwfState(state);
+    }
+
+    /*!
+    * @brief Dispatch an event using AbstractStateMachine::processEvent
+    * @param event : event to dispatch
+    *
+    */
+    void dispatch(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        processEvent(std::move(event));
+    }
+
+    /*!
+    * @brief Dispatch an event relying on std::out_of_range to detect missing transitions as done before exception free lookup
+    * @param event : event to dispatch
+    *
+    */
+    void throwingDispatch(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        const EventTransitionMap* ev_tr_map = nullptr;
+        const TransitionFunction* tr_function = nullptr;
+        try
+        {
+            ev_tr_map=&m_transition_map.at(m_current_state);
+        }
+        catch (const std::exception& e)
+        {
+            onDeadEndState(e);
+        }
+        if(ev_tr_map)
+        {
+            try
+            {
+                tr_function=&ev_tr_map->at(*event);
+            }
+            catch (const std::exception&)
+            {
+            }
+            if(tr_function && *tr_function)
+            {
+                (*tr_function)(std::move(event));
+            }
+        }
+    }
+
+    uint64_t deadEndNb() const
+    {
+        return m_dead_end_nb;
+    }
+
+protected:
+    virtual void setupTransitionMap()
+    {
+        EventTransitionMap transitions({{EventSystem::DwfEvent(C_EVENT_ID_NB), [this](std::unique_ptr<EventSystem::DwfEvent>&&){m_current_state = DwfStateMachine::DwfState(DEAD_END);}}});
+        m_transition_map.insert({DwfStateMachine::DwfState(LISTENING), transitions});
+    }
+
+    virtual void onDeadEndState(const std::exception&)
+    {
+        ++m_dead_end_nb;
+    }
+
+private:
+    uint64_t m_dead_end_nb; /*!< Number of events received in dead end state.*/
+};
+
+/*!
+* @brief Dispatch C_EVENT_NB events and print throughput
+* @param name : name of the measured dispatch
+* @param events : events to dispatch in a round robin way
+* @param dispatch : dispatch function to measure
+*
+*/
+template<class Dispatch>
+void measure(const char* name, std::vector< std::unique_ptr<EventSystem::DwfEvent> >& events, Dispatch dispatch)
+{
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < C_EVENT_NB; ++i)
+    {
+        dispatch(std::move(events[i % events.size()])); // No transition is triggered so events remain available
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+
+    printf("   %-28s : %12.0f events/s\n", name, C_EVENT_NB / duration.count());
+}
+
+int main(int, char*[])
+{
+    BenchStateMachine machine;
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > events;
+    for(EventSystem::EventID event = 0u; event < C_EVENT_ID_NB; ++event)
+    {
+        events.emplace_back(new EventSystem::DwfEvent(event));
+    }
+
+    printf("Dispatch of %u events triggering no transition\n", C_EVENT_NB);
+    machine.setState(BenchStateMachine::LISTENING);
+    measure("ignored event, throwing", events, [&machine](std::unique_ptr<EventSystem::DwfEvent>&& event){machine.throwingDispatch(std::move(event));});
+    measure("ignored event, no throw", events, [&machine](std::unique_ptr<EventSystem::DwfEvent>&& event){machine.dispatch(std::move(event));});
+
+    machine.setState(BenchStateMachine::DEAD_END);
+    measure("dead end state, throwing", events, [&machine](std::unique_ptr<EventSystem::DwfEvent>&& event){machine.throwingDispatch(std::move(event));});
+    measure("dead end state, no throw", events, [&machine](std::unique_ptr<EventSystem::DwfEvent>&& event){machine.dispatch(std::move(event));});
+    printf("   Dead end state handler calls : %lu\n", static_cast<unsigned long>(machine.deadEndNb()));
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
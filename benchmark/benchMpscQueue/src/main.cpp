@@ -0,0 +1,193 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the multiple producers single consumer queue benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure event throughput of an AbstractEventProcessor backed by DwfQueue or DwfMpscQueue
+ * when 1 to C_MAX_PRODUCER_NB threads push events concurrently.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstracteventprocessor.h"
+#include "eventqueue.h"
+#include "dwfqueue.h"
+#include "dwfmpscqueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static const uint32_t C_MAX_PRODUCER_NB = 32u; /*!< Maximum number of producer threads.*/
+static const uint32_t C_EVENT_NB = 1920000u; /*!< Total number of events pushed for each measure. Multiple of every producer number.*/
+
+/*! @class CountingProcessor
+* @brief Event processor counting processed events
+*
+*/
+class CountingProcessor : public EventSystem::AbstractEventProcessor
+{
+public:
+    CountingProcessor(std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : EventSystem::AbstractEventProcessor(std::move(event_queue)), m_processed_nb(0u)
+    {
+    }
+
+    uint32_t processedNb() const
+    {
+        return m_processed_nb.load(std::memory_order_acquire);
+    }
+
+protected:
+    virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&&)
+    {
+        m_processed_nb.store(m_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> m_processed_nb; /*!< Number of processed events.*/
+};
+
+/*!
+* @brief Push C_EVENT_NB events from several threads to an event processor
+* @param producer_nb : number of producer threads
+* @param event_queue : queue used by the event processor
+* @return Number of events processed per second
+*
+*/
+double measure(uint32_t producer_nb, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue)
+{
+    CountingProcessor processor(std::move(event_queue));
+    processor.start();
+
+    std::atomic<bool> go(false);
+    std::vector<std::thread> producers;
+    for(uint32_t producer = 0u; producer < producer_nb; ++producer)
+    {
+        producers.emplace_back([&processor, &go, producer_nb]()
+        {
+            while(!go)
+            {
+                std::this_thread::yield();
+            }
+            for(uint32_t i = 0u; i < C_EVENT_NB / producer_nb; ++i)
+            {
+                std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfEvent(i));
+                processor.pushEvent(std::move(event));
+            }
+        });
+    }
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    go = true;
+    for(std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    while(processor.processedNb() < C_EVENT_NB)
+    {
+        std::this_thread::yield();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    processor.stop();
+
+    return C_EVENT_NB / duration.count();
+}
+
+int main(int, char*[])
+{
+    printf("AbstractEventProcessor throughput, %u events, %u hardware threads\n", C_EVENT_NB, std::thread::hardware_concurrency());
+    printf("   %9s : %18s %18s\n", "producers", "DwfQueue", "DwfMpscQueue");
+    for(uint32_t producer_nb = 1u; producer_nb <= C_MAX_PRODUCER_NB; producer_nb *= 2u)
+    {
+        const double locked = measure(producer_nb, std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> > >()));
+        const double lock_free = measure(producer_nb, std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfMpscQueue< std::unique_ptr<EventSystem::DwfEvent> > >()));
+        printf("   %9u : %10.2f M ev/s %10.2f M ev/s\n", producer_nb, locked / 1e6, lock_free / 1e6);
+    }
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
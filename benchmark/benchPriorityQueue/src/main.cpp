@@ -0,0 +1,237 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the priority event queue benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure push to processing latency of urgent events while a producer keeps
+ * C_BACKLOG routine events queued, with a FIFO DwfQueue and a PriorityEventQueue.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstracteventprocessor.h"
+#include "eventqueue.h"
+#include "dwfqueue.h"
+#include "priorityeventqueue.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static const uint32_t C_BACKLOG = 10000u; /*!< Number of routine events the routine producer keeps queued.*/
+static const uint32_t C_URGENT_NB = 200u; /*!< Number of urgent events pushed for each measure.*/
+static const EventSystem::EventID C_URGENT_ID = 1000000u; /*!< Id of first urgent event. Urgent event i has id C_URGENT_ID + i.*/
+static const std::chrono::microseconds C_URGENT_PERIOD(1000); /*!< Duration between two urgent events.*/
+static const std::chrono::nanoseconds C_PROCESS_DURATION(2000); /*!< Duration of the processing of every event.*/
+
+/*! @class LatencyProcessor
+* @brief Event processor simulating computations and measuring latency of urgent events
+*
+*/
+class LatencyProcessor : public EventSystem::AbstractEventProcessor
+{
+public:
+    LatencyProcessor(std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : EventSystem::AbstractEventProcessor(std::move(event_queue)),
+        m_processed_nb(0u), m_urgent_processed_nb(0u), m_push_times(C_URGENT_NB), m_latencies()
+    {
+    }
+
+    uint32_t processedNb() const
+    {
+        return m_processed_nb.load(std::memory_order_acquire);
+    }
+
+    uint32_t urgentProcessedNb() const
+    {
+        return m_urgent_processed_nb.load(std::memory_order_acquire);
+    }
+
+    void markPushed(uint32_t urgent_index)
+    {
+        m_push_times[urgent_index] = std::chrono::steady_clock::now();
+    }
+
+    std::vector<std::chrono::nanoseconds> latencies() const
+    {
+        return m_latencies;
+    }
+
+protected:
+    virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        if(event->getId() >= C_URGENT_ID)
+        {
+            m_latencies.push_back(start_time - m_push_times[event->getId() - C_URGENT_ID]);
+            m_urgent_processed_nb.store(m_urgent_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+        }
+        else
+        {
+            while(std::chrono::steady_clock::now() - start_time < C_PROCESS_DURATION) {} // Simulate computations
+            m_processed_nb.store(m_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+        }
+    }
+
+private:
+    std::atomic<uint32_t> m_processed_nb; /*!< Number of processed routine events.*/
+
+    std::atomic<uint32_t> m_urgent_processed_nb; /*!< Number of processed urgent events.*/
+
+    std::vector<std::chrono::steady_clock::time_point> m_push_times; /*!< Push time of each urgent event. Published to processing thread by event queue.*/
+
+    std::vector<std::chrono::nanoseconds> m_latencies; /*!< Latency of each processed urgent event.*/
+};
+
+/*!
+* @brief Push urgent events while queue is saturated by routine events and print their latency
+* @param name : name of the measured queue
+* @param event_queue : queue used by the event processor
+* @param urgent_priority : priority used to push urgent events
+*
+*/
+void measure(const char* name, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue, DwfContainers::Priority urgent_priority)
+{
+    LatencyProcessor processor(std::move(event_queue));
+    processor.start();
+
+    std::atomic<bool> done(false);
+    std::thread routine_producer([&processor, &done]()
+    {
+        uint32_t pushed_nb = 0u;
+        while(!done)
+        {
+            if(pushed_nb - processor.processedNb() < C_BACKLOG)
+            {
+                processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(pushed_nb % C_URGENT_ID)));
+                ++pushed_nb;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    while(processor.processedNb() < C_BACKLOG) // Let backlog build up
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for(uint32_t i = 0u; i < C_URGENT_NB; ++i)
+    {
+        processor.markPushed(i);
+        processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(C_URGENT_ID + i)), urgent_priority);
+        std::this_thread::sleep_for(C_URGENT_PERIOD);
+    }
+    while(processor.urgentProcessedNb() < C_URGENT_NB)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    done = true;
+    routine_producer.join();
+    processor.stop();
+
+    std::vector<std::chrono::nanoseconds> latencies = processor.latencies();
+    std::sort(latencies.begin(), latencies.end());
+    std::chrono::nanoseconds sum(0);
+    for(const std::chrono::nanoseconds& latency : latencies)
+    {
+        sum += latency;
+    }
+    printf("   %-18s : mean %10.1f us   p99 %10.1f us   max %10.1f us\n", name, sum.count() / 1e3 / latencies.size(),
+           latencies[latencies.size() * 99u / 100u].count() / 1e3, latencies.back().count() / 1e3);
+}
+
+int main(int, char*[])
+{
+    printf("Latency of %u urgent events with %u queued routine events of %ld ns each\n", C_URGENT_NB, C_BACKLOG, static_cast<long>(C_PROCESS_DURATION.count()));
+    measure("DwfQueue", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> > >()), 1u);
+    measure("PriorityEventQueue", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::PriorityEventQueue(2u)), 1u);
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,187 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the batch push benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure duration of pushing frames of C_FRAME_SIZE events to an AbstractEventProcessor
+ * with one pushEvent call per event or a single pushEvents call per frame.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstracteventprocessor.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static const uint32_t C_FRAME_NB = 50000u; /*!< Number of frames pushed for each measure.*/
+static const uint32_t C_FRAME_SIZE = 40u; /*!< Number of events in a frame.*/
+
+/*! @class CountingProcessor
+* @brief Event processor counting processed events
+*
+*/
+class CountingProcessor : public EventSystem::AbstractEventProcessor
+{
+public:
+    CountingProcessor() : EventSystem::AbstractEventProcessor(), m_processed_nb(0u)
+    {
+    }
+
+    uint32_t processedNb() const
+    {
+        return m_processed_nb.load(std::memory_order_acquire);
+    }
+
+protected:
+    virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&&)
+    {
+        m_processed_nb.store(m_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> m_processed_nb; /*!< Number of processed events.*/
+};
+
+/*!
+* @brief Push C_FRAME_NB frames and print push duration and throughput
+* @param name : name of the measured push method
+* @param batch : true to push each frame with pushEvents, false to push events one by one
+*
+*/
+void measure(const char* name, bool batch)
+{
+    CountingProcessor processor;
+    processor.setMaxBatchSize(0u);
+    processor.start();
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > frame;
+    frame.reserve(C_FRAME_SIZE);
+
+    std::chrono::nanoseconds push_duration(0);
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < C_FRAME_NB; ++i)
+    {
+        for(uint32_t j = 0u; j < C_FRAME_SIZE; ++j) // Parse frame
+        {
+            frame.emplace_back(new EventSystem::DwfEvent(j));
+        }
+
+        std::chrono::steady_clock::time_point push_time = std::chrono::steady_clock::now();
+        if(batch)
+        {
+            processor.pushEvents(frame);
+        }
+        else
+        {
+            for(std::unique_ptr<EventSystem::DwfEvent>& event : frame)
+            {
+                processor.pushEvent(std::move(event));
+            }
+            frame.clear();
+        }
+        push_duration += std::chrono::steady_clock::now() - push_time;
+    }
+    while(processor.processedNb() < C_FRAME_NB * C_FRAME_SIZE)
+    {
+        std::this_thread::yield();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    processor.stop();
+
+    printf("   %-10s : %8.1f ns/frame push, %6.2f M events/s end to end\n", name, static_cast<double>(push_duration.count()) / C_FRAME_NB, C_FRAME_NB * C_FRAME_SIZE / duration.count() / 1e6);
+}
+
+int main(int, char*[])
+{
+    printf("Push of %u frames of %u events\n", C_FRAME_NB, C_FRAME_SIZE);
+    measure("pushEvent", false);
+    measure("pushEvents", true);
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
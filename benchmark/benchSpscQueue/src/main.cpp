@@ -0,0 +1,229 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the single producer single consumer queue benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure throughput of DwfQueue and DwfSpscQueue with one producer thread and one consumer thread,
+ * both on raw queues and behind an AbstractEventProcessor.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstracteventprocessor.h"
+#include "eventqueue.h"
+#include "dwfqueue.h"
+#include "dwfspscqueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+static const size_t C_QUEUE_SIZE = 1024u; /*!< Size limit of benchmarked queues.*/
+static const uint32_t C_ELEMENT_NB = 5000000u; /*!< Number of elements transferred for each raw queue measure.*/
+static const uint32_t C_EVENT_NB = 1000000u; /*!< Number of events transferred for each event processor measure.*/
+
+/*!
+* @brief Transfer C_ELEMENT_NB integers from a producer thread to a consumer thread and print throughput
+* @param name : name of the measured queue
+* @param queue : queue to measure
+*
+* Producer yields while queue is full.
+*
+*/
+template<class Queue>
+void measureQueue(const char* name, Queue& queue)
+{
+    uint64_t checksum = 0u;
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    std::thread consumer([&queue, &checksum]()
+    {
+        for(uint32_t i = 0u; i < C_ELEMENT_NB; ++i)
+        {
+            uint32_t element = 0u;
+            queue.pop(element);
+            checksum += element;
+        }
+    });
+
+    for(uint32_t i = 0u; i < C_ELEMENT_NB; ++i)
+    {
+        while(queue.full())
+        {
+            std::this_thread::yield();
+        }
+        queue.push(i);
+    }
+    consumer.join();
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+
+    printf("   %-12s : %8.2f M elements/s (checksum %llu)\n", name, C_ELEMENT_NB / duration.count() / 1e6, static_cast<unsigned long long>(checksum));
+}
+
+/*! @class CountingProcessor
+* @brief Event processor counting processed events
+*
+*/
+class CountingProcessor : public EventSystem::AbstractEventProcessor
+{
+public:
+    CountingProcessor(std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : EventSystem::AbstractEventProcessor(std::move(event_queue)), m_processed_nb(0u)
+    {
+    }
+
+    uint32_t processedNb() const
+    {
+        return m_processed_nb.load(std::memory_order_acquire);
+    }
+
+protected:
+    virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&&)
+    {
+        m_processed_nb.store(m_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> m_processed_nb; /*!< Number of processed events.*/
+};
+
+/*!
+* @brief Push C_EVENT_NB events to an event processor and print throughput
+* @param name : name of the measured queue
+* @param event_queue : queue used by the event processor
+*
+* Producer yields and retries while queue is full.
+*
+*/
+void measureProcessor(const char* name, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue)
+{
+    CountingProcessor processor(std::move(event_queue));
+    processor.start();
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < C_EVENT_NB; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfEvent(i));
+        while(true)
+        {
+            try
+            {
+                processor.pushEvent(std::move(event));
+                break;
+            }
+            catch(const std::runtime_error&) // Queue is full, event was not moved
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+    while(processor.processedNb() < C_EVENT_NB)
+    {
+        std::this_thread::yield();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    processor.stop();
+
+    printf("   %-12s : %8.2f M events/s\n", name, C_EVENT_NB / duration.count() / 1e6);
+}
+
+int main(int, char*[])
+{
+    printf("Raw queue throughput, %u integers, queue size %u\n", C_ELEMENT_NB, static_cast<unsigned>(C_QUEUE_SIZE));
+    {
+        DwfContainers::DwfQueue<uint32_t> queue(C_QUEUE_SIZE);
+        measureQueue("DwfQueue", queue);
+    }
+    {
+        DwfContainers::DwfSpscQueue<uint32_t> queue(C_QUEUE_SIZE);
+        measureQueue("DwfSpscQueue", queue);
+    }
+
+    printf("AbstractEventProcessor throughput, %u events, queue size %u\n", C_EVENT_NB, static_cast<unsigned>(C_QUEUE_SIZE));
+    measureProcessor("DwfQueue", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> > >(C_QUEUE_SIZE)));
+    measureProcessor("DwfSpscQueue", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfSpscQueue< std::unique_ptr<EventSystem::DwfEvent> > >(C_QUEUE_SIZE)));
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,325 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the state function thread benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure event throughput and periodic call rate of a periodic state machine sharing data between its transitions and its state function,
+ * either calling state functions from timer threads and protecting data with a mutex, or calling them from event processing thread without any lock.
+ * Events are either pushed all at once to measure throughput, or at a steady rate to measure periodic call rate and transition duration, lock wait included.
+ * Also counts torn reads when timer threads access data without lock, to show the race StateFunctionThread::EVENT_THREAD removes.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "abstractperiodicstatemachine.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+static const std::chrono::microseconds C_PERIOD(100); /*!< Period of state functions.*/
+static const uint32_t C_EVENT_NB = 200000u; /*!< Number of events pushed at once for each throughput measure.*/
+static const std::chrono::microseconds C_EVENT_INTERVAL(50); /*!< Interval between events pushed for each paced measure.*/
+static const std::chrono::seconds C_PACED_DURATION(2); /*!< Duration of each paced measure.*/
+static const size_t C_SHARED_SIZE = 64u; /*!< Number of values shared between transitions and state function.*/
+
+/*! @enum Locking
+* @brief Protection of data shared between transitions and state function
+*/
+enum class Locking : uint8_t
+{
+    NONE, /*!< Shared data is accessed without lock.*/
+    MUTEX /*!< Shared data is protected by a std::mutex.*/
+};
+
+/*! @class BenchStateMachine
+* @brief Periodic state machine with a single state, whose transition writes all shared values and whose state function reads them
+*
+*/
+class BenchStateMachine : public DwfStateMachine::AbstractPeriodicStateMachine
+{
+public:
+    BenchStateMachine(DwfStateMachine::StateFunctionThread state_function_thread, Locking locking) : DwfStateMachine::AbstractPeriodicStateMachine(DwfStateMachine::DwfState(0), C_PERIOD),
+        m_locking(locking), m_mutex(), m_shared(), m_transition_nb(0u), m_periodic_nb(0u), m_torn_read_nb(0u), m_transition_duration(0), m_max_transition_duration(0)
+    {
+        for(std::atomic<uint64_t>& value : m_shared)
+        {
+            value = 0u;
+        }
+        setStateFunctionThread(state_function_thread);
+    }
+
+    void startStateFunctions()
+    {
+        startTimer();
+    }
+
+    void stopStateFunctions()
+    {
+        stopTimer();
+    }
+
+    uint64_t transitionNb() const
+    {
+        return m_transition_nb;
+    }
+
+    uint64_t periodicNb() const
+    {
+        return m_periodic_nb;
+    }
+
+    uint64_t tornReadNb() const
+    {
+        return m_torn_read_nb;
+    }
+
+    std::chrono::nanoseconds transitionDuration() const
+    {
+        return m_transition_duration;
+    }
+
+    std::chrono::nanoseconds maxTransitionDuration() const
+    {
+        return m_max_transition_duration;
+    }
+
+protected:
+    virtual void setupTransitionMap()
+    {
+        m_transition_map.insert({DwfStateMachine::DwfState(0), EventTransitionMap({{EventSystem::DwfEvent(1), [this](std::unique_ptr<EventSystem::DwfEvent>&&){transition();}}})});
+    }
+
+    virtual void setupStateFunctionMap()
+    {
+        m_periodic_function_maps.insert({DwfStateMachine::DwfState(0), [this](){periodic();}});
+    }
+
+    virtual void onDeadEndState(const std::exception&)
+    {
+    }
+
+private:
+    void transition()
+    {
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        if(m_locking == Locking::MUTEX)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            write();
+        }
+        else
+        {
+            write();
+        }
+        const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start_time;
+        m_transition_duration += duration;
+        m_max_transition_duration = std::max(m_max_transition_duration, duration);
+        m_transition_nb.fetch_add(1u, std::memory_order_release); // Publishes durations to measuring thread
+    }
+
+    void periodic()
+    {
+        if(m_locking == Locking::MUTEX)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            read();
+        }
+        else
+        {
+            read();
+        }
+        ++m_periodic_nb;
+    }
+
+    void write()
+    {
+        for(std::atomic<uint64_t>& value : m_shared) // Atomic values, so that racy configuration stays defined behavior
+        {
+            value.fetch_add(1u, std::memory_order_relaxed);
+        }
+    }
+
+    void read()
+    {
+        const uint64_t first = m_shared.front().load(std::memory_order_relaxed);
+        for(const std::atomic<uint64_t>& value : m_shared)
+        {
+            if(value.load(std::memory_order_relaxed) != first) // Values differ while a transition is half done
+            {
+                ++m_torn_read_nb;
+                return;
+            }
+        }
+    }
+
+    const Locking m_locking; /*!< Protection of shared data.*/
+    std::mutex m_mutex; /*!< Mutex protecting shared data in Locking::MUTEX configuration.*/
+    std::array<std::atomic<uint64_t>, C_SHARED_SIZE> m_shared; /*!< Values written by transitions and read by state function.*/
+    std::atomic<uint64_t> m_transition_nb; /*!< Number of processed transitions.*/
+    std::atomic<uint64_t> m_periodic_nb; /*!< Number of state function calls.*/
+    std::atomic<uint64_t> m_torn_read_nb; /*!< Number of state function calls reading shared values in the middle of a transition.*/
+    std::chrono::nanoseconds m_transition_duration; /*!< Cumulated duration of transitions. Only written by event processing thread.*/
+    std::chrono::nanoseconds m_max_transition_duration; /*!< Maximum duration of a transition. Only written by event processing thread.*/
+};
+
+/*!
+* @brief Push events to a running periodic state machine and print throughput or transition duration, periodic call rate and torn reads
+* @param name : name of the configuration
+* @param state_function_thread : thread calling state functions
+* @param locking : protection of shared data
+* @param paced : true to push an event every C_EVENT_INTERVAL during C_PACED_DURATION, false to push C_EVENT_NB events at once
+*
+*/
+static void measure(const char* name, DwfStateMachine::StateFunctionThread state_function_thread, Locking locking, bool paced)
+{
+    BenchStateMachine st_mach(state_function_thread, locking);
+    st_mach.setupAndStart();
+    st_mach.startStateFunctions();
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    uint32_t event_nb = 0u;
+    if(paced)
+    {
+        for(std::chrono::steady_clock::time_point push_time = start_time; push_time < start_time + C_PACED_DURATION; push_time += C_EVENT_INTERVAL)
+        {
+            while(std::chrono::steady_clock::now() < push_time) // Yield rather than sleep, as sleeps are coarser than interval
+            {
+                std::this_thread::yield();
+            }
+            st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(1)));
+            ++event_nb;
+        }
+    }
+    else
+    {
+        for(; event_nb < C_EVENT_NB; ++event_nb)
+        {
+            st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(1)));
+        }
+    }
+    while(st_mach.transitionNb() < event_nb) // Wait for all events to be processed
+    {
+        std::this_thread::yield();
+    }
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    st_mach.stopStateFunctions();
+    const double periods = 100.0 * st_mach.periodicNb() * std::chrono::duration<double>(C_PERIOD).count() / duration.count();
+    if(paced)
+    {
+        printf("   %-28s : transition mean %7.3f us max %8.3f us, %6llu state function calls (%5.1f %% of periods), %6llu torn reads\n", name,
+               st_mach.transitionDuration().count() / 1e3 / event_nb, st_mach.maxTransitionDuration().count() / 1e3,
+               static_cast<unsigned long long>(st_mach.periodicNb()), periods, static_cast<unsigned long long>(st_mach.tornReadNb()));
+    }
+    else
+    {
+        printf("   %-28s : %8.0f events/s, %6llu state function calls (%5.1f %% of periods), %6llu torn reads\n", name, event_nb / duration.count(),
+               static_cast<unsigned long long>(st_mach.periodicNb()), periods, static_cast<unsigned long long>(st_mach.tornReadNb()));
+    }
+}
+
+int main(int, char*[])
+{
+    setvbuf(stdout, nullptr, _IOLBF, 0); // Print each measure as soon as it is available
+    printf("State machine with %lld us periodic state function, %u hardware threads\n", static_cast<long long>(C_PERIOD.count()), std::thread::hardware_concurrency());
+    for(bool paced : {false, true})
+    {
+        if(paced)
+        {
+            printf("One event every %lld us during %lld s\n", static_cast<long long>(C_EVENT_INTERVAL.count()), static_cast<long long>(C_PACED_DURATION.count()));
+        }
+        else
+        {
+            printf("%u events pushed at once. Ticks queued behind them wait for the whole backlog on event thread\n", C_EVENT_NB);
+        }
+        measure("timer thread, no lock (racy)", DwfStateMachine::StateFunctionThread::TIMER_THREAD, Locking::NONE, paced);
+        measure("timer thread, mutex", DwfStateMachine::StateFunctionThread::TIMER_THREAD, Locking::MUTEX, paced);
+        measure("event thread, no lock", DwfStateMachine::StateFunctionThread::EVENT_THREAD, Locking::NONE, paced);
+    }
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,242 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the timer backend benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure lateness histograms against absolute deadlines of a 1 kHz and a 10 kHz periodic timer, idle and with every hardware thread busy,
+ * with the condition variable backend and the timerfd backend of DwfTimerService.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwftimer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static const std::chrono::milliseconds C_RUN_DURATION(2000); /*!< Duration of each measure.*/
+static const int64_t C_BUCKET_LIMITS_US[] = {5, 10, 20, 50, 100, 200, 500, 1000}; /*!< Upper limits of histogram buckets in microseconds. Last bucket gathers greater lateness.*/
+static const size_t C_BUCKET_NB = sizeof(C_BUCKET_LIMITS_US) / sizeof(C_BUCKET_LIMITS_US[0]) + 1u; /*!< Number of histogram buckets.*/
+
+/*! @class LatenessProbe
+* @brief Timeout function recording lateness of each call against timer start plus a whole number of periods
+*
+*/
+class LatenessProbe
+{
+public:
+    LatenessProbe(std::chrono::microseconds period, size_t tick_nb) : m_period(period), m_tick_nb(tick_nb), m_start_time(), m_lateness_us()
+    {
+        m_lateness_us.reserve(tick_nb);
+    }
+
+    void setStartTime(std::chrono::steady_clock::time_point start_time)
+    {
+        m_start_time = start_time;
+    }
+
+    void onTimeout()
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if(m_lateness_us.size() < m_tick_nb)
+        {
+            const std::chrono::steady_clock::time_point deadline = m_start_time + static_cast<int64_t>(m_lateness_us.size() + 1u) * m_period;
+            m_lateness_us.push_back(std::chrono::duration_cast<std::chrono::microseconds>(now - deadline).count());
+        }
+    }
+
+    std::vector<int64_t>& latenessUs()
+    {
+        return m_lateness_us;
+    }
+
+private:
+    const std::chrono::microseconds m_period; /*!< Period of timer.*/
+    const size_t m_tick_nb; /*!< Number of calls to record.*/
+    std::chrono::steady_clock::time_point m_start_time; /*!< Time timer was started. Timer start computes its first deadline a few hundred nanoseconds later.*/
+    std::vector<int64_t> m_lateness_us; /*!< Lateness of each call in microseconds.*/
+};
+
+/*!
+* @brief Run a periodic timer and print its lateness histogram
+* @param name : name of the backend
+* @param backend : backend of the timer
+* @param period : period of the timer
+*
+*/
+static void measureBackend(const char* name, DwfTime::TimerBackend backend, std::chrono::microseconds period)
+{
+    LatenessProbe probe(period, static_cast<size_t>(C_RUN_DURATION / period));
+    {
+        DwfTime::DwfTimer timer(backend);
+        timer.setSingleShot(false);
+        timer.setPeriod(period);
+        timer.setOverrunPolicy(DwfTime::OverrunPolicy::CATCH_UP); // Every deadline is called, so that lateness is measured against it
+        timer.callOnTimeout([&probe]{probe.onTimeout();});
+        probe.setStartTime(std::chrono::steady_clock::now());
+        timer.start();
+        std::this_thread::sleep_for(C_RUN_DURATION + std::chrono::milliseconds(100));
+        timer.stop();
+    }
+
+    std::vector<int64_t>& lateness_us = probe.latenessUs();
+    if(lateness_us.empty())
+    {
+        printf("   %-18s : no call\n", name);
+        return;
+    }
+    size_t buckets[C_BUCKET_NB] = {};
+    for(int64_t lateness : lateness_us)
+    {
+        ++buckets[std::upper_bound(std::begin(C_BUCKET_LIMITS_US), std::end(C_BUCKET_LIMITS_US), lateness) - std::begin(C_BUCKET_LIMITS_US)];
+    }
+    std::sort(lateness_us.begin(), lateness_us.end());
+    printf("   %-18s : %6zu calls, p50 %7lld us p99 %7lld us max %7lld us |", name, lateness_us.size(), static_cast<long long>(lateness_us[lateness_us.size() / 2]),
+           static_cast<long long>(lateness_us[lateness_us.size() * 99 / 100]), static_cast<long long>(lateness_us.back()));
+    for(size_t i = 0u; i < C_BUCKET_NB; ++i)
+    {
+        printf(" %5.1f", 100.0 * buckets[i] / lateness_us.size());
+    }
+    printf("\n");
+}
+
+/*!
+* @brief Measure both backends at a period
+* @param period : period of the timer
+*
+*/
+static void measurePeriod(std::chrono::microseconds period)
+{
+    measureBackend("condition_variable", DwfTime::TimerBackend::CONDITION_VARIABLE, period);
+    measureBackend("timerfd", DwfTime::TimerBackend::TIMERFD, period);
+}
+
+int main(int, char*[])
+{
+    setvbuf(stdout, nullptr, _IOLBF, 0); // Print each measure as soon as it is available
+    printf("Lateness of periodic timers running %lld ms, %u hardware threads\n", static_cast<long long>(C_RUN_DURATION.count()), std::thread::hardware_concurrency());
+    printf("Histogram columns, in %% of calls : lateness <");
+    for(int64_t limit : C_BUCKET_LIMITS_US)
+    {
+        printf(" %lld", static_cast<long long>(limit));
+    }
+    printf(" us and more\n");
+
+    for(bool loaded : {false, true})
+    {
+        std::atomic<bool> load_running(loaded);
+        std::vector<std::thread> load_threads;
+        for(unsigned int i = 0u; loaded && i < std::max(1u, std::thread::hardware_concurrency()); ++i)
+        {
+            load_threads.emplace_back([&load_running]
+            {
+                volatile uint64_t counter = 0u;
+                while(load_running)
+                {
+                    counter = counter + 1u;
+                }
+            });
+        }
+
+        for(std::chrono::microseconds period : {std::chrono::microseconds(1000), std::chrono::microseconds(100)})
+        {
+            printf("%s, %lld Hz :\n", loaded ? "Every hardware thread busy" : "Idle", static_cast<long long>(1000000 / period.count()));
+            measurePeriod(period);
+        }
+
+        load_running = false;
+        for(std::thread& load_thread : load_threads)
+        {
+            load_thread.join();
+        }
+    }
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
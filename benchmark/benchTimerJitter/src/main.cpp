@@ -0,0 +1,311 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the timer jitter benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure lateness of periodic timer calls against their ideal schedule over 100k ticks,
+ * with DwfTimer absolute deadlines and with the relative waits DwfTimer used before.
+ * Then measure calls and missed deadlines of each overrun policy with an overrunning timeout function.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwftimer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static const size_t C_TIMER_NB = 100u; /*!< Number of timers running at once.*/
+static const uint32_t C_TICK_NB = 1000u; /*!< Number of ticks of each timer, so that 100k ticks are measured.*/
+static const std::chrono::milliseconds C_PERIOD(2); /*!< Period of timers.*/
+
+/*! @class LatenessProbe
+* @brief Timeout function recording lateness of each call against the first call plus a whole number of periods
+*
+*/
+class LatenessProbe
+{
+public:
+    LatenessProbe() : m_first_call(), m_lateness_us()
+    {
+        m_lateness_us.reserve(C_TICK_NB);
+    }
+
+    void onTimeout()
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if(m_lateness_us.empty())
+        {
+            m_first_call = now;
+        }
+        if(m_lateness_us.size() < C_TICK_NB)
+        {
+            m_lateness_us.push_back(std::chrono::duration_cast<std::chrono::microseconds>(now - m_first_call - static_cast<int64_t>(m_lateness_us.size()) * C_PERIOD).count());
+        }
+    }
+
+    bool done() const
+    {
+        return m_lateness_us.size() >= C_TICK_NB;
+    }
+
+    const std::vector<int64_t>& latenessUs() const
+    {
+        return m_lateness_us;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_first_call; /*!< Time of first call, origin of the ideal schedule.*/
+    std::vector<int64_t> m_lateness_us; /*!< Lateness of each call against ideal schedule, in microseconds.*/
+};
+
+/*! @class RelativeTimer
+* @brief Periodic timer waiting one period minus computation time between calls, as DwfTimer did before absolute deadlines
+*
+*/
+class RelativeTimer
+{
+public:
+    RelativeTimer(LatenessProbe& probe) : m_probe(probe), m_started(false), m_mutex(), m_stop_wait(), m_thread()
+    {
+    }
+
+    ~RelativeTimer()
+    {
+        stop();
+    }
+
+    void start()
+    {
+        m_started = true;
+        m_thread = std::thread([this]
+        {
+            std::chrono::microseconds computation_time(0);
+            while(m_started)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if(m_stop_wait.wait_for(lock, C_PERIOD - computation_time) == std::cv_status::timeout)
+                {
+                    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+                    m_probe.onTimeout();
+                    computation_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time);
+                }
+            }
+        });
+    }
+
+    void stop()
+    {
+        m_started = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stop_wait.notify_one();
+        }
+        if(m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+    LatenessProbe& m_probe; /*!< Timeout function.*/
+    std::atomic<bool> m_started; /*!< Flag indicating if timer has been started.*/
+    std::mutex m_mutex; /*!< Mutex protecting the condition variable.*/
+    std::condition_variable m_stop_wait; /*!< Condition variable used to wait for timeout.*/
+    std::thread m_thread; /*!< Thread waiting for timeouts.*/
+};
+
+/*!
+* @brief Wait for every probe to record C_TICK_NB ticks then print lateness statistics
+* @param name : name of the timer implementation
+* @param probes : timeout functions of the timers
+*
+*/
+static void printLateness(const char* name, const std::vector<LatenessProbe>& probes)
+{
+    std::vector<int64_t> lateness_us;
+    int64_t final_lateness_us = 0;
+    for(const LatenessProbe& probe : probes)
+    {
+        lateness_us.insert(lateness_us.end(), probe.latenessUs().begin(), probe.latenessUs().end());
+        final_lateness_us += probe.latenessUs().empty() ? 0 : probe.latenessUs().back();
+    }
+    std::sort(lateness_us.begin(), lateness_us.end());
+    const size_t tick_nb = lateness_us.size();
+    printf("   %-24s : %6zu ticks, lateness p50 %8.3f ms p99 %8.3f ms max %8.3f ms, mean lateness of last tick %8.3f ms\n", name, tick_nb,
+           lateness_us[tick_nb / 2u] / 1e3, lateness_us[tick_nb * 99u / 100u] / 1e3, lateness_us.back() / 1e3, final_lateness_us / 1e3 / probes.size());
+}
+
+/*!
+* @brief Run timers until they all ticked C_TICK_NB times
+* @param start : function starting timer i with probe i
+* @param stop : function stopping all timers
+* @param probes : timeout functions of the timers
+*
+*/
+template<class Start, class Stop>
+static void runTimers(Start start, Stop stop, const std::vector<LatenessProbe>& probes)
+{
+    for(size_t i = 0u; i < probes.size(); ++i)
+    {
+        start(i);
+    }
+    std::this_thread::sleep_for(C_PERIOD * C_TICK_NB);
+    while(!std::all_of(probes.begin(), probes.end(), [](const LatenessProbe& probe){return probe.done();}))
+    {
+        std::this_thread::sleep_for(C_PERIOD * 10);
+    }
+    stop();
+}
+
+/*!
+* @brief Measure calls and missed deadlines of a timer whose function overruns every 50 calls
+* @param name : name of the overrun policy
+* @param overrun_policy : overrun policy of the timer
+*
+*/
+static void measureOverrun(const char* name, DwfTime::OverrunPolicy overrun_policy)
+{
+    const std::chrono::milliseconds period(5);
+    const std::chrono::milliseconds run_duration(2000);
+    uint32_t called = 0u;
+    DwfTime::DwfTimer timer;
+    timer.setSingleShot(false);
+    timer.setPeriod(period);
+    timer.setOverrunPolicy(overrun_policy);
+    timer.callOnTimeout([&called, period]
+    {
+        if(++called % 50u == 0u)
+        {
+            std::this_thread::sleep_for(period * 5 / 2); // Overruns two deadlines
+        }
+    });
+    timer.start();
+    std::this_thread::sleep_for(run_duration);
+    timer.stop();
+    printf("   %-24s : %4u calls for %4lld deadlines, %3llu missed deadlines\n", name, called, static_cast<long long>(run_duration / period), static_cast<unsigned long long>(timer.missedDeadlineNb()));
+}
+
+int main(int, char*[])
+{
+    printf("%zu periodic timers of %lld ms ticking %u times each, %u hardware threads\n", C_TIMER_NB, static_cast<long long>(C_PERIOD.count()), C_TICK_NB, std::thread::hardware_concurrency());
+
+    std::vector<LatenessProbe> timer_probes(C_TIMER_NB);
+    std::vector< std::unique_ptr<DwfTime::DwfTimer> > timers;
+    runTimers([&timer_probes, &timers](size_t i)
+    {
+        timers.emplace_back(new DwfTime::DwfTimer());
+        timers.back()->setSingleShot(false);
+        timers.back()->setPeriod(C_PERIOD);
+        LatenessProbe& probe = timer_probes[i];
+        timers.back()->callOnTimeout([&probe]{probe.onTimeout();});
+        timers.back()->start();
+    }, [&timers]{timers.clear();}, timer_probes);
+    printLateness("DwfTimer absolute", timer_probes);
+
+    std::vector<LatenessProbe> relative_probes(C_TIMER_NB);
+    std::vector< std::unique_ptr<RelativeTimer> > relative_timers;
+    runTimers([&relative_probes, &relative_timers](size_t i)
+    {
+        relative_timers.emplace_back(new RelativeTimer(relative_probes[i]));
+        relative_timers.back()->start();
+    }, [&relative_timers]{relative_timers.clear();}, relative_probes);
+    printLateness("relative wait_for", relative_probes);
+
+    printf("Timer of 5 ms whose function overruns two deadlines every 50 calls, during 2 s\n");
+    measureOverrun("SKIP", DwfTime::OverrunPolicy::SKIP);
+    measureOverrun("CATCH_UP", DwfTime::OverrunPolicy::CATCH_UP);
+    measureOverrun("FIRE_IMMEDIATELY", DwfTime::OverrunPolicy::FIRE_IMMEDIATELY);
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,250 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the timer restart benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure latency and heap allocations of restarting a running periodic timer, either re-arming the persistent task of a DwfTimer,
+ * cancelling and scheduling a new DwfTimerService task as DwfTimer used to, or joining and spawning a thread as DwfTimer did before DwfTimerService.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwftimer.h"
+#include "dwftimerservice.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+
+static std::atomic<uint64_t> g_allocation_nb(0u); /*!< Number of calls to operator new since program start.*/
+
+void* operator new(std::size_t size)
+{
+    ++g_allocation_nb;
+    void* ptr = std::malloc(size == 0u ? 1u : size);
+    if(!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static const std::chrono::milliseconds C_PERIOD(10); /*!< Period of restarted timers.*/
+static const uint32_t C_RESTART_NB = 100000u; /*!< Number of restarts for each measure.*/
+static const uint32_t C_THREAD_RESTART_NB = 2000u; /*!< Number of restarts with a thread per timer. Spawning threads is too slow for more.*/
+
+/*! @class ThreadTimer
+* @brief Periodic timer running in a dedicated thread, as DwfTimer did before DwfTimerService
+*
+*/
+class ThreadTimer
+{
+public:
+    ThreadTimer(std::function<void()> timeout_function) : m_timeout_function(timeout_function), m_started(false), m_mutex(), m_stop_wait(), m_thread()
+    {
+    }
+
+    ~ThreadTimer()
+    {
+        stop();
+    }
+
+    void start()
+    {
+        stop();
+        m_started = true;
+        m_thread = std::thread([this]
+        {
+            while(m_started)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if(m_stop_wait.wait_for(lock, C_PERIOD) == std::cv_status::timeout)
+                {
+                    m_timeout_function();
+                }
+            }
+        });
+    }
+
+    void stop()
+    {
+        m_started = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stop_wait.notify_one();
+        }
+        if(m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+    std::function<void()> m_timeout_function; /*!< Timeout function.*/
+    std::atomic<bool> m_started; /*!< Flag indicating if timer has been started.*/
+    std::mutex m_mutex; /*!< Mutex protecting the condition variable.*/
+    std::condition_variable m_stop_wait; /*!< Condition variable used to wait for timeout.*/
+    std::thread m_thread; /*!< Thread waiting for timeouts.*/
+};
+
+/*!
+* @brief Restart a running timer many times and print restart latency and allocations
+* @param name : name of the restart implementation
+* @param restart_nb : number of restarts
+* @param restart : function restarting the timer
+*
+*/
+static void measureRestarts(const char* name, uint32_t restart_nb, const std::function<void()>& restart)
+{
+    restart(); // Timer is running when measure starts
+    std::chrono::nanoseconds max_latency(0);
+    const uint64_t allocation_nb = g_allocation_nb;
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < restart_nb; ++i)
+    {
+        const std::chrono::steady_clock::time_point restart_time = std::chrono::steady_clock::now();
+        restart();
+        max_latency = std::max(max_latency, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - restart_time));
+    }
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    const double allocations = static_cast<double>(g_allocation_nb - allocation_nb) / restart_nb;
+    printf("   %-24s : %7u restarts, latency mean %9.3f us max %9.3f us, %4.2f allocations per restart\n", name, restart_nb, duration.count() * 1e6 / restart_nb,
+           max_latency.count() / 1e3, allocations);
+}
+
+int main(int, char*[])
+{
+    setvbuf(stdout, nullptr, _IOLBF, 0); // Print each measure as soon as it is available
+    printf("Restarts of a running %lld ms periodic timer, %u hardware threads\n", static_cast<long long>(C_PERIOD.count()), std::thread::hardware_concurrency());
+    std::atomic<uint64_t> call_nb(0u);
+
+    DwfTime::DwfTimer timer;
+    timer.setSingleShot(false);
+    timer.setPeriod(C_PERIOD);
+    timer.callOnTimeout([&call_nb]{++call_nb;});
+    measureRestarts("DwfTimer re-arm", C_RESTART_NB, [&timer]{timer.start();});
+    bool doubled = false;
+    measureRestarts("DwfTimer period change", C_RESTART_NB, [&timer, &doubled]
+    {
+        doubled = !doubled;
+        timer.stop();
+        timer.setPeriod(doubled ? C_PERIOD * 2 : C_PERIOD);
+        timer.start();
+    });
+    timer.stop();
+
+    DwfTime::DwfTimerService& service = DwfTime::DwfTimerService::instance();
+    DwfTime::DwfTimerService::TaskID task = DwfTime::DwfTimerService::C_NO_TASK;
+    measureRestarts("cancel then schedule", C_RESTART_NB, [&service, &task, &call_nb]
+    {
+        service.cancel(task);
+        task = service.schedulePeriodic(std::chrono::steady_clock::now() + C_PERIOD, C_PERIOD, DwfTime::OverrunPolicy::FIRE_IMMEDIATELY, [&call_nb]{++call_nb;});
+    });
+    service.cancel(task);
+
+    ThreadTimer thread_timer([&call_nb]{++call_nb;});
+    measureRestarts("thread per restart", C_THREAD_RESTART_NB, [&thread_timer]{thread_timer.start();});
+    thread_timer.stop();
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
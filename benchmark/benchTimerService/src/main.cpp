@@ -0,0 +1,344 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the timer service benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure threads, start duration and period jitter of many periodic timers, either serviced by DwfTimerService
+ * or each running in its own thread as DwfTimer used to.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwftimer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+static const std::chrono::milliseconds C_PERIOD(100); /*!< Period of every timer.*/
+static const std::chrono::milliseconds C_RUN_DURATION(2000); /*!< Duration timers run for each measure.*/
+static const size_t C_MAX_THREAD_TIMER_NB = 2000u; /*!< Largest number of timers run with a thread per timer. Thousands of threads on few cores take minutes to start and stop.*/
+
+/*!
+* @brief Get number of threads of the process
+* @return Number of threads, 0 if unknown
+*
+*/
+static uint32_t threadNb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while(std::getline(status, line))
+    {
+        if(line.compare(0, 8, "Threads:") == 0)
+        {
+            return static_cast<uint32_t>(std::stoul(line.substr(8)));
+        }
+    }
+    return 0u;
+}
+
+/*! @class JitterProbe
+* @brief Timeout function measuring deviation of intervals between calls from timer period
+*
+*/
+class JitterProbe
+{
+public:
+    JitterProbe() : m_last_call(), m_call_nb(0u), m_jitter_sum_us(0u), m_jitter_max_us(0u)
+    {
+    }
+
+    void onTimeout()
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if(m_call_nb++ > 0u)
+        {
+            const int64_t interval_us = std::chrono::duration_cast<std::chrono::microseconds>(now - m_last_call).count();
+            const uint64_t jitter_us = static_cast<uint64_t>(std::abs(interval_us - std::chrono::duration_cast<std::chrono::microseconds>(C_PERIOD).count()));
+            m_jitter_sum_us += jitter_us;
+            m_jitter_max_us = std::max(m_jitter_max_us, jitter_us);
+        }
+        m_last_call = now;
+    }
+
+    uint64_t callNb() const
+    {
+        return m_call_nb;
+    }
+
+    uint64_t jitterSumUs() const
+    {
+        return m_jitter_sum_us;
+    }
+
+    uint64_t jitterMaxUs() const
+    {
+        return m_jitter_max_us;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_last_call; /*!< Time of previous call.*/
+    uint64_t m_call_nb; /*!< Number of calls.*/
+    uint64_t m_jitter_sum_us; /*!< Sum of deviations of intervals from period, in microseconds.*/
+    uint64_t m_jitter_max_us; /*!< Largest deviation of an interval from period, in microseconds.*/
+};
+
+/*! @class ThreadTimer
+* @brief Periodic timer running in a dedicated thread, as DwfTimer did before DwfTimerService
+*
+*/
+class ThreadTimer
+{
+public:
+    ThreadTimer(JitterProbe& probe) : m_probe(probe), m_started(false), m_mutex(), m_stop_wait(), m_thread()
+    {
+    }
+
+    ~ThreadTimer()
+    {
+        stop();
+    }
+
+    void start()
+    {
+        m_started = true;
+        m_thread = std::thread([this]
+        {
+            std::chrono::microseconds computation_time(0);
+            while(m_started)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if(m_stop_wait.wait_for(lock, C_PERIOD - computation_time) == std::cv_status::timeout)
+                {
+                    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+                    m_probe.onTimeout();
+                    computation_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time);
+                }
+            }
+        });
+    }
+
+    void stop()
+    {
+        m_started = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stop_wait.notify_one();
+        }
+        if(m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+    JitterProbe& m_probe; /*!< Timeout function.*/
+    std::atomic<bool> m_started; /*!< Flag indicating if timer has been started.*/
+    std::mutex m_mutex; /*!< Mutex protecting the condition variable.*/
+    std::condition_variable m_stop_wait; /*!< Condition variable used to wait for timeout.*/
+    std::thread m_thread; /*!< Thread waiting for timeouts.*/
+};
+
+/*!
+* @brief Print measures of a run
+* @param name : name of the timer implementation
+* @param timer_nb : number of timers
+* @param thread_nb : number of threads of the process while timers run
+* @param start_duration : duration to start every timer
+* @param probes : timeout functions of the timers
+*
+*/
+static void printMeasures(const char* name, size_t timer_nb, uint32_t thread_nb, std::chrono::duration<double> start_duration, const std::vector<JitterProbe>& probes)
+{
+    uint64_t call_nb = 0u;
+    uint64_t jitter_sum_us = 0u;
+    uint64_t jitter_max_us = 0u;
+    for(const JitterProbe& probe : probes)
+    {
+        call_nb += probe.callNb();
+        jitter_sum_us += probe.jitterSumUs();
+        jitter_max_us = std::max(jitter_max_us, probe.jitterMaxUs());
+    }
+    const double expected_call_nb = static_cast<double>(timer_nb) * C_RUN_DURATION.count() / C_PERIOD.count();
+    const uint64_t interval_nb = call_nb > timer_nb ? call_nb - timer_nb : 1u;
+    printf("   %-16s %6zu timers : %6u threads, start %8.2f ms, %5.1f %% of expected calls, jitter mean %8.1f us max %8.1f ms\n", name, timer_nb, thread_nb, start_duration.count() * 1e3,
+           100.0 * call_nb / expected_call_nb, static_cast<double>(jitter_sum_us) / interval_nb, jitter_max_us / 1e3);
+}
+
+/*!
+* @brief Run timers serviced by DwfTimerService
+* @param timer_nb : number of timers
+*
+*/
+static void measureService(size_t timer_nb)
+{
+    std::vector<JitterProbe> probes(timer_nb);
+    std::vector< std::unique_ptr<DwfTime::DwfTimer> > timers;
+    for(size_t i = 0u; i < timer_nb; ++i)
+    {
+        timers.emplace_back(new DwfTime::DwfTimer());
+        timers.back()->setSingleShot(false);
+        timers.back()->setPeriod(C_PERIOD);
+        JitterProbe& probe = probes[i];
+        timers.back()->callOnTimeout([&probe]{probe.onTimeout();});
+    }
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(std::unique_ptr<DwfTime::DwfTimer>& timer : timers)
+    {
+        timer->start();
+    }
+    std::chrono::duration<double> start_duration = std::chrono::steady_clock::now() - start_time;
+    std::this_thread::sleep_for(C_RUN_DURATION);
+    const uint32_t thread_nb = threadNb();
+    timers.clear();
+
+    printMeasures("DwfTimerService", timer_nb, thread_nb, start_duration, probes);
+}
+
+/*!
+* @brief Run timers each running in its own thread
+* @param timer_nb : number of timers
+*
+*/
+static void measureThreads(size_t timer_nb)
+{
+    if(timer_nb > C_MAX_THREAD_TIMER_NB)
+    {
+        printf("   %-16s %6zu timers : skipped, more than %zu threads\n", "thread per timer", timer_nb, C_MAX_THREAD_TIMER_NB);
+        return;
+    }
+    std::vector<JitterProbe> probes(timer_nb);
+    std::vector< std::unique_ptr<ThreadTimer> > timers;
+    for(size_t i = 0u; i < timer_nb; ++i)
+    {
+        timers.emplace_back(new ThreadTimer(probes[i]));
+    }
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    try
+    {
+        for(std::unique_ptr<ThreadTimer>& timer : timers)
+        {
+            timer->start();
+        }
+    }
+    catch(const std::system_error& error)
+    {
+        printf("   %-16s %6zu timers : could not spawn every thread (%s)\n", "thread per timer", timer_nb, error.what());
+        timers.clear();
+        return;
+    }
+    std::chrono::duration<double> start_duration = std::chrono::steady_clock::now() - start_time;
+    std::this_thread::sleep_for(C_RUN_DURATION);
+    const uint32_t thread_nb = threadNb();
+    timers.clear();
+
+    printMeasures("thread per timer", timer_nb, thread_nb, start_duration, probes);
+}
+
+int main(int, char*[])
+{
+    setvbuf(stdout, nullptr, _IOLBF, 0); // Print each measure as soon as it is available
+    printf("Periodic timers of %lld ms running %lld ms, %u hardware threads\n", static_cast<long long>(C_PERIOD.count()), static_cast<long long>(C_RUN_DURATION.count()), std::thread::hardware_concurrency());
+    for(size_t timer_nb : {100u, 1000u, 10000u})
+    {
+        measureService(timer_nb);
+        measureThreads(timer_nb);
+    }
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
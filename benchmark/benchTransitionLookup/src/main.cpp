@@ -0,0 +1,252 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the transition lookup benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure memory allocations and duration of AbstractStateMachine event dispatch for a machine with many transitions per state. <br>
+ * Compares current dispatch with the former one which copied transition map and function for every event. <br>
+ * Returns a non zero value if current dispatch performs any memory allocation.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstractstatemachine.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+static std::atomic<uint64_t> g_allocation_nb(0u); /*!< Number of calls to operator new since program start.*/
+
+void* operator new(std::size_t size)
+{
+    ++g_allocation_nb;
+    void* ptr = std::malloc(size == 0u ? 1u : size);
+    if(!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static const DwfStateMachine::StateID C_STATE_NB = 4u; /*!< Number of states of the benchmarked machine.*/
+static const EventSystem::EventID C_TRANSITION_NB = 64u; /*!< Number of transitions per state of the benchmarked machine.*/
+static const uint32_t C_EVENT_NB = 200000u; /*!< Number of events dispatched for each measure.*/
+
+/*! @class BenchStateMachine
+* @brief State machine whose states all accept C_TRANSITION_NB events.
+*
+* Every transition moves machine to the next state.
+* Events are dispatched directly from the calling thread, event processing thread is never started.
+*
+*/
+class BenchStateMachine : public DwfStateMachine::AbstractStateMachine
+{
+public:
+    BenchStateMachine() : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(0u)), m_transition_nb(0u)
+    {
+        setupTransitionMap();
+    }
+
+    /*!
+    * @brief Dispatch an event using AbstractStateMachine::processEvent
+    * @param event : event to dispatch
+    *
+    */
+    void dispatch(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        processEvent(std::move(event));
+    }
+
+    /*!
+    * @brief Dispatch an event copying transition map and function as done before lookup by reference
+    * @param event : event to dispatch
+    *
+    */
+    void copyDispatch(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        EventTransitionMap ev_tr_map;
+        TransitionFunction tr_function;
+        try
+        {
+            ev_tr_map=m_transition_map.at(m_current_state);
+            tr_function=ev_tr_map.at(*event);
+        }
+        catch (const std::exception&)
+        {
+        }
+        if(tr_function)
+        {
+            tr_function(std::move(event));
+        }
+    }
+
+    uint64_t transitionNb() const
+    {
+        return m_transition_nb;
+    }
+
+protected:
+    virtual void setupTransitionMap()
+    {
+        for(DwfStateMachine::StateID state = 0u; state < C_STATE_NB; ++state)
+        {
+            EventTransitionMap transitions;
+            for(EventSystem::EventID event = 0u; event < C_TRANSITION_NB; ++event)
+            {
+                transitions.insert({EventSystem::DwfEvent(event), [this](std::unique_ptr<EventSystem::DwfEvent>&&){nextState();}});
+            }
+            m_transition_map.insert({DwfStateMachine::DwfState(state), transitions});
+        }
+    }
+
+    virtual void onDeadEndState(const std::exception&)
+    {
+    }
+
+private:
+    void nextState()
+    {
+        ++m_transition_nb;
+        m_current_state = DwfStateMachine::DwfState((m_current_state.getId() + 1u) % C_STATE_NB);
+    }
+
+    uint64_t m_transition_nb; /*!< Number of transitions performed.*/
+};
+
+/*!
+* @brief Dispatch C_EVENT_NB events and print allocations and duration per event
+* @param name : name of the measured dispatch
+* @param events : events to dispatch in a round robin way
+* @param dispatch : dispatch function to measure
+* @return number of allocations per event
+*
+*/
+template<class Dispatch>
+double measure(const char* name, std::vector< std::unique_ptr<EventSystem::DwfEvent> >& events, Dispatch dispatch)
+{
+    uint64_t allocations_start = g_allocation_nb;
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 0u; i < C_EVENT_NB; ++i)
+    {
+        dispatch(std::move(events[i % events.size()])); // Transitions do not take ownership so events remain available
+    }
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start_time;
+    double allocations_per_event = static_cast<double>(g_allocation_nb - allocations_start) / C_EVENT_NB;
+
+    printf("   %-16s : %8.2f allocations/event, %10.1f ns/event\n", name, allocations_per_event, static_cast<double>(duration.count()) / C_EVENT_NB);
+    return allocations_per_event;
+}
+
+int main(int, char*[])
+{
+    BenchStateMachine machine;
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > events;
+    for(EventSystem::EventID event = 0u; event < C_TRANSITION_NB; ++event)
+    {
+        events.emplace_back(new EventSystem::DwfEvent(event));
+    }
+
+    printf("Dispatch of %u events on a machine with %u states and %u transitions per state\n", C_EVENT_NB, C_STATE_NB, C_TRANSITION_NB);
+    measure("copy lookup", events, [&machine](std::unique_ptr<EventSystem::DwfEvent>&& event){machine.copyDispatch(std::move(event));});
+    double allocations_per_event = measure("reference lookup", events, [&machine](std::unique_ptr<EventSystem::DwfEvent>&& event){machine.dispatch(std::move(event));});
+    printf("   Transitions performed : %lu\n", static_cast<unsigned long>(machine.transitionNb()));
+
+    return allocations_per_event == 0.0 ? 0 : 1;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,247 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the value events benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure heap allocations and throughput of a state machine fed with events allocated with global operator new,
+ * with events allocated from DwfEventPool, with payload events and with value events stored in a ValueEventQueue.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstractstatemachine.h"
+#include "valueeventqueue.h"
+#include "dwfpayloadevent.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+
+static std::atomic<uint64_t> g_allocation_nb(0u); /*!< Number of calls to operator new since program start.*/
+
+void* operator new(std::size_t size)
+{
+    ++g_allocation_nb;
+    void* ptr = std::malloc(size == 0u ? 1u : size);
+    if(!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static const uint32_t C_BURST_SIZE = 1000u; /*!< Number of events pushed before waiting for them to be processed.*/
+static const uint32_t C_BURST_NB = 1000u; /*!< Number of bursts for each measure.*/
+
+/*! @class HeapEvent
+* @brief Event allocated with global operator new, as events were before DwfEventPool
+*
+*/
+class HeapEvent : public EventSystem::DwfEvent
+{
+public:
+    HeapEvent(EventSystem::EventID id) : EventSystem::DwfEvent(id)
+    {
+    }
+
+    static void* operator new(std::size_t size)
+    {
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* event, std::size_t)
+    {
+        ::operator delete(event);
+    }
+};
+
+/*! @class BenchStateMachine
+* @brief State machine toggling between two states on event 1 and ignoring event 2
+*
+*/
+class BenchStateMachine : public DwfStateMachine::AbstractStateMachine
+{
+public:
+    BenchStateMachine(std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(0u), std::move(event_queue)), m_transition_nb(0u)
+    {
+    }
+
+    uint32_t transitionNb() const
+    {
+        return m_transition_nb.load(std::memory_order_acquire);
+    }
+
+protected:
+    virtual void setupTransitionMap()
+    {
+        for(DwfStateMachine::StateID state = 0u; state < 2u; ++state)
+        {
+            DwfStateMachine::DwfState next_state(1u - state);
+            m_transition_map[DwfStateMachine::DwfState(state)].insert({EventSystem::DwfEvent(1u), [this, next_state](std::unique_ptr<EventSystem::DwfEvent>&&)
+            {
+                m_transition_nb.store(m_transition_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+                m_current_state = next_state;
+            }});
+        }
+    }
+
+    virtual void onDeadEndState(const std::exception&)
+    {
+    }
+
+private:
+    std::atomic<uint32_t> m_transition_nb; /*!< Number of transitions performed.*/
+};
+
+/*!
+* @brief Push C_BURST_NB bursts of C_BURST_SIZE events and print allocations per event and throughput
+* @param name : name of the measured event kind
+* @param event_queue : queue used by the state machine
+* @param push : function pushing one event with id 1 to the machine
+*
+*/
+template<class Push>
+void measure(const char* name, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue, Push push)
+{
+    BenchStateMachine machine(std::move(event_queue));
+    machine.setupAndStart();
+
+    const uint64_t allocation_nb = g_allocation_nb;
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t burst = 1u; burst <= C_BURST_NB; ++burst)
+    {
+        for(uint32_t i = 0u; i < C_BURST_SIZE; ++i)
+        {
+            push(machine);
+        }
+        while(machine.transitionNb() < burst * C_BURST_SIZE)
+        {
+            std::this_thread::yield();
+        }
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time;
+    const double allocations = static_cast<double>(g_allocation_nb - allocation_nb) / (C_BURST_NB * C_BURST_SIZE);
+    machine.stop();
+
+    printf("   %-24s : %6.3f allocations/event %8.2f M ev/s\n", name, allocations, C_BURST_NB * C_BURST_SIZE / duration.count() / 1e6);
+}
+
+int main(int, char*[])
+{
+    printf("State machine fed with %u bursts of %u events, %u hardware threads\n", C_BURST_NB, C_BURST_SIZE, std::thread::hardware_concurrency());
+    measure("unique_ptr, operator new", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::ValueEventQueue()), [](BenchStateMachine& machine)
+    {
+        machine.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new HeapEvent(1u)));
+    });
+    measure("unique_ptr, DwfEventPool", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::ValueEventQueue()), [](BenchStateMachine& machine)
+    {
+        machine.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(1u)));
+    });
+    measure("DwfPayloadEvent", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::ValueEventQueue()), [](BenchStateMachine& machine)
+    {
+        machine.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfPayloadEvent(1u, std::string("payload"))));
+    });
+    measure("DwfValueEvent", std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::ValueEventQueue()), [](BenchStateMachine& machine)
+    {
+        machine.pushValueEvent(EventSystem::DwfValueEvent(1u, 42));
+    });
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,189 @@
+/*!
+ * @file main.cpp
+ * @brief Main application file of the wait strategy benchmark.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Measure push to dispatch latency of events separated by idle gaps,
+ * for an event processor parking immediately and one spinning before parking.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "abstracteventprocessor.h"
+#include "waitstrategy.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static const uint32_t C_EVENT_NB = 20000u; /*!< Number of events pushed for each measure.*/
+static const std::chrono::microseconds C_IDLE_GAP(20); /*!< Duration between two events.*/
+
+/*! @class LatencyProcessor
+* @brief Event processor measuring push to dispatch latency
+*
+*/
+class LatencyProcessor : public EventSystem::AbstractEventProcessor
+{
+public:
+    LatencyProcessor(DwfContainers::WaitStrategy wait_strategy) : EventSystem::AbstractEventProcessor(DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT, DwfContainers::OverflowPolicy::THROW, wait_strategy),
+        m_processed_nb(0u), m_push_times(C_EVENT_NB), m_latencies()
+    {
+        m_latencies.reserve(C_EVENT_NB);
+    }
+
+    uint32_t processedNb() const
+    {
+        return m_processed_nb.load(std::memory_order_acquire);
+    }
+
+    void markPushed(uint32_t index)
+    {
+        m_push_times[index] = std::chrono::steady_clock::now();
+    }
+
+    std::vector<std::chrono::nanoseconds> latencies() const
+    {
+        return m_latencies;
+    }
+
+protected:
+    virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        m_latencies.push_back(std::chrono::steady_clock::now() - m_push_times[event->getId()]);
+        m_processed_nb.store(m_processed_nb.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> m_processed_nb; /*!< Number of processed events.*/
+
+    std::vector<std::chrono::steady_clock::time_point> m_push_times; /*!< Push time of each event. Published to processing thread by event queue.*/
+
+    std::vector<std::chrono::nanoseconds> m_latencies; /*!< Latency of each processed event.*/
+};
+
+/*!
+* @brief Push C_EVENT_NB events separated by C_IDLE_GAP and print latency percentiles
+* @param name : name of the measured strategy
+* @param wait_strategy : strategy of the event processor
+*
+*/
+void measure(const char* name, DwfContainers::WaitStrategy wait_strategy)
+{
+    LatencyProcessor processor(wait_strategy);
+    processor.start();
+
+    for(uint32_t i = 0u; i < C_EVENT_NB; ++i)
+    {
+        processor.markPushed(i);
+        processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(i)));
+        std::chrono::steady_clock::time_point gap_end = std::chrono::steady_clock::now() + C_IDLE_GAP;
+        while(std::chrono::steady_clock::now() < gap_end) {} // Busy wait so that gap does not depend on producer wake-up
+    }
+    while(processor.processedNb() < C_EVENT_NB)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    processor.stop();
+
+    std::vector<std::chrono::nanoseconds> latencies = processor.latencies();
+    std::sort(latencies.begin(), latencies.end());
+    printf("   %-22s : p50 %8.2f us   p99 %8.2f us   max %10.2f us\n", name, latencies[latencies.size() / 2u].count() / 1e3,
+           latencies[latencies.size() * 99u / 100u].count() / 1e3, latencies.back().count() / 1e3);
+}
+
+int main(int, char*[])
+{
+    printf("Push to dispatch latency of %u events separated by %ld us, %u hardware threads\n", C_EVENT_NB, static_cast<long>(C_IDLE_GAP.count()), std::thread::hardware_concurrency());
+    measure("WaitStrategy::park", DwfContainers::WaitStrategy::park());
+    measure("WaitStrategy::adaptive", DwfContainers::WaitStrategy::adaptive());
+    measure("spin 100000", DwfContainers::WaitStrategy(100000u, 0u));
+
+    return 0;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
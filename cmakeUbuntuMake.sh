@@ -17,6 +17,7 @@ NC='\033[0m' # No Color
 # Control Variables
 BUILD_DIR="build-dir"
 TESTS_DIR=$(ls test)
+BENCHMARKS_DIR=$(ls benchmark)
 
 # Help
 Help()
@@ -40,6 +41,12 @@ CleanTestDir()
     rm -f "test/${testName}/${testName}"
 }
 
+CleanBenchmarkDir()
+{
+    local benchmarkName="$1"
+    rm -f "benchmark/${benchmarkName}/${benchmarkName}"
+}
+
 Clean()
 {
     printf "${statusColor}Cleaning main directory${NC}\n"
@@ -49,6 +56,10 @@ Clean()
         printf "${statusColor}Cleaning test directory ${testDir}${NC}\n"
 	    CleanTestDir ${testDir}
 	done
+	for benchmarkDir in ${BENCHMARKS_DIR}; do
+        printf "${statusColor}Cleaning benchmark directory ${benchmarkDir}${NC}\n"
+	    CleanBenchmarkDir ${benchmarkDir}
+	done
 	
 }
 
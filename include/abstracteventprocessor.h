@@ -75,9 +75,13 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "dwfevent.h"
 #include "dwfqueue.h"
+#include "abstracteventqueue.h"
+#include "dwfvalueevent.h"
+#include "eventslot.h"
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <vector>
 
 /*!
 * @namespace EventSystem
@@ -99,11 +103,25 @@ namespace EventSystem
         /*!
         * @brief Constructor of AbstractEventProcessor class
         * @param max_element_nb : Max number of elements that can be stored in event queue. Default indicates no size limitation.
+        * @param overflow_policy : Behavior of pushEvent and pushEvents when event queue is full. Default throws an exception.
+        * @param wait_strategy : Way event processing thread waits for events. Default parks thread as soon as event queue is empty.
         *
-        * Constructor of the AbstractEventProcessor class setting event queue size limitation.
+        * Constructor of the AbstractEventProcessor class setting event queue size limitation, overflow policy and wait strategy.
+        * OverflowPolicy::COALESCE_BY_ID replaces the latest queued event with the same EventID.
+        * With OverflowPolicy::BLOCK, events must not be pushed from the event processing thread itself, as it would wait for itself to free room.
         *
         */
-        AbstractEventProcessor(size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<DwfEvent> >::C_NO_SIZE_LIMIT);
+        AbstractEventProcessor(size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<DwfEvent> >::C_NO_SIZE_LIMIT, DwfContainers::OverflowPolicy overflow_policy = DwfContainers::OverflowPolicy::THROW, DwfContainers::WaitStrategy wait_strategy = DwfContainers::WaitStrategy());
+
+        /*!
+        * @brief Constructor of AbstractEventProcessor class
+        * @param event_queue : Queue used to store events, for instance an EventQueue< DwfContainers::DwfSpscQueue< std::unique_ptr<DwfEvent> > >.
+        *
+        * Constructor of the AbstractEventProcessor class selecting event queue implementation.
+        * Throws std::invalid_argument if event_queue is null.
+        *
+        */
+        AbstractEventProcessor(std::unique_ptr<AbstractEventQueue>&& event_queue);
 
         /*!
         * @brief Destructor of AbstractEventProcessor class
@@ -118,11 +136,65 @@ namespace EventSystem
         * @param event : event to push to queue
         *
         * Push an event if queue is not full.
-        * If queue is full, throws an exception. And element is not moved.
+        * If queue is full, applies queue overflow policy. Event is not moved if an exception is thrown or if it is dropped.
+        * Waiting producers are released with an exception when event processing is stopped.
         *
         */
         void pushEvent(std::unique_ptr<DwfEvent>&& event);
 
+        /*!
+        * @brief Push an event with a priority using move semantics
+        * @param event : event to push to queue
+        * @param priority : priority of event. 0 is the lowest priority.
+        *
+        * Same as pushEvent. Events of higher priority are processed first if event queue has priority lanes, such as PriorityEventQueue.
+        * Otherwise priority is ignored.
+        *
+        */
+        void pushEvent(std::unique_ptr<DwfEvent>&& event, DwfContainers::Priority priority);
+
+        /*!
+        * @brief Try to push an event using move semantics
+        * @param event : event to push to queue
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::FULL if queue is full, PushStatus::NOT_STARTED if event was dropped. Event is only moved if pushed.
+        *
+        * Same as pushEvent, without exception when queue is full.
+        *
+        */
+        DwfContainers::PushStatus tryPushEvent(std::unique_ptr<DwfEvent>&& event);
+
+        /*!
+        * @brief Push an event using move semantics, waiting at most timeout for queue to have room
+        * @param event : event to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::TIMEOUT if queue stayed full or processing was stopped meanwhile, PushStatus::NOT_STARTED if event was dropped. Event is only moved if pushed.
+        *
+        * Waits whatever the queue overflow policy.
+        *
+        */
+        DwfContainers::PushStatus pushEventFor(std::unique_ptr<DwfEvent>&& event, std::chrono::nanoseconds timeout);
+
+        /*!
+        * @brief Push several events at once using move semantics
+        * @param events : events to push to queue, in order. Cleared once events are moved to queue.
+        *
+        * Push all events with a single queue access and a single wakeup of the processing thread, if queue can store them all.
+        * If queue cannot store all events, throws an exception or waits for room depending on queue overflow policy. No event is moved if an exception is thrown.
+        *
+        */
+        void pushEvents(std::vector< std::unique_ptr<DwfEvent> >& events);
+
+        /*!
+        * @brief Push a value event by copy
+        * @param event : event to push to queue
+        *
+        * Event is stored inline in event queue and processed by processValueEvent, without any allocation.
+        * Event queue must store value events, such as ValueEventQueue. Throws std::logic_error otherwise.
+        * If queue is full, applies queue overflow policy.
+        *
+        */
+        void pushValueEvent(const DwfValueEvent& event);
+
         /*!
          * @brief Start processing events
          *
@@ -134,28 +206,89 @@ namespace EventSystem
         /*!
          * @brief Stop processing events
          *
-         * Stop event procssing thread and clear event queue.
+         * Stop event procssing thread then clear event queue.
          *
          */
         void stop();
 
+        /*!
+         * @brief Set maximum number of events drained from queue at once
+         * @param max_batch_size : Maximum number of events popped at once. 1 processes events one at a time. 0 drains all available events.
+         *
+         * Batches are popped with a single queue access and a single wakeup, then handed to processEvents().
+         * Applies from the pop following the one pending when called. Default is 1.
+         *
+         */
+        void setMaxBatchSize(size_t max_batch_size);
+
+        /*!
+         * @brief Indicates number of events dropped by event queue overflow policy
+         * @return Number of dropped events. Events pushed while processing is not started are not counted.
+         *
+         */
+        uint64_t droppedEventNb() const;
+
+        /*!
+         * @brief Indicates number of events coalesced by event queue overflow policy
+         * @return Number of queued events replaced by a pushed event
+         *
+         */
+        uint64_t coalescedEventNb() const;
+
     protected:
+        /*!
+        * @brief Indicates whether event queue only supports a single producer thread
+        * @return true if events must all be pushed from the same thread, as with a DwfSpscQueue
+        *
+        * Lets daughter classes pushing events from their own threads (timers, ...) reject such queues.
+        *
+        */
+        bool hasSingleProducerQueue() const;
+
         /*!
         * @brief Process received event
         * @param event : latest event extracted from event queue
         *
+        * Event not taken over by the method is deleted on event processing thread once processed, giving its storage back to DwfEventPool.
         * Purely virtual method
         *
         */
         virtual void processEvent(std::unique_ptr<DwfEvent>&& event) = 0;
 
+        /*!
+        * @brief Process a batch of received events
+        * @param events : latest events extracted from event queue, in reception order
+        *
+        * Called instead of processEvent when max batch size is not 1.
+        * Not called if event queue stores value events : events of popped batches are then processed one by one.
+        * Default implementation calls processEvent for each event, until event processing is stopped.
+        * Virtual method
+        *
+        */
+        virtual void processEvents(std::vector< std::unique_ptr<DwfEvent> >& events);
+
+        /*!
+        * @brief Process received value event
+        * @param event : latest value event extracted from event queue
+        *
+        * Default implementation copies event in a BoxedValueEvent reused from one event to the other and calls processEvent with it.
+        * Box is only reallocated if processEvent takes it over. So state machines process value events without any allocation.
+        * Virtual method
+        *
+        */
+        virtual void processValueEvent(const DwfValueEvent& event);
+
     private:
-        DwfContainers::DwfQueue< std::unique_ptr<DwfEvent> > m_event_queue; /*!< Events queue.*/
+        std::unique_ptr<AbstractEventQueue> m_event_queue; /*!< Events queue.*/
 
         std::atomic<bool> m_start_event_processing; /*!< Flag indicating whether event are being processed.*/
 
+        std::atomic<size_t> m_max_batch_size; /*!< Maximum number of events popped at once.*/
+
         std::thread m_event_processing_thread; /*!< Thread processing events on reception.*/
 
+        std::unique_ptr<DwfEvent> m_value_event_box; /*!< BoxedValueEvent handed to processEvent by processValueEvent. Only used by event processing thread.*/
+
         /*!
         * @brief Wait for events to be received to process them.
         *
@@ -164,6 +297,15 @@ namespace EventSystem
         *
         */
         void waitEvents();
+
+        /*!
+        * @brief Wait for events to be received to process them, when event queue stores value events.
+        *
+        * Method run in the event processing thread.
+        * Wait for events, get them from queue as EventSlot and process them one by one.
+        *
+        */
+        void waitSlots();
     };
 }
 #endif //ABSTRACT_EVENT_PROCESSOR_H
@@ -0,0 +1,305 @@
+/*!
+ * @file abstracteventqueue.h
+ * @brief Interface of the event queues used by event processors.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Interface defining the operations an event processor needs from its event queue.
+ * Abstract class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef ABSTRACT_EVENT_QUEUE_H
+#define ABSTRACT_EVENT_QUEUE_H
+
+#include "dwfevent.h"
+#include "pushstatus.h"
+#include "dwfpriorityqueue.h"
+#include "dwfvalueevent.h"
+#include "eventslot.h"
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <chrono>
+
+/*!
+* @namespace EventSystem
+* @brief A namespace used to regroup all elements related to envent processing systems
+*/
+namespace EventSystem
+{
+    /*! @class AbstractEventQueue
+    * @brief Interface of the event queues used by event processors.
+    *
+    * Allows AbstractEventProcessor to work with any queue implementation (DwfQueue, DwfSpscQueue, ...).
+    * Use EventQueue to adapt a queue class to this interface.
+    * Abstract class.
+    *
+    */
+    class AbstractEventQueue
+    {
+    public:
+        /*!
+        * @brief Destructor of AbstractEventQueue class
+        *
+        */
+        virtual ~AbstractEventQueue() {}
+
+        /*!
+        * @brief Push an event using move semantics
+        * @param event : event to push to queue
+        *
+        * If queue is full, throws an exception or waits for room depending on queue overflow policy. Event is not moved if an exception is thrown.
+        * Purely virtual method
+        *
+        */
+        virtual void push(std::unique_ptr<DwfEvent>&& event) = 0;
+
+        /*!
+        * @brief Push an event with a priority using move semantics
+        * @param event : event to push to queue
+        * @param priority : priority of event. 0 is the lowest priority.
+        *
+        * Default implementation ignores priority and calls push, for queues without priority lanes.
+        * Virtual method
+        *
+        */
+        virtual void pushWithPriority(std::unique_ptr<DwfEvent>&& event, DwfContainers::Priority /*priority*/)
+        {
+            push(std::move(event));
+        }
+
+        /*!
+        * @brief Try to push an event using move semantics
+        * @param event : event to push to queue
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::FULL if queue is full. And event is not moved.
+        *
+        * Purely virtual method
+        *
+        */
+        virtual DwfContainers::PushStatus tryPush(std::unique_ptr<DwfEvent>&& event) = 0;
+
+        /*!
+        * @brief Push an event using move semantics, waiting at most timeout for queue to have room
+        * @param event : event to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled. And event is not moved.
+        *
+        * Purely virtual method
+        *
+        */
+        virtual DwfContainers::PushStatus pushFor(std::unique_ptr<DwfEvent>&& event, std::chrono::nanoseconds timeout) = 0;
+
+        /*!
+        * @brief Push several events at once using move semantics
+        * @param events : events to push to queue, in order. Cleared once events are moved to queue.
+        *
+        * If queue cannot store all events, throws an exception. And no event is moved.
+        * Purely virtual method
+        *
+        */
+        virtual void pushBatch(std::vector< std::unique_ptr<DwfEvent> >& events) = 0;
+
+        /*!
+        * @brief Wait for an event and pop it
+        * @param event : Reference to the event to move queue head to. Left untouched if wait is disabled.
+        *
+        * Purely virtual method
+        *
+        */
+        virtual void pop(std::unique_ptr<DwfEvent>& event) = 0;
+
+        /*!
+        * @brief Wait for events and pop several of them at once
+        * @param max_event_nb : Maximum number of events to pop. 0 indicates all available events.
+        * @param events : Vector popped events are appended to, in queue order
+        * @return Number of popped events. 0 if wait is disabled.
+        *
+        * Purely virtual method
+        *
+        */
+        virtual size_t popUpTo(size_t max_event_nb, std::vector< std::unique_ptr<DwfEvent> >& events) = 0;
+
+        /*!
+        * @brief Disable wait of events in queue, unlocking waiting thread
+        *
+        * Purely virtual method
+        *
+        */
+        virtual void disableWait() = 0;
+
+        /*!
+        * @brief Enable wait for events in queue
+        *
+        * Purely virtual method
+        *
+        */
+        virtual void enableWait() = 0;
+
+        /*!
+        * @brief Delete all events in queue
+        *
+        * Purely virtual method
+        *
+        */
+        virtual void clear() = 0;
+
+        /*!
+        * @brief Indicates number of events dropped by queue overflow policy
+        * @return Number of dropped events
+        *
+        * Purely virtual method
+        *
+        */
+        virtual uint64_t droppedEventNb() const = 0;
+
+        /*!
+        * @brief Indicates number of events coalesced by queue overflow policy
+        * @return Number of queued events replaced by a pushed event
+        *
+        * Purely virtual method
+        *
+        */
+        virtual uint64_t coalescedEventNb() const = 0;
+
+        /*!
+        * @brief Indicates whether queue only supports a single producer thread
+        * @return true if events must all be pushed from the same thread, false otherwise
+        *
+        * Default implementation returns false.
+        * Virtual method
+        *
+        */
+        virtual bool isSingleProducer() const
+        {
+            return false;
+        }
+
+        /*!
+        * @brief Indicates whether queue stores value events inline
+        * @return true if pushValue and popSlotsUpTo are supported, false otherwise
+        *
+        * Default implementation returns false.
+        * Virtual method
+        *
+        */
+        virtual bool storesValues() const
+        {
+            return false;
+        }
+
+        /*!
+        * @brief Push a value event by copy
+        * @param event : event to push to queue
+        *
+        * If queue is full, applies queue overflow policy.
+        * Default implementation throws std::logic_error, for queues only storing std::unique_ptr<DwfEvent>.
+        * Virtual method
+        *
+        */
+        virtual void pushValue(const DwfValueEvent& /*event*/)
+        {
+            throw std::logic_error("Event queue does not store value events");
+        }
+
+        /*!
+        * @brief Wait for events and pop several of them at once, whether they are value or polymorphic events
+        * @param max_event_nb : Maximum number of events to pop. 0 indicates all available events.
+        * @param slots : Vector popped events are appended to, in queue order
+        * @return Number of popped events. 0 if wait is disabled.
+        *
+        * Default implementation throws std::logic_error, for queues only storing std::unique_ptr<DwfEvent>.
+        * Virtual method
+        *
+        */
+        virtual size_t popSlotsUpTo(size_t /*max_event_nb*/, std::vector<EventSlot>& /*slots*/)
+        {
+            throw std::logic_error("Event queue does not store value events");
+        }
+    };
+}
+#endif //ABSTRACT_EVENT_QUEUE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -78,6 +78,11 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "abstractstatemachine.h"
 #include "dwftimer.h"
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 /*!
 * @namespace DwfStateMachine
@@ -85,6 +90,15 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 */
 namespace DwfStateMachine
 {
+    /*! @enum StateFunctionThread
+    *  @brief Thread periodic state functions are called from
+    */
+    enum class StateFunctionThread : uint8_t
+    {
+        TIMER_THREAD, /*!< State functions are called by a DwfTimerService worker, concurrently with transitions. Data shared with transitions, current state included, must be protected by the user.*/
+        EVENT_THREAD /*!< Timer ticks are pushed as internal events, so that state functions are called by event processing thread, one after the other with transitions, without any lock. Not supported by single producer event queues such as DwfSpscQueue, as ticks are pushed from a DwfTimerService worker.*/
+    };
+
     /*! @class AbstractPeriodicStateMachine
     * @brief Class representing event based state machine with periodic execution of computation.
     *
@@ -104,7 +118,18 @@ namespace DwfStateMachine
     * You must redefine the function setupTransitionMap() to construct the desired transition map during setupAndStart phase.
     *
     * You must redefine the function onDeadEndState() which defines the class behavior if a state has no associated transition
-    * (i.e. m_transition_map.at(state) throws an exception).
+    * (i.e. state has no entry in m_transition_map).
+    * Transitions and periodic functions are looked up without throwing any exception.
+    *
+    * By default, periodic functions are called by timer threads and race with transitions.
+    * With StateFunctionThread::EVENT_THREAD, timer ticks go through the event queue instead, so that periodic functions and transitions never run at once.
+    * A single tick is queued at once : ticks reached while event processing is late are dropped, as with OverrunPolicy::SKIP.
+    *
+    * Timer period is the base tick of the machine. On each tick, the periodic function of current state is called,
+    * then its periodic tasks of m_periodic_task_map whose period has elapsed, highest rate first as in rate monotonic scheduling.
+    * So a state can run several functions at different rates with a single timer.
+    * Task periods must be multiples of timer period, which is not derived from them : choose as initial period a common divisor of all task periods
+    * (e.g. their greatest common divisor for 10 ms and 25 ms tasks : 5 ms), and call the periodic function of the state at that base rate too.
     *
     */
     class AbstractPeriodicStateMachine : public AbstractStateMachine
@@ -120,17 +145,48 @@ namespace DwfStateMachine
         */
         using PeriodicFunctionMap = std::unordered_map<DwfState, PeriodicFunction, StateHasher>;
 
+        /*! @struct PeriodicTask
+        *  @brief Function called periodically at a sub-multiple of the state machine tick rate
+        */
+        struct PeriodicTask
+        {
+            std::string name; /*!< Name of the task.*/
+            uint64_t tick_divider; /*!< Number of base ticks between two calls of the task. Must not be 0.*/
+            PeriodicFunction function; /*!< Function called by the task.*/
+        };
+
+        /*! @typedef PeriodicTaskMap
+        *  @brief Map associating a state with associated periodic tasks
+        */
+        using PeriodicTaskMap = std::unordered_map<DwfState, std::vector<PeriodicTask>, StateHasher>;
+
         /*!
         * @brief Constructor of AbstractStateMachine class
         * @param initial_state : Initial State of the machine.
         * @param default_period : Defined default period of state machine.
         * @param max_element_nb : Max number of elements that can be stored in event queue. Default indicates no size limitation.
+        * @param timer_backend : Way periodic timer waits for its deadlines. Use TimerBackend::TIMERFD for control loops of 1 kHz and more on Linux.
         *
         * Constructor of the AbstractStateMachine class defining initial state, setting event processing and configuring periodic timer.
         *
         */
         template< class Rep, class Period >
-        AbstractPeriodicStateMachine(DwfState initial_state, const std::chrono::duration<Rep,Period>& initial_period, size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT);
+        AbstractPeriodicStateMachine(DwfState initial_state, const std::chrono::duration<Rep,Period>& initial_period, size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT,
+                                     DwfTime::TimerBackend timer_backend = DwfTime::TimerBackend::CONDITION_VARIABLE);
+
+        /*!
+        * @brief Constructor of AbstractStateMachine class
+        * @param initial_state : Initial State of the machine.
+        * @param default_period : Defined default period of state machine.
+        * @param event_queue : Queue used to store events.
+        * @param timer_backend : Way periodic timer waits for its deadlines. Use TimerBackend::TIMERFD for control loops of 1 kHz and more on Linux.
+        *
+        * Constructor of the AbstractStateMachine class defining initial state, selecting event queue implementation and configuring periodic timer.
+        *
+        */
+        template< class Rep, class Period >
+        AbstractPeriodicStateMachine(DwfState initial_state, const std::chrono::duration<Rep,Period>& initial_period, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue,
+                                     DwfTime::TimerBackend timer_backend = DwfTime::TimerBackend::CONDITION_VARIABLE);
 
         /*!
         * @brief Destructor of AbstractPeriodicStateMachine class
@@ -144,7 +200,9 @@ namespace DwfStateMachine
         * @brief Configure state machine and start event processing
         *
         * Create the state function map using setupStateFunctionMap.
+        * Sort periodic tasks of each state by increasing tick divider. Throws std::invalid_argument if a task has a tick divider of 0.
         * Create the transition map using method setupTransitionMap.
+        * Throws std::logic_error if states have timeouts while event queue only supports a single producer thread.
         * Start event processing.
         * Final virtual method
         *
@@ -152,6 +210,27 @@ namespace DwfStateMachine
         virtual void setupAndStart() final;
 
     protected:
+        /*!
+        * @brief Process internal events of the machine
+        * @param event : latest event extracted from event queue
+        * @return true if event is a timer tick, false otherwise
+        *
+        * Calls state function on timer ticks pushed in StateFunctionThread::EVENT_THREAD mode, if timer is still started.
+        * Final virtual method.
+        *
+        */
+        virtual bool processInternalEvent(std::unique_ptr<EventSystem::DwfEvent>& event) final;
+
+        /*!
+        * @brief Select thread periodic state functions are called from
+        * @param state_function_thread : thread calling periodic state functions. Default is StateFunctionThread::TIMER_THREAD.
+        *
+        * Can only be set while timer is stopped, for instance in daughter class constructor.
+        * Throws std::logic_error if StateFunctionThread::EVENT_THREAD is requested while event queue only supports a single producer thread.
+        *
+        */
+        void setStateFunctionThread(StateFunctionThread state_function_thread);
+
         /*!
         * @brief Fill the transition map
         *
@@ -163,11 +242,28 @@ namespace DwfStateMachine
         /*!
         * @brief Fill the state function map
         *
+        * Can fill periodic task map as well.
         * Purely Virtual method
         *
         */
         virtual void setupStateFunctionMap() = 0;
 
+        /*!
+        * @brief Add a periodic task to a state
+        * @param state : state the task is run in
+        * @param name : name of the task
+        * @param period : period of the task. Must be a multiple of timer period.
+        * @param function : function called by the task
+        *
+        * Inserts task in m_periodic_task_map, with a tick divider computed from current timer period.
+        * Throws std::invalid_argument if period is not a positive multiple of timer period.
+        * Timer period is not changed to fit task period : caller chooses it as base tick of all tasks, for instance their greatest common divisor.
+        * Tick dividers are kept when timer period changes, so that periods of tasks scale with it.
+        *
+        */
+        template< class Rep, class Period >
+        void addPeriodicTask(const DwfState& state, const std::string& name, const std::chrono::duration<Rep,Period>& period, PeriodicFunction function);
+
         /*!
         * @brief Dead end state reaching handler
         * @param e : exception generated when trying to find transition function associated to current state
@@ -180,6 +276,8 @@ namespace DwfStateMachine
         */
         virtual void onDeadEndState(const std::exception& e) = 0;
 
+        using AbstractStateMachine::onDeadEndState;
+
         /*!
         * @brief Start control timer
         *
@@ -196,7 +294,7 @@ namespace DwfStateMachine
         * @brief Set timer period and (re)start it
         * @param period : Defined new period of state machine.
         *
-        * Stop timer then change its period.
+        * Stop timer then change its period, i.e. base tick of periodic tasks.
         * Finally timer is (re)started.
         *
         */
@@ -216,28 +314,92 @@ namespace DwfStateMachine
 
         PeriodicFunctionMap m_periodic_function_maps; /*!< Map associating periodic computations with machine states.*/
 
+        PeriodicTaskMap m_periodic_task_map; /*!< Map associating periodic tasks run at sub-multiples of tick rate with machine states.*/
+
     private:
         /*!
         * @brief Call the function associated with current state
         *
         * Handler called on periodic timer timeout.
-        * If current state is associated with periodic function, run it. Otherwise do nothing.
+        * If current state is associated with periodic function, run it.
+        * Then run periodic tasks of current state if a multiple of their tick divider was reached since previous call, counting from first tick.
+        * So tasks whose tick was dropped in StateFunctionThread::EVENT_THREAD mode run on next tick.
         *
         */
         void callStateFunction();
 
+        /*!
+        * @brief Sort periodic tasks of each state by increasing tick divider
+        *
+        * Throws std::invalid_argument if a task has a tick divider of 0.
+        *
+        */
+        void sortPeriodicTasks();
+
+        /*!
+        * @brief Handle periodic timer timeout
+        *
+        * Calls state function in StateFunctionThread::TIMER_THREAD mode.
+        * Pushes a tick event otherwise, unless one is already queued. Never blocks, so that stopping timer from event processing thread cannot wait for a full queue.
+        *
+        */
+        void onTimerTick();
+
+        /*! @class TickEvent
+        * @brief Internal event pushed on timer timeout in StateFunctionThread::EVENT_THREAD mode
+        *
+        * Identified by its type. Its ID is the greatest EventID, so that coalescing queues do not mistake it for common events.
+        *
+        */
+        class TickEvent : public EventSystem::DwfEvent
+        {
+        public:
+            TickEvent() : EventSystem::DwfEvent(std::numeric_limits<EventSystem::EventID>::max())
+            {
+            }
+        };
+
         DwfTime::DwfTimer m_periodic_timer; /*!< Timer controlling execution of periodic computations.*/
+
+        std::atomic<StateFunctionThread> m_state_function_thread; /*!< Thread calling periodic state functions.*/
+
+        std::atomic<bool> m_tick_pending; /*!< Flag indicating a tick event is queued.*/
+
+        std::atomic<uint64_t> m_tick_nb; /*!< Number of timer timeouts since timer was last started.*/
+
+        std::atomic<uint64_t> m_called_tick_nb; /*!< Number of timer timeouts when state function was last called.*/
     };
 
     template< class Rep, class Period >
-    AbstractPeriodicStateMachine::AbstractPeriodicStateMachine(DwfState initial_state, const std::chrono::duration<Rep,Period>& initial_period, size_t max_element_nb) : AbstractStateMachine(initial_state, max_element_nb), m_periodic_timer()
+    AbstractPeriodicStateMachine::AbstractPeriodicStateMachine(DwfState initial_state, const std::chrono::duration<Rep,Period>& initial_period, size_t max_element_nb, DwfTime::TimerBackend timer_backend) : AbstractStateMachine(initial_state, max_element_nb), m_periodic_timer(timer_backend), m_state_function_thread(StateFunctionThread::TIMER_THREAD), m_tick_pending(false), m_tick_nb(0u), m_called_tick_nb(0u)
+    {
+        // Timer configuration
+        m_periodic_timer.setSingleShot(false);
+        m_periodic_timer.callOnTimeout([this](){onTimerTick();});
+        m_periodic_timer.setPeriod(initial_period);
+    }
+
+    template< class Rep, class Period >
+    AbstractPeriodicStateMachine::AbstractPeriodicStateMachine(DwfState initial_state, const std::chrono::duration<Rep,Period>& initial_period, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue, DwfTime::TimerBackend timer_backend) : AbstractStateMachine(initial_state, std::move(event_queue)), m_periodic_timer(timer_backend), m_state_function_thread(StateFunctionThread::TIMER_THREAD), m_tick_pending(false), m_tick_nb(0u), m_called_tick_nb(0u)
     {
         // Timer configuration
         m_periodic_timer.setSingleShot(false);
-        m_periodic_timer.callOnTimeout([this](){callStateFunction();});
+        m_periodic_timer.callOnTimeout([this](){onTimerTick();});
         m_periodic_timer.setPeriod(initial_period);
     }
 
+    template< class Rep, class Period >
+    void AbstractPeriodicStateMachine::addPeriodicTask(const DwfState& state, const std::string& name, const std::chrono::duration<Rep,Period>& period, PeriodicFunction function)
+    {
+        const std::chrono::microseconds task_period = std::chrono::duration_cast<std::chrono::microseconds>(period);
+        const std::chrono::microseconds tick_period = m_periodic_timer.period();
+        if(task_period.count() <= 0 || tick_period.count() <= 0 || task_period % tick_period != std::chrono::microseconds::zero())
+        {
+            throw std::invalid_argument("Period of periodic task " + name + " is not a multiple of state machine period");
+        }
+        m_periodic_task_map[state].push_back(PeriodicTask{name, static_cast<uint64_t>(task_period / tick_period), function});
+    }
+
     template< class Rep, class Period >
     void AbstractPeriodicStateMachine::changePeriodAndStart(const std::chrono::duration<Rep,Period>& period)
     {
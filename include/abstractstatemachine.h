@@ -77,8 +77,11 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "dwfstate.h"
 #include "abstracteventprocessor.h"
+#include "dwftimerservice.h"
 #include <unordered_map>
 #include <functional>
+#include <stdexcept>
+#include <chrono>
 
 /*!
 * @namespace DwfStateMachine
@@ -86,6 +89,23 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 */
 namespace DwfStateMachine
 {
+    /*! @enum DeadEndReason
+    *  @brief Reason why current state has been detected as a dead end state
+    */
+    enum class DeadEndReason : uint8_t
+    {
+        NO_TRANSITION_MAP /*!< Current state has no event/TransitionFunction map associated. Events of a state with an empty map are ignored, not reported.*/
+    };
+
+    /*! @struct StateTimeout
+    *  @brief Event to push if state machine stays in a state for a given duration
+    */
+    struct StateTimeout
+    {
+        std::chrono::microseconds duration; /*!< Duration spent in state before timeout.*/
+        EventSystem::EventID event_id; /*!< ID of the event pushed on timeout. Handled as any other event by the transition map of the state.*/
+    };
+
     /*! @class AbstractStateMachine
     * @brief Class representing event based state machine.
     *
@@ -99,9 +119,18 @@ namespace DwfStateMachine
     * - state_mach.setupAndStart();
     *
     * You must redefine the function setupTransitionMap() to construct the desired transition map during setupAndStart phase.
+    * Transition functions are called in place from the transition map, so the map must not be altered once event processing has started.
     *
     * You must redefine the function onDeadEndState() which defines the class behavior if a state has no associated transition
-    * (i.e. m_transition_map.at(state) throws an exception).
+    * (i.e. state has no entry in m_transition_map).
+    * Transitions are looked up without throwing any exception. Events without transition in current state are simply ignored, including all events of a state with an empty entry.
+    * Redefine onDeadEndState(DeadEndReason) to handle dead end states without building any exception object.
+    *
+    * States can have a timeout, declared in m_state_timeout_map alongside m_transition_map : "if no transition within 200 ms, push event X".
+    * Timeout is armed when machine enters state and cancelled when it leaves it, with a single persistent DwfTimerService task per machine.
+    * Cancelling only flags the task, so that re-arming it on every transition is cheap.
+    * Timeout event is pushed through the event queue and dropped if queue is full. Timeout events of a state left meanwhile are discarded.
+    * As timeout events are pushed from a DwfTimerService worker, state timeouts cannot be used with a single producer event queue such as DwfSpscQueue.
     *
     */
     class AbstractStateMachine : public EventSystem::AbstractEventProcessor
@@ -122,6 +151,11 @@ namespace DwfStateMachine
         */
         using TransitionMap = std::unordered_map<DwfState, EventTransitionMap, StateHasher>;
 
+        /*! @typedef StateTimeoutMap
+        *  @brief Map associating a state with its timeout
+        */
+        using StateTimeoutMap = std::unordered_map<DwfState, StateTimeout, StateHasher>;
+
         /*!
         * @brief Constructor of AbstractStateMachine class
         * @param initial_state : Initial State of the machine.
@@ -132,10 +166,20 @@ namespace DwfStateMachine
         */
         AbstractStateMachine(DwfState initial_state, size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT);
 
+        /*!
+        * @brief Constructor of AbstractStateMachine class
+        * @param initial_state : Initial State of the machine.
+        * @param event_queue : Queue used to store events.
+        *
+        * Constructor of the AbstractStateMachine class defining initial state, and selecting event queue implementation.
+        *
+        */
+        AbstractStateMachine(DwfState initial_state, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue);
+
         /*!
         * @brief Destructor of AbstractStateMachine class
         *
-        * Stop event processing before deleting events
+        * Stop event processing before deleting events and state timeout
         *
         */
         virtual ~AbstractStateMachine();
@@ -144,6 +188,8 @@ namespace DwfStateMachine
         * @brief Configure state machine and start event processing
         *
         * Create the transition map using method setupTransitionMap.
+        * Throws std::logic_error if states have timeouts while event queue only supports a single producer thread.
+        * Arm timeout of initial state, if any.
         * Start event processing.
         * Virtual method.
         *
@@ -157,11 +203,26 @@ namespace DwfStateMachine
         *
         * Selects a transition function to call depending on current state and event type.
         * Calls it with received event as argument.
+        * Lookup is performed by reference so that no transition is copied (and no memory allocated) when processing an event.
+        * Re-arms state timeout if transition changed current state.
+        * Events handled by processInternalEvent are not looked up.
         * Final virtual method.
         *
         */
         virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event) final;
 
+        /*!
+        * @brief Process internal events of the machine
+        * @param event : latest event extracted from event queue
+        * @return true if event was handled, false if it must be dispatched through transition map
+        *
+        * Called by processEvent before any transition lookup, for events daughter classes push to themselves.
+        * Default implementation returns false.
+        * Virtual method.
+        *
+        */
+        virtual bool processInternalEvent(std::unique_ptr<EventSystem::DwfEvent>& event);
+
         /*!
         * @brief Fill the transition map
         *
@@ -182,9 +243,68 @@ namespace DwfStateMachine
         */
         virtual void onDeadEndState(const std::exception& e) = 0;
 
+        /*!
+        * @brief Dead end state reaching handler, exception free version
+        * @param reason : reason why current state is a dead end state
+        *
+        * Called when processing an event while in a dead end state.
+        * Default implementation calls onDeadEndState(const std::exception&) with a std::out_of_range built once and never thrown.
+        * Redefine it to handle dead end states from a lightweight reason code.
+        * Virtual method
+        *
+        */
+        virtual void onDeadEndState(DeadEndReason reason);
+
+        /*!
+        * @brief Cancel pending state timeout and arm timeout of current state, if any
+        *
+        * Called on state changes. Call it from a transition function looping on current state to restart its timeout.
+        * Must only be called from event processing thread, or before event processing is started.
+        *
+        */
+        void restartStateTimeout();
+
+        /*!
+        * @brief Check state timeouts can be pushed to event queue
+        *
+        * Throws std::logic_error if states have timeouts while event queue only supports a single producer thread.
+        * Called by setupAndStart once transition map is filled.
+        *
+        */
+        void checkStateTimeoutQueue() const;
+
         DwfState m_current_state; /*!< Current state.*/
 
         TransitionMap m_transition_map; /*!< List of possible transition functions depending on current_state and events. Protected so that child class can setup map content easily.*/
+
+        StateTimeoutMap m_state_timeout_map; /*!< Timeout of states. Filled by setupTransitionMap alongside transition map and not altered once event processing has started.*/
+
+    private:
+        /*! @struct StateEntryStamp
+        *  @brief Payload of timeout events, identifying the state entry they were armed for
+        */
+        struct StateEntryStamp
+        {
+            uint64_t entry_nb; /*!< Value of m_state_entry_nb when timeout was armed.*/
+        };
+
+        DwfTime::DwfTimerService* m_timer_service; /*!< Service waiting for state timeouts. nullptr until a timeout is first armed, so that machines without timeouts never start the shared service.*/
+
+        DwfTime::DwfTimerService::TaskID m_timeout_task; /*!< Task pushing timeout events. Created when a timeout is first armed.*/
+
+        bool m_timeout_armed; /*!< Flag indicating timeout task was armed since last state change. Only used by event processing thread.*/
+
+        EventSystem::EventID m_timeout_event_id; /*!< ID of the event pushed on timeout. Only changed while timeout task is disarmed.*/
+
+        uint64_t m_state_entry_nb; /*!< Incremented each time timeout is re-armed. Only changed while timeout task is disarmed.*/
+
+        /*!
+        * @brief Push timeout event of current state
+        *
+        * Function of timeout task, called by a DwfTimerService worker.
+        *
+        */
+        void onStateTimeout();
     };
 }
 #endif // DWF_STATE_MACHINE_H
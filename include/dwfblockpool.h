@@ -0,0 +1,166 @@
+/*!
+ * @file dwfblockpool.h
+ * @brief Definition of the pool recycling storage of small objects.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Definition of a thread safe pool of fixed size blocks used by DwfEvent and DwfMpscQueue node allocation functions.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_BLOCK_POOL_H
+#define DWF_BLOCK_POOL_H
+
+#include <cstddef>
+
+/*!
+* @namespace DwfContainers
+* @brief A namespace used to regroup all elements related to data containers
+*/
+namespace DwfContainers
+{
+    /*! @class DwfBlockPool
+    * @brief Thread safe pool recycling storage of small objects
+    *
+    * Storage is split in blocks of C_BLOCK_SIZE bytes. Each thread keeps a cache of free blocks so that allocating and freeing objects takes no lock most of the time.
+    * Free blocks move between threads by batches of C_BATCH_SIZE blocks under a global lock, so that objects allocated by producers and freed by a consumer thread keep being recycled.
+    * Blocks are aligned on std::max_align_t.
+    * Larger requests are forwarded to global operator new and delete.
+    * Pool never shrinks : storage is never given back to the system, so pool size is the peak number of blocks in use, rounded up to whole chunks.
+    * Blocks cached by exiting threads or freed during their exit are gathered into full batches for other threads.
+    * Static class.
+    *
+    */
+    class DwfBlockPool
+    {
+    public:
+        static const size_t C_BLOCK_SIZE; /*!< Size of the blocks of the pool. Largest request served by the pool.*/
+
+        static const size_t C_BATCH_SIZE; /*!< Number of blocks exchanged at once between thread caches and the global free list.*/
+
+        /*!
+        * @brief Allocate storage for an object
+        * @param size : Size of the object
+        * @return Pointer to storage of at least size bytes
+        *
+        * Static method
+        * Throws std::bad_alloc if storage cannot be obtained from the system.
+        *
+        */
+        static void* allocate(size_t size);
+
+        /*!
+        * @brief Give storage of an object back
+        * @param object : Pointer returned by allocate
+        * @param size : Size given to allocate
+        *
+        * Static method
+        *
+        */
+        static void deallocate(void* object, size_t size);
+
+        /*!
+        * @brief Indicates number of chunks of C_BATCH_SIZE blocks obtained from the system since program start
+        * @return Number of chunks
+        *
+        * Static method
+        *
+        */
+        static size_t chunkNb();
+
+        /*!
+        * @brief Indicates number of full batches of free blocks waiting to be taken by a thread
+        * @return Number of batches
+        *
+        * Static method
+        *
+        */
+        static size_t sharedBatchNb();
+    };
+}
+
+#endif //DWF_BLOCK_POOL_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,423 @@
+/*!
+ * @file dwfcoalescingqueue.tpp
+ * @brief Class defining a thread safe queue replacing queued elements with the same key.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class defining a thread safe size-limited queue storing at most one element per key.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfcoalescingqueue.h"
+#include <stdexcept>
+#include <unordered_set>
+
+namespace DwfContainers
+{
+    template<class T, class Key, class KeyOf>
+    const size_t DwfCoalescingQueue<T, Key, KeyOf>::C_NO_SIZE_LIMIT=0;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     Constructors and Destructor                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    DwfCoalescingQueue<T, Key, KeyOf>::DwfCoalescingQueue(size_t max_element_nb) : m_head_sequence(0u), m_max_element_nb(max_element_nb), m_key_of(), m_coalesced_nb(0u),
+        m_waiting_producer_nb(0u), m_wait_disabled(false)
+    {
+    }
+
+    template<class T, class Key, class KeyOf>
+    DwfCoalescingQueue<T, Key, KeyOf>::~DwfCoalescingQueue()
+    {
+        disableWait();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            Size Getters                            ///
+    ///                                                                    ///
+    /////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    bool DwfCoalescingQueue<T, Key, KeyOf>::empty() const
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return m_queue.empty();
+    }
+
+    template<class T, class Key, class KeyOf>
+    size_t DwfCoalescingQueue<T, Key, KeyOf>::size() const
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return m_queue.size();
+    }
+
+    template<class T, class Key, class KeyOf>
+    bool DwfCoalescingQueue<T, Key, KeyOf>::full() const
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return !hasRoom(1u);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         Overflow statistics                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    uint64_t DwfCoalescingQueue<T, Key, KeyOf>::droppedElementNb() const
+    {
+        return 0u;
+    }
+
+    template<class T, class Key, class KeyOf>
+    uint64_t DwfCoalescingQueue<T, Key, KeyOf>::coalescedElementNb() const
+    {
+        return m_coalesced_nb;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          Wait management                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::disableWait()
+    {
+        {
+            std::unique_lock<std::mutex> datalock(m_data_mutex); // Ensures no waiting thread misses the flag between its check and its wait
+            m_wait_disabled=true;
+        }
+        m_control_content.notify_all(); // For all threads to exit waiting state
+        m_control_space.notify_all();
+    }
+
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::enableWait()
+    {
+        m_wait_disabled=false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               Clear                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::clear()
+    {
+        std::deque<T> empty;
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        std::swap( m_queue, empty );
+        m_positions.clear();
+        notifyRoom(datalock);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Push                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::push(const T& element)
+    {
+        if(tryPush(element) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::push(T&& element)
+    {
+        if(tryPush(std::move(element)) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::pushBatch(std::vector<T>& elements)
+    {
+        if(elements.empty())
+        {
+            return;
+        }
+        std::unordered_set<Key> new_keys; // Keys needing room, counted once even if present several times in batch
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        for(const T& element : elements)
+        {
+            const Key key = m_key_of(element);
+            if(m_positions.find(key) == m_positions.end())
+            {
+                new_keys.insert(key);
+            }
+        }
+        if(!hasRoom(new_keys.size()))
+        {
+            throw std::runtime_error("Queue is full. Cannot add elements");
+        }
+        for(T& element : elements)
+        {
+            const Key key = m_key_of(element);
+            if(!coalesce(key, std::move(element)))
+            {
+                append(key, std::move(element));
+            }
+        }
+        datalock.unlock();
+        elements.clear();
+        m_control_content.notify_one();
+    }
+
+    template<class T, class Key, class KeyOf>
+    PushStatus DwfCoalescingQueue<T, Key, KeyOf>::tryPush(const T& element)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return pushElement(element, datalock, std::chrono::nanoseconds::zero());
+    }
+
+    template<class T, class Key, class KeyOf>
+    PushStatus DwfCoalescingQueue<T, Key, KeyOf>::tryPush(T&& element)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return pushElement(std::move(element), datalock, std::chrono::nanoseconds::zero());
+    }
+
+    template<class T, class Key, class KeyOf>
+    template<class Rep, class Period>
+    PushStatus DwfCoalescingQueue<T, Key, KeyOf>::pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        const PushStatus status = pushElement(element, datalock, timeout);
+        return status == PushStatus::FULL ? PushStatus::TIMEOUT : status; // Null timeouts report expiry like other ones
+    }
+
+    template<class T, class Key, class KeyOf>
+    template<class Rep, class Period>
+    PushStatus DwfCoalescingQueue<T, Key, KeyOf>::pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        const PushStatus status = pushElement(std::move(element), datalock, timeout);
+        return status == PushStatus::FULL ? PushStatus::TIMEOUT : status; // Null timeouts report expiry like other ones
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Pop                                 ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::pop(T& element)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            m_control_content.wait(datalock, [this](){return !m_queue.empty() || m_wait_disabled;}); // Only exit wait if queue is not empty or if deletion has been requested
+            if(! m_wait_disabled) // Only try to get element if we are allowed to wait for elements
+            {
+                takeFront(element);
+                notifyRoom(datalock);
+            }
+        }
+    }
+
+    template<class T, class Key, class KeyOf>
+    size_t DwfCoalescingQueue<T, Key, KeyOf>::popUpTo(size_t max_element_nb, std::vector<T>& elements)
+    {
+        size_t popped_nb = 0u;
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            m_control_content.wait(datalock, [this](){return !m_queue.empty() || m_wait_disabled;}); // Only exit wait if queue is not empty or if deletion has been requested
+            if(! m_wait_disabled) // Only try to get elements if we are allowed to wait for elements
+            {
+                while(!m_queue.empty() && (max_element_nb == C_NO_SIZE_LIMIT || popped_nb < max_element_nb))
+                {
+                    elements.emplace_back();
+                    takeFront(elements.back());
+                    ++popped_nb;
+                }
+                notifyRoom(datalock);
+            }
+        }
+        return popped_nb;
+    }
+
+    template<class T, class Key, class KeyOf>
+    size_t DwfCoalescingQueue<T, Key, KeyOf>::popAll(std::vector<T>& elements)
+    {
+        return popUpTo(C_NO_SIZE_LIMIT, elements);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         Container management                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T, class Key, class KeyOf>
+    bool DwfCoalescingQueue<T, Key, KeyOf>::hasRoom(size_t element_nb) const
+    {
+        return m_max_element_nb == C_NO_SIZE_LIMIT || m_queue.size() + element_nb <= m_max_element_nb;
+    }
+
+    template<class T, class Key, class KeyOf>
+    template<class U>
+    bool DwfCoalescingQueue<T, Key, KeyOf>::coalesce(const Key& key, U&& element)
+    {
+        typename std::unordered_map<Key, uint64_t>::const_iterator position = m_positions.find(key);
+        if(position == m_positions.end())
+        {
+            return false;
+        }
+        m_queue[position->second - m_head_sequence] = std::forward<U>(element);
+        ++m_coalesced_nb;
+        return true;
+    }
+
+    template<class T, class Key, class KeyOf>
+    template<class U>
+    void DwfCoalescingQueue<T, Key, KeyOf>::append(const Key& key, U&& element)
+    {
+        m_queue.push_back(std::forward<U>(element));
+        m_positions.emplace(key, m_head_sequence + m_queue.size() - 1u);
+    }
+
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::takeFront(T& element)
+    {
+        m_positions.erase(m_key_of(m_queue.front())); // Later pushes of this key are appended again
+        element = std::move(m_queue.front());
+        m_queue.pop_front();
+        ++m_head_sequence;
+    }
+
+    template<class T, class Key, class KeyOf>
+    template<class U, class Rep, class Period>
+    PushStatus DwfCoalescingQueue<T, Key, KeyOf>::pushElement(U&& element, std::unique_lock<std::mutex>& datalock, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        const Key key = m_key_of(element);
+        if(coalesce(key, std::forward<U>(element))) // Consumer is not waiting as queue is not empty
+        {
+            return PushStatus::PUSHED;
+        }
+        if(!hasRoom(1u))
+        {
+            if(timeout <= std::chrono::duration<Rep, Period>::zero())
+            {
+                return PushStatus::FULL;
+            }
+            ++m_waiting_producer_nb;
+            const bool has_room = m_control_space.wait_for(datalock, timeout, [this](){return hasRoom(1u) || m_wait_disabled;}); // Only exit wait if element fits, if wait has been disabled or on timeout
+            --m_waiting_producer_nb;
+            if(!has_room || m_wait_disabled)
+            {
+                return PushStatus::TIMEOUT;
+            }
+            if(coalesce(key, std::forward<U>(element))) // Key may have been pushed while waiting
+            {
+                return PushStatus::PUSHED;
+            }
+        }
+        append(key, std::forward<U>(element));
+        datalock.unlock();
+        m_control_content.notify_one();
+        return PushStatus::PUSHED;
+    }
+
+    template<class T, class Key, class KeyOf>
+    void DwfCoalescingQueue<T, Key, KeyOf>::notifyRoom(std::unique_lock<std::mutex>& datalock)
+    {
+        const bool producer_waiting = m_waiting_producer_nb > 0u;
+        datalock.unlock();
+        if(producer_waiting) // Avoid notification cost when queue is not blocking anyone
+        {
+            m_control_space.notify_all();
+        }
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
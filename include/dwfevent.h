@@ -75,7 +75,10 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #define DWF_EVENT_H
 
 #include <stdint.h>
+#include <cstddef>
+#include <memory>
 #include "identifiedelement.h"
+#include "dwfeventpool.h"
 
 /*!
 * @namespace EventSystem
@@ -88,15 +91,79 @@ namespace EventSystem
     */
     typedef uint32_t EventID; // Definition of type used to identify events
 
-    /*! @typedef DwfEvent
-    *  @brief Event is an identified element with EventID as id type
+    /*! @class DwfEvent
+    * @brief Event is an identified element with EventID as id type
+    *
+    * Inherits from IdentifiedElement<EventID>.
+    * Destructor is virtual so that derived events carrying data can be deleted through std::unique_ptr<DwfEvent>.
+    * DwfPayloadEvent carries data of any type without deriving a class.
+    * Storage of events, derived events included, is recycled by DwfEventPool.
+    *
     */
-    using DwfEvent = DwfCommon::IdentifiedElement<EventID>;
+    class DwfEvent : public DwfCommon::IdentifiedElement<EventID>
+    {
+    public:
+        /*!
+        * @brief Constructor of the DwfEvent class
+        * @param id : Value of the event id.
+        *
+        */
+        DwfEvent(EventID id) : DwfCommon::IdentifiedElement<EventID>(id)
+        {
+        }
+
+        /*!
+        * @brief Destructor of the DwfEvent class
+        *
+        * Virtual method
+        *
+        */
+        virtual ~DwfEvent()
+        {
+        }
+
+        /*!
+        * @brief Allocate storage of an event from DwfEventPool
+        * @param size : Size of the event, derived event included
+        * @return Pointer to event storage
+        *
+        * Static method
+        *
+        */
+        static void* operator new(std::size_t size)
+        {
+            return DwfEventPool::allocate(size);
+        }
+
+        /*!
+        * @brief Give storage of an event back to DwfEventPool
+        * @param event : Pointer to event storage
+        * @param size : Size of the event, derived event included
+        *
+        * Static method
+        *
+        */
+        static void operator delete(void* event, std::size_t size)
+        {
+            DwfEventPool::deallocate(event, size);
+        }
+    };
 
     /*! @typedef EventHasher
     *  @brief Hasher of a DwfEvent (performs hash on an EventID)
     */
     using EventHasher = DwfCommon::ElementHasher<EventID>;
+
+    /*! @struct EventIdOf
+    *  @brief Functor returning EventID of a queued event. Key of event coalescing queues.
+    */
+    struct EventIdOf
+    {
+        EventID operator()(const std::unique_ptr<DwfEvent>& event) const
+        {
+            return event->getId();
+        }
+    };
 }
 #endif // DWF_EVENT_H
 
@@ -0,0 +1,483 @@
+/*!
+ * @file dwfmpscqueue.h
+ * @brief Class defining a lock-free multiple producers single consumer queue.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class defining a lock-free linked queue for any number of producer threads and one consumer thread.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_MPSC_QUEUE_H
+#define DWF_MPSC_QUEUE_H
+
+#include <vector>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include "pushstatus.h"
+#include "dwfblockpool.h"
+#include <type_traits>
+#include <cstddef>
+#include <new>
+
+/*!
+* @namespace DwfContainers
+* @brief A namespace used to regroup all elements related to data containers
+*/
+namespace DwfContainers
+{
+    /*! @class DwfMpscQueue
+    * @brief Class a lock-free size-limited multiple producers single consumer queue
+    * @tparam T : type of elements stored in queue
+    *
+    * Queue size limitation (if any) is defined at queue creation and cannot be changed afterwards.
+    * Any number of threads may push concurrently but only one thread may pop at a given time.
+    * Producers append nodes with a single atomic exchange on the queue tail, so they never wait for each other or for the consumer.
+    * Nodes are recycled through the thread caches of DwfBlockPool, so that producers do not contend on the global allocator either.
+    * A mutex and a condition variable are only used to park the consumer when queue is empty,
+    * and producers only signal when the consumer is actually parked.
+    *
+    */
+    template<class T>
+    class DwfMpscQueue
+    {
+    public:
+        static const size_t C_NO_SIZE_LIMIT; /*!< Definition of a specific value to indicate queue has no size limitation.*/
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                     Constructors and Destructor                    ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Constructor of DwfMpscQueue class
+        * @param max_element_nb : Max number of elements that can be stored in queue. Default indicates no size limitation.
+        *
+        * Constructor of the DwfMpscQueue class setting queue size limitation.
+        *
+        */
+        DwfMpscQueue(size_t max_element_nb = C_NO_SIZE_LIMIT);
+
+        /*!
+        * @brief Destructor of DwfMpscQueue class
+        *
+        * Disables wait, ensuring waiting thread is freed, and deletes remaining elements.
+        *
+        */
+        ~DwfMpscQueue();
+
+        DwfMpscQueue(const DwfMpscQueue&) = delete;
+        DwfMpscQueue& operator=(const DwfMpscQueue&) = delete;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                            Size Getters                            ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Indicated whether queue is empty
+        * @return true if queue is empty, false otherwise
+        *
+        * Const method
+        * Result is a snapshot which may be outdated if other threads are running.
+        *
+        */
+        bool empty() const;
+
+        /*!
+        * @brief Indicates number of elements stored in queue
+        * @return Number of elements in queue
+        *
+        * Const method
+        * Result is a snapshot which may be outdated if other threads are running.
+        *
+        */
+        size_t size() const;
+
+        /*!
+        * @brief Indicates if queue has reached its size limitation
+        * @return true queue is full, false otherwise
+        *
+        * Const method
+        * If the queue is not size limited, this method always returns false
+        *
+        */
+        bool full() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                         Overflow statistics                        ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Indicates number of elements dropped by overflow policy since queue creation
+        * @return Always 0, as push on a full queue throws an exception
+        *
+        * Const method
+        *
+        */
+        uint64_t droppedElementNb() const;
+
+        /*!
+        * @brief Indicates number of elements coalesced by overflow policy since queue creation
+        * @return Always 0, as push on a full queue throws an exception
+        *
+        * Const method
+        *
+        */
+        uint64_t coalescedElementNb() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                          Wait management                           ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Disable wait of elements in queue
+        *
+        * Disable wait for queue to contain element in pop method.
+        * Also unlocks waiting thread.
+        * Especially used during queue desctruction
+        *
+        */
+        void disableWait();
+
+        /*!
+        * @brief Enable wait for elements in queue
+        *
+        */
+        void enableWait();
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                               Clear                                ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Delete all elements in queue
+        *
+        * Consumes elements, so it must be called from the consumer thread or while no pop is running.
+        *
+        */
+        void clear();
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                                Push                                ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Push an element by copy
+        * @param element : Reference to the element to push to queue
+        *
+        * Push an element if queue is not full and wake up the consumer if it is waiting.
+        * If queue is full, throws an exception.
+        *
+        */
+        void push(const T& element);
+
+        /*!
+        * @brief Push an element using move semantics
+        * @param element : Reference to the element to push to queue
+        *
+        * Push an element if queue is not full and wake up the consumer if it is waiting.
+        * If queue is full, throws an exception. And element is not moved.
+        *
+        */
+        void push(T&& element);
+
+        /*!
+        * @brief Push several elements at once using move semantics
+        * @param elements : Elements to push to queue, in order. Cleared once elements are moved to queue.
+        *
+        * Push all elements with a single atomic exchange on queue tail and wake up the consumer once.
+        * If queue cannot store all elements, throws an exception. And no element is moved.
+        * Nodes are all allocated before any element is moved, so that a failed allocation leaves elements and queue room untouched.
+        *
+        */
+        void pushBatch(std::vector<T>& elements);
+
+        /*!
+        * @brief Try to push an element by copy
+        * @param element : Reference to the element to push to queue
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full
+        *
+        * Same as push, without exception when queue is full.
+        * If node allocation or element copy throws, reserved room is given back and exception is forwarded.
+        *
+        */
+        PushStatus tryPush(const T& element);
+
+        /*!
+        * @brief Try to push an element using move semantics
+        * @param element : Reference to the element to push to queue
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full. And element is not moved.
+        *
+        * Same as push, without exception when queue is full.
+        * If node allocation or element move throws, reserved room is given back and exception is forwarded.
+        *
+        */
+        PushStatus tryPush(T&& element);
+
+        /*!
+        * @brief Push an element by copy, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled
+        *
+        * Consumer does not signal freed room so that pop stays lock-free. Producer polls queue, yielding then sleeping between attempts.
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout);
+
+        /*!
+        * @brief Push an element using move semantics, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled. And element is not moved.
+        *
+        * Consumer does not signal freed room so that pop stays lock-free. Producer polls queue, yielding then sleeping between attempts.
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout);
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                                Pop                                 ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Pop an element by copy
+        * @param element : Reference to the element to copy queue head to
+        *
+        * Wait for an element to be available in queue then copy it to argument and remove it from queue.
+        * Calling to pop locks current thread until an element has been pushed to queue.
+        *
+        */
+        void pop(T& element);
+
+        /*!
+        * @brief Pop several elements at once
+        * @param max_element_nb : Maximum number of elements to pop. 0 indicates all available elements.
+        * @param elements : Vector popped elements are appended to, in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move up to max_element_nb elements to argument.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popUpTo(size_t max_element_nb, std::vector<T>& elements);
+
+        /*!
+        * @brief Pop all available elements at once
+        * @param elements : Vector popped elements are appended to, in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move all available elements to argument.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popAll(std::vector<T>& elements);
+
+    private:
+        /*! @struct Node
+        * @brief Queue node
+        *
+        * The node at queue head is a stub whose value has already been popped or was never constructed.
+        * Allocated from DwfBlockPool. Nodes larger than a pool block or over-aligned are allocated with global operator new.
+        *
+        */
+        struct Node
+        {
+            std::atomic<Node*> next; /*!< Next node in push order.*/
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type value; /*!< Element storage.*/
+
+            Node() : next(nullptr)
+            {
+            }
+
+            T* element()
+            {
+                return reinterpret_cast<T*>(&value);
+            }
+
+            static void* operator new(std::size_t size)
+            {
+                if(alignof(Node) > alignof(std::max_align_t)) // Pool blocks are only aligned on std::max_align_t
+                {
+                    return ::operator new(size);
+                }
+                return DwfBlockPool::allocate(size);
+            }
+
+            static void operator delete(void* node, std::size_t size)
+            {
+                if(alignof(Node) > alignof(std::max_align_t))
+                {
+                    ::operator delete(node);
+                    return;
+                }
+                DwfBlockPool::deallocate(node, size);
+            }
+        };
+
+        /*!
+        * @brief Reserve room for elements
+        * @param element_nb : Number of elements to reserve room for
+        * @return true if room was reserved, false if queue cannot store element_nb more elements
+        *
+        */
+        bool reserve(size_t element_nb);
+
+        /*!
+        * @brief Link a chain of nodes at queue tail and wake up consumer if needed
+        * @param first : First node of the chain
+        * @param last : Last node of the chain
+        *
+        */
+        void publish(Node* first, Node* last);
+
+        /*!
+        * @brief Reserve room for an element, store it in a new node and link node at queue tail
+        * @param element : Element to push, forwarded to element constructor
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full. And element is not moved.
+        *
+        * Gives reserved room back if node allocation or element construction throws.
+        *
+        */
+        template<class U>
+        PushStatus pushOne(U&& element);
+
+        /*!
+        * @brief Take front element if any
+        * @param element : Reference to the element to move queue head to
+        * @return true if an element was taken, false if queue is empty
+        *
+        */
+        bool tryTake(T& element);
+
+        /*!
+        * @brief Park consumer until queue is not empty or wait is disabled
+        *
+        */
+        void waitContent();
+
+        const size_t m_max_element_nb; /*!< Maximum size of the queue.*/
+
+        Node* m_head; /*!< Stub node preceding next element to pop. Accessed by consumer only.*/
+        char m_consumer_padding[64]; /*!< Padding keeping consumer data away from producers data.*/
+
+        std::atomic<Node*> m_tail; /*!< Last pushed node. Exchanged by producers.*/
+        std::atomic<size_t> m_size; /*!< Number of elements in queue, reserved before node is linked.*/
+        char m_producer_padding[64]; /*!< Padding keeping producers data away from wait control data.*/
+
+        std::mutex m_wait_mutex; /*!< Mutex used to park consumer.*/
+        std::condition_variable m_control_content; /*!< Condition variable used to wait for data in the queue.*/
+        std::atomic<bool> m_consumer_waiting; /*!< Flag indicating that consumer is parked or about to be, so producers must notify it.*/
+
+        std::atomic<bool> m_wait_disabled; /*!< Flag indicating that waiting for elements is disabled (ex: when queue is deleted). Waiting thread must be notified and no thread can wait any longer. */
+
+        /*!
+        * @brief Poll queue until element is pushed, timeout expires or wait is disabled
+        * @param element : Element to push, forwarded to tryPush. Only moved once pushed.
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT otherwise
+        *
+        */
+        template<class U, class Rep, class Period>
+        PushStatus pollPush(U&& element, const std::chrono::duration<Rep, Period>& timeout);
+    };
+}
+
+#include "dwfmpscqueue.tpp"
+
+#endif //DWF_MPSC_QUEUE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
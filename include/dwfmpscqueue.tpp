@@ -0,0 +1,468 @@
+/*!
+ * @file dwfmpscqueue.tpp
+ * @brief Class defining a lock-free multiple producers single consumer queue.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class defining a lock-free linked queue for any number of producer threads and one consumer thread.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfmpscqueue.h"
+#include <stdexcept>
+#include <new>
+#include <thread>
+#include <algorithm>
+
+namespace DwfContainers
+{
+    template<class T>
+    const size_t DwfMpscQueue<T>::C_NO_SIZE_LIMIT=0;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     Constructors and Destructor                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    DwfMpscQueue<T>::DwfMpscQueue(size_t max_element_nb) : m_max_element_nb(max_element_nb), m_head(new Node()), m_tail(m_head), m_size(0u),
+        m_consumer_waiting(false), m_wait_disabled(false)
+    {
+    }
+
+    template<class T>
+    DwfMpscQueue<T>::~DwfMpscQueue()
+    {
+        disableWait();
+        clear();
+        delete m_head;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            Size Getters                            ///
+    ///                                                                    ///
+    /////////////////////////////////////////////////////////////////////////
+    template<class T>
+    bool DwfMpscQueue<T>::empty() const
+    {
+        return size() == 0u;
+    }
+
+    template<class T>
+    size_t DwfMpscQueue<T>::size() const
+    {
+        return m_size.load(std::memory_order_acquire);
+    }
+
+    template<class T>
+    bool DwfMpscQueue<T>::full() const
+    {
+        if(m_max_element_nb == C_NO_SIZE_LIMIT) // Can't be full if no size limit
+        {
+            return false;
+        }
+        else // Otherwise check if we have reached max element number
+        {
+            return size() >= m_max_element_nb;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         Overflow statistics                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    uint64_t DwfMpscQueue<T>::droppedElementNb() const
+    {
+        return 0u;
+    }
+
+    template<class T>
+    uint64_t DwfMpscQueue<T>::coalescedElementNb() const
+    {
+        return 0u;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          Wait management                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfMpscQueue<T>::disableWait()
+    {
+        m_wait_disabled=true;
+        std::lock_guard<std::mutex> waitlock(m_wait_mutex); // Consumer is either not waiting yet or already waiting when we notify
+        m_control_content.notify_all(); // For waiting thread to exit waiting state
+    }
+
+    template<class T>
+    void DwfMpscQueue<T>::enableWait()
+    {
+        m_wait_disabled=false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               Clear                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfMpscQueue<T>::clear()
+    {
+        Node* next = m_head->next.load(std::memory_order_acquire);
+        while(next != nullptr)
+        {
+            next->element()->~T();
+            delete m_head;
+            m_head = next; // Next becomes the stub
+            m_size.fetch_sub(1u, std::memory_order_release);
+            next = m_head->next.load(std::memory_order_acquire);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Push                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfMpscQueue<T>::push(const T& element)
+    {
+        if(tryPush(element) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T>
+    void DwfMpscQueue<T>::push(T&& element)
+    {
+        if(tryPush(std::move(element)) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T>
+    PushStatus DwfMpscQueue<T>::tryPush(const T& element)
+    {
+        return pushOne(element);
+    }
+
+    template<class T>
+    PushStatus DwfMpscQueue<T>::tryPush(T&& element)
+    {
+        return pushOne(std::move(element));
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfMpscQueue<T>::pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return pollPush(element, timeout);
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfMpscQueue<T>::pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return pollPush(std::move(element), timeout);
+    }
+
+    template<class T>
+    void DwfMpscQueue<T>::pushBatch(std::vector<T>& elements)
+    {
+        if(elements.empty())
+        {
+            return;
+        }
+        if(!reserve(elements.size()))
+        {
+            throw std::runtime_error("Queue is full. Cannot add elements");
+        }
+
+        // Chain nodes privately before moving any element, so that a failed allocation leaves elements untouched
+        Node* first = nullptr;
+        Node* last = nullptr;
+        try
+        {
+            first = new Node();
+            last = first;
+            for(size_t i = 1u; i < elements.size(); ++i)
+            {
+                Node* node = new Node();
+                last->next.store(node, std::memory_order_relaxed);
+                last = node;
+            }
+        }
+        catch(...)
+        {
+            while(first != nullptr)
+            {
+                Node* next = first->next.load(std::memory_order_relaxed);
+                delete first;
+                first = next;
+            }
+            m_size.fetch_sub(elements.size(), std::memory_order_relaxed); // Give back reservation
+            throw;
+        }
+        Node* node = first;
+        for(T& element : elements)
+        {
+            new (node->element()) T(std::move(element));
+            node = node->next.load(std::memory_order_relaxed);
+        }
+
+        // Then link the whole chain at once
+        publish(first, last);
+        elements.clear();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Pop                                 ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfMpscQueue<T>::pop(T& element)
+    {
+        while(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            if(tryTake(element))
+            {
+                return;
+            }
+            waitContent();
+        }
+    }
+
+    template<class T>
+    size_t DwfMpscQueue<T>::popUpTo(size_t max_element_nb, std::vector<T>& elements)
+    {
+        while(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            size_t popped_nb = 0u;
+            Node* next = m_head->next.load(std::memory_order_acquire);
+            while(next != nullptr && (max_element_nb == C_NO_SIZE_LIMIT || popped_nb < max_element_nb))
+            {
+                elements.push_back(std::move(*next->element()));
+                next->element()->~T();
+                delete m_head;
+                m_head = next; // Next becomes the stub
+                ++popped_nb;
+                next = m_head->next.load(std::memory_order_acquire);
+            }
+            if(popped_nb > 0u)
+            {
+                m_size.fetch_sub(popped_nb, std::memory_order_release);
+                return popped_nb;
+            }
+            waitContent();
+        }
+        return 0u;
+    }
+
+    template<class T>
+    size_t DwfMpscQueue<T>::popAll(std::vector<T>& elements)
+    {
+        return popUpTo(C_NO_SIZE_LIMIT, elements);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              Internals                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    bool DwfMpscQueue<T>::reserve(size_t element_nb)
+    {
+        if(m_max_element_nb == C_NO_SIZE_LIMIT)
+        {
+            m_size.fetch_add(element_nb, std::memory_order_relaxed);
+        }
+        else if(m_size.fetch_add(element_nb, std::memory_order_relaxed) + element_nb > m_max_element_nb)
+        {
+            m_size.fetch_sub(element_nb, std::memory_order_relaxed); // Give back reservation
+            return false;
+        }
+        return true;
+    }
+
+    template<class T>
+    void DwfMpscQueue<T>::publish(Node* first, Node* last)
+    {
+        Node* previous = m_tail.exchange(last, std::memory_order_acq_rel); // Serialization point between producers
+        previous->next.store(first); // Sequentially consistent with consumer waiting flag
+        if(m_consumer_waiting.load())
+        {
+            std::lock_guard<std::mutex> waitlock(m_wait_mutex); // Consumer is either checking queue content or waiting when we notify
+            m_control_content.notify_one();
+        }
+    }
+
+    template<class T>
+    template<class U>
+    PushStatus DwfMpscQueue<T>::pushOne(U&& element)
+    {
+        if(!reserve(1u))
+        {
+            return PushStatus::FULL;
+        }
+        Node* node = nullptr;
+        try
+        {
+            node = new Node();
+            new (node->element()) T(std::forward<U>(element));
+        }
+        catch(...)
+        {
+            delete node; // Element was not constructed. nullptr if allocation failed
+            m_size.fetch_sub(1u, std::memory_order_relaxed); // Give back reservation
+            throw;
+        }
+        publish(node, node);
+        return PushStatus::PUSHED;
+    }
+
+    template<class T>
+    void DwfMpscQueue<T>::waitContent()
+    {
+        // Queue is empty, park until a producer links an element or wait is disabled
+        std::unique_lock<std::mutex> waitlock(m_wait_mutex);
+        m_consumer_waiting.store(true); // Sequentially consistent with node linking so either producer sees us waiting or we see its element
+        m_control_content.wait(waitlock, [this](){return m_head->next.load() != nullptr || m_wait_disabled;}); // Only exit wait if queue is not empty or if deletion has been requested
+        m_consumer_waiting.store(false, std::memory_order_relaxed);
+    }
+
+    template<class T>
+    bool DwfMpscQueue<T>::tryTake(T& element)
+    {
+        Node* next = m_head->next.load(std::memory_order_acquire);
+        if(next == nullptr) // Empty, or a producer has not linked its node yet and will notify once done
+        {
+            return false;
+        }
+        element = std::move(*next->element());
+        next->element()->~T();
+        delete m_head;
+        m_head = next; // Next becomes the stub
+        m_size.fetch_sub(1u, std::memory_order_release);
+        return true;
+    }
+
+    template<class T>
+    template<class U, class Rep, class Period>
+    PushStatus DwfMpscQueue<T>::pollPush(U&& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        static const uint32_t C_YIELD_NB = 64u; // Attempts separated by a yield before sleeping between attempts
+        static const std::chrono::microseconds C_MAX_SLEEP(50); // Bounds latency added once room is freed
+
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        uint32_t attempt_nb = 0u;
+        while(tryPush(std::forward<U>(element)) == PushStatus::FULL) // Element is only moved once pushed
+        {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if(m_wait_disabled || now >= deadline)
+            {
+                return PushStatus::TIMEOUT;
+            }
+            if(attempt_nb < C_YIELD_NB)
+            {
+                ++attempt_nb;
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(C_MAX_SLEEP, deadline - now));
+            }
+        }
+        return PushStatus::PUSHED;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
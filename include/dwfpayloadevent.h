@@ -0,0 +1,314 @@
+/*!
+ * @file dwfpayloadevent.h
+ * @brief Definition of events carrying a payload of any type in inline storage.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Definition of events carrying a payload stored inside the event, so that data carrying events are allocated from DwfEventPool in a single block.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_PAYLOAD_EVENT_H
+#define DWF_PAYLOAD_EVENT_H
+
+#include "dwfevent.h"
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*!
+* @namespace EventSystem
+* @brief A namespace used to regroup all elements related to envent processing systems
+*/
+namespace EventSystem
+{
+    /*! @class DwfPayloadEvent
+    * @brief Event carrying a payload of any type fitting in C_BUFFER_SIZE bytes
+    *
+    * Inherits from DwfEvent.
+    * Payload is constructed inside the event and destroyed with it, whatever its type, so that no class has to be derived from DwfEvent to carry data.
+    * Event and payload fit in a single DwfEventPool block, so that data carrying events do not allocate memory unless the payload itself does.
+    * Payload type is checked on access.
+    * Events are neither copyable nor movable, as they are handled through std::unique_ptr<DwfEvent>.
+    *
+    */
+    class DwfPayloadEvent : public DwfEvent
+    {
+    public:
+        static const size_t C_BUFFER_SIZE = 48u; /*!< Maximum size of the payload.*/
+
+        /*!
+        * @brief Constructor of the DwfPayloadEvent class
+        * @param id : Value of the event id.
+        *
+        * Event has no payload.
+        *
+        */
+        DwfPayloadEvent(EventID id) : DwfEvent(id), m_type(nullptr), m_destroy(nullptr)
+        {
+        }
+
+        /*!
+        * @brief Constructor of the DwfPayloadEvent class
+        * @tparam Payload : type of the payload. Must fit in C_BUFFER_SIZE bytes and be aligned on at most std::max_align_t.
+        * @param id : Value of the event id.
+        * @param payload : Data carried by the event. Copied or moved into the event.
+        *
+        */
+        template<class Payload, class = typename std::enable_if<!std::is_base_of<DwfEvent, typename std::decay<Payload>::type>::value>::type>
+        DwfPayloadEvent(EventID id, Payload&& payload) : DwfEvent(id), m_type(nullptr), m_destroy(nullptr)
+        {
+            typedef typename std::decay<Payload>::type Stored;
+            checkFits<Stored>();
+            new(&m_buffer) Stored(std::forward<Payload>(payload));
+            m_type = &PayloadType<Stored>::C_TAG; // Set once payload is built, so that a throwing constructor leaves nothing to destroy
+            m_destroy = &destroyPayload<Stored>;
+        }
+
+        DwfPayloadEvent(const DwfPayloadEvent&) = delete;
+        DwfPayloadEvent& operator=(const DwfPayloadEvent&) = delete;
+
+        /*!
+        * @brief Destructor of the DwfPayloadEvent class
+        *
+        * Destroys payload.
+        *
+        */
+        virtual ~DwfPayloadEvent()
+        {
+            if(m_destroy != nullptr)
+            {
+                m_destroy(&m_buffer);
+            }
+        }
+
+        /*!
+        * @brief Indicates whether event carries a payload of a given type
+        * @tparam Payload : type of the payload
+        * @return true if payload has type Payload, false otherwise or if event has no payload
+        *
+        * Constant method
+        *
+        */
+        template<class Payload>
+        bool holds() const
+        {
+            return m_type == &PayloadType<typename std::remove_cv<Payload>::type>::C_TAG;
+        }
+
+        /*!
+        * @brief Get payload
+        * @tparam Payload : type of the payload, as given to constructor
+        * @return Reference to the payload. Payload can be moved out of the event.
+        *
+        * Throws std::logic_error if payload does not have type Payload.
+        *
+        */
+        template<class Payload>
+        Payload& payload()
+        {
+            checkType<Payload>();
+            return *reinterpret_cast<Payload*>(&m_buffer);
+        }
+
+        /*!
+        * @brief Get payload
+        * @tparam Payload : type of the payload, as given to constructor
+        * @return Constant reference to the payload
+        *
+        * Throws std::logic_error if payload does not have type Payload.
+        * Constant method
+        *
+        */
+        template<class Payload>
+        const Payload& payload() const
+        {
+            checkType<Payload>();
+            return *reinterpret_cast<const Payload*>(&m_buffer);
+        }
+
+        /*!
+        * @brief Get payload carried by an event
+        * @tparam Payload : expected type of the payload
+        * @param event : Event received by processEvent or by a transition function
+        * @return Pointer to the payload. nullptr if event is not a DwfPayloadEvent or if its payload has another type.
+        *
+        * Static method
+        *
+        */
+        template<class Payload>
+        static Payload* payloadOf(DwfEvent& event)
+        {
+            DwfPayloadEvent* payload_event = dynamic_cast<DwfPayloadEvent*>(&event);
+            return payload_event != nullptr && payload_event->holds<Payload>() ? reinterpret_cast<Payload*>(&payload_event->m_buffer) : nullptr;
+        }
+
+        /*!
+        * @brief Get payload carried by an event
+        * @tparam Payload : expected type of the payload
+        * @param event : Event received by processEvent or by a transition function
+        * @return Constant pointer to the payload. nullptr if event is not a DwfPayloadEvent or if its payload has another type.
+        *
+        * Static method
+        *
+        */
+        template<class Payload>
+        static const Payload* payloadOf(const DwfEvent& event)
+        {
+            const DwfPayloadEvent* payload_event = dynamic_cast<const DwfPayloadEvent*>(&event);
+            return payload_event != nullptr && payload_event->holds<Payload>() ? reinterpret_cast<const Payload*>(&payload_event->m_buffer) : nullptr;
+        }
+
+    private:
+        /*! @struct PayloadType
+        *  @brief Holder of a tag whose address identifies a payload type, without RTTI
+        */
+        template<class Payload>
+        struct PayloadType
+        {
+            static const char C_TAG; /*!< Tag of the payload type.*/
+        };
+
+        const char* m_type; /*!< Tag of the payload type. nullptr if event has no payload.*/
+
+        void (*m_destroy)(void*); /*!< Function destroying the payload. nullptr if event has no payload.*/
+
+        typename std::aligned_storage<C_BUFFER_SIZE, alignof(std::max_align_t)>::type m_buffer; /*!< Payload storage.*/
+
+        /*!
+        * @brief Check at compile time that a payload type fits in the event
+        * @tparam Payload : type of the payload
+        *
+        * Static method
+        *
+        */
+        template<class Payload>
+        static void checkFits()
+        {
+            static_assert(sizeof(Payload) <= C_BUFFER_SIZE, "Payload does not fit in a payload event, derive an event from DwfEvent instead");
+            static_assert(alignof(std::max_align_t) % alignof(Payload) == 0u, "Payload alignment is not supported by payload events");
+        }
+
+        /*!
+        * @brief Check that payload has a given type
+        * @tparam Payload : expected type of the payload
+        *
+        * Throws std::logic_error if payload has another type.
+        * Constant method
+        *
+        */
+        template<class Payload>
+        void checkType() const
+        {
+            if(!holds<Payload>())
+            {
+                throw std::logic_error("Event payload has another type");
+            }
+        }
+
+        /*!
+        * @brief Destroy a payload
+        * @tparam Payload : type of the payload
+        * @param payload : Pointer to the payload storage
+        *
+        * Static method
+        *
+        */
+        template<class Payload>
+        static void destroyPayload(void* payload)
+        {
+            static_cast<Payload*>(payload)->~Payload();
+        }
+    };
+
+    template<class Payload>
+    const char DwfPayloadEvent::PayloadType<Payload>::C_TAG = 0;
+}
+
+#endif //DWF_PAYLOAD_EVENT_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,467 @@
+/*!
+ * @file dwfpriorityqueue.h
+ * @brief Definition of a thread safe queue with priority lanes
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_PRIORITY_QUEUE_H
+#define DWF_PRIORITY_QUEUE_H
+
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include "pushstatus.h"
+
+/*!
+* @namespace DwfContainers
+* @brief A namespace used to regroup all elements related to data containers
+*/
+namespace DwfContainers
+{
+    /*! @typedef Priority
+    *  @brief Priority of an element. 0 is the lowest priority.
+    */
+    typedef uint8_t Priority;
+
+    /*! @class DwfPriorityQueue
+    * @brief Class a thread safe size-limited queue with a fixed number of priority lanes
+    * @tparam T : type of elements stored in queue
+    *
+    * Each priority has its own FIFO lane. Pop returns the oldest element of the highest priority non empty lane.
+    * Non empty lanes are tracked in a bit mask so that push and pop are constant time whatever the number of lanes.
+    * Queue size limitation (if any) applies to all lanes together and is defined at queue creation.
+    * Methods without priority argument use the lowest priority, so that the queue can be used wherever DwfQueue is.
+    *
+    */
+    template<class T>
+    class DwfPriorityQueue
+    {
+    public:
+        static const size_t C_NO_SIZE_LIMIT; /*!< Definition of a specific value to indicate queue has no size limitation.*/
+
+        static const size_t C_MAX_LANE_NB; /*!< Maximum number of priority lanes.*/
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                     Constructors and Destructor                    ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Constructor of DwfPriorityQueue class
+        * @param lane_nb : Number of priority lanes. Priorities range from 0 to lane_nb - 1.
+        * @param max_element_nb : Max number of elements that can be stored in queue, all lanes included. Default indicates no size limitation.
+        *
+        * Constructor of the DwfPriorityQueue class setting number of lanes and queue size limitation.
+        * Throws std::invalid_argument if lane_nb is 0 or greater than C_MAX_LANE_NB.
+        *
+        */
+        DwfPriorityQueue(size_t lane_nb, size_t max_element_nb = C_NO_SIZE_LIMIT);
+
+        /*!
+        * @brief Destructor of DwfPriorityQueue class
+        *
+        * Disables wait ensuring all waiting thread are freed.
+        *
+        */
+        ~DwfPriorityQueue();
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                            Size Getters                            ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Indicated whether queue is empty
+        * @return true if queue is empty, false otherwise
+        *
+        * Const method
+        *
+        */
+        bool empty() const;
+
+        /*!
+        * @brief Indicates number of elements stored in queue
+        * @return Number of elements in queue, all lanes included
+        *
+        * Const method
+        *
+        */
+        size_t size() const;
+
+        /*!
+        * @brief Indicates if queue has reached its size limitation
+        * @return true queue is full, false otherwise
+        *
+        * Const method
+        * If the queue is not size limited, this method always returns false
+        *
+        */
+        bool full() const;
+
+        /*!
+        * @brief Indicates number of priority lanes
+        * @return Number of lanes
+        *
+        * Const method
+        *
+        */
+        size_t laneNb() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                         Overflow statistics                        ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Indicates number of elements dropped since queue creation
+        * @return Always 0, as push on a full queue throws an exception
+        *
+        * Const method
+        *
+        */
+        uint64_t droppedElementNb() const;
+
+        /*!
+        * @brief Indicates number of elements coalesced since queue creation
+        * @return Always 0, as elements are never coalesced
+        *
+        * Const method
+        *
+        */
+        uint64_t coalescedElementNb() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                          Wait management                           ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Disable wait of elements in queue
+        *
+        * Disable wait for queue to contain element in pop methods and for queue to have room in pushFor.
+        * Also unlocks all waiting threads.
+        *
+        */
+        void disableWait();
+
+        /*!
+        * @brief Enable wait for elements in queue
+        *
+        */
+        void enableWait();
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                               Clear                                ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Delete all elements in queue
+        *
+        */
+        void clear();
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                                Push                                ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Push an element by copy
+        * @param element : Reference to the element to push to queue
+        * @param priority : Priority of element. Default is the lowest priority.
+        *
+        * Push an element in the lane of its priority if queue is not full and notify consumer.
+        * If queue is full, throws an exception.
+        * Throws std::invalid_argument if priority has no lane.
+        *
+        */
+        void push(const T& element, Priority priority = 0u);
+
+        /*!
+        * @brief Push an element using move semantics
+        * @param element : Reference to the element to push to queue
+        * @param priority : Priority of element. Default is the lowest priority.
+        *
+        * Push an element in the lane of its priority if queue is not full and notify consumer.
+        * If queue is full, throws an exception. And element is not moved.
+        * Throws std::invalid_argument if priority has no lane.
+        *
+        */
+        void push(T&& element, Priority priority = 0u);
+
+        /*!
+        * @brief Push several elements of the same priority at once using move semantics
+        * @param elements : Elements to push to queue, in order. Cleared once elements are moved to queue.
+        * @param priority : Priority of elements. Default is the lowest priority.
+        *
+        * Push all elements under a single lock and wake up the consumer once.
+        * If queue cannot store all elements, throws an exception. And no element is moved.
+        *
+        */
+        void pushBatch(std::vector<T>& elements, Priority priority = 0u);
+
+        /*!
+        * @brief Try to push an element by copy
+        * @param element : Reference to the element to push to queue
+        * @param priority : Priority of element. Default is the lowest priority.
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full
+        *
+        * Same as push, without exception when queue is full.
+        *
+        */
+        PushStatus tryPush(const T& element, Priority priority = 0u);
+
+        /*!
+        * @brief Try to push an element using move semantics
+        * @param element : Reference to the element to push to queue
+        * @param priority : Priority of element. Default is the lowest priority.
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full. And element is not moved.
+        *
+        * Same as push, without exception when queue is full.
+        *
+        */
+        PushStatus tryPush(T&& element, Priority priority = 0u);
+
+        /*!
+        * @brief Push an element by copy, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @param priority : Priority of element. Default is the lowest priority.
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout, Priority priority = 0u);
+
+        /*!
+        * @brief Push an element using move semantics, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @param priority : Priority of element. Default is the lowest priority.
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled. And element is not moved.
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout, Priority priority = 0u);
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                                Pop                                 ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Pop an element by copy
+        * @param element : Reference to the element to copy queue head to
+        *
+        * Wait for an element to be available in queue then copy oldest element of highest priority to argument and remove it from queue.
+        * Calling to pop locks current thread until an element has been pushed to queue.
+        *
+        */
+        void pop(T& element);
+
+        /*!
+        * @brief Pop several elements at once
+        * @param max_element_nb : Maximum number of elements to pop. 0 indicates all available elements.
+        * @param elements : Vector popped elements are appended to, by decreasing priority then in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move up to max_element_nb elements to argument under a single lock.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popUpTo(size_t max_element_nb, std::vector<T>& elements);
+
+        /*!
+        * @brief Pop all available elements at once
+        * @param elements : Vector popped elements are appended to, by decreasing priority then in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move all available elements to argument under a single lock.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popAll(std::vector<T>& elements);
+
+    private:
+        std::vector< std::deque<T> > m_lanes; /*!< One elements container per priority.*/
+
+        uint64_t m_non_empty_lanes; /*!< Bit mask of non empty lanes. Bit i is set if lane of priority i contains elements.*/
+
+        size_t m_size; /*!< Number of elements in all lanes.*/
+
+        const size_t m_max_element_nb; /*!< Maximum size of the queue.*/
+
+        mutable std::mutex m_data_mutex; /*!< Mutex controlling access to the container data.*/
+
+        std::condition_variable m_control_content; /*!< Condition variable used to wait for data in the queue.*/
+
+        std::condition_variable m_control_space; /*!< Condition variable used to wait for room in the queue.*/
+
+        size_t m_waiting_producer_nb; /*!< Number of threads waiting for room. Protected by m_data_mutex.*/
+
+        std::atomic<bool> m_wait_disabled; /*!< Flag indicating that waiting for elements is disabled (ex: when queue is deleted). All waiting thread must be notified and no thread can wait any longer. */
+
+        /*!
+        * @brief Check priority has a lane
+        * @param priority : Priority to check
+        *
+        * Throws std::invalid_argument if priority has no lane.
+        *
+        */
+        void checkPriority(Priority priority) const;
+
+        /*!
+        * @brief Check number of lanes is supported
+        * @param lane_nb : Number of lanes to check
+        * @return lane_nb, so that lanes can be built in place without moving non copyable elements
+        *
+        * Throws std::invalid_argument if lane_nb is 0 or greater than C_MAX_LANE_NB.
+        * Static method.
+        *
+        */
+        static size_t checkLaneNb(size_t lane_nb);
+
+        /*!
+        * @brief Indicates if queue can store element_nb more elements
+        * @param element_nb : Number of elements to store
+        * @return true if elements fit in queue, false otherwise
+        *
+        * Must be called with m_data_mutex locked.
+        *
+        */
+        bool hasRoom(size_t element_nb) const;
+
+        /*!
+        * @brief Index of the highest set bit of a mask
+        * @param mask : Bit mask. Must not be 0.
+        * @return Index of the highest set bit, 0 being the least significant bit
+        *
+        * Uses a compiler intrinsic when available, a binary search otherwise.
+        * Static method.
+        *
+        */
+        static size_t highestSetBit(uint64_t mask);
+
+        /*!
+        * @brief Remove oldest element of highest priority, moving it to argument
+        * @param element : Reference to move element to
+        *
+        * Must be called with m_data_mutex locked, on a non empty queue.
+        *
+        */
+        void takeFront(T& element);
+
+        /*!
+        * @brief Push an element if queue has room, waiting at most timeout for room
+        * @param element : Element to push, only forwarded once pushed
+        * @param priority : Priority of element
+        * @param timeout : Maximum duration to wait for room. Zero does not wait.
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full and timeout is zero, PushStatus::TIMEOUT otherwise
+        *
+        */
+        template<class U, class Rep, class Period>
+        PushStatus pushElement(U&& element, Priority priority, const std::chrono::duration<Rep, Period>& timeout);
+
+        /*!
+        * @brief Notify threads waiting for room that elements were removed
+        * @param datalock : Lock held on m_data_mutex. Released by the method.
+        *
+        */
+        void notifyRoom(std::unique_lock<std::mutex>& datalock);
+    };
+}
+
+#include "dwfpriorityqueue.tpp"
+
+#endif //DWF_PRIORITY_QUEUE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
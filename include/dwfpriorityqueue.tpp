@@ -0,0 +1,435 @@
+/*!
+ * @file dwfpriorityqueue.tpp
+ * @brief Class defining a thread safe queue with priority lanes.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class defining a thread safe size-limited queue with a fixed number of priority lanes.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfpriorityqueue.h"
+#include <stdexcept>
+
+namespace DwfContainers
+{
+    template<class T>
+    const size_t DwfPriorityQueue<T>::C_NO_SIZE_LIMIT=0;
+
+    template<class T>
+    const size_t DwfPriorityQueue<T>::C_MAX_LANE_NB=64; // One bit of m_non_empty_lanes per lane
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     Constructors and Destructor                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    DwfPriorityQueue<T>::DwfPriorityQueue(size_t lane_nb, size_t max_element_nb) : m_lanes(checkLaneNb(lane_nb)), m_non_empty_lanes(0u), m_size(0u), m_max_element_nb(max_element_nb),
+        m_waiting_producer_nb(0u), m_wait_disabled(false)
+    {
+    }
+
+    template<class T>
+    DwfPriorityQueue<T>::~DwfPriorityQueue()
+    {
+        disableWait();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            Size Getters                            ///
+    ///                                                                    ///
+    /////////////////////////////////////////////////////////////////////////
+    template<class T>
+    bool DwfPriorityQueue<T>::empty() const
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return m_size == 0u;
+    }
+
+    template<class T>
+    size_t DwfPriorityQueue<T>::size() const
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return m_size;
+    }
+
+    template<class T>
+    bool DwfPriorityQueue<T>::full() const
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        return !hasRoom(1u);
+    }
+
+    template<class T>
+    size_t DwfPriorityQueue<T>::laneNb() const
+    {
+        return m_lanes.size();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         Overflow statistics                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    uint64_t DwfPriorityQueue<T>::droppedElementNb() const
+    {
+        return 0u;
+    }
+
+    template<class T>
+    uint64_t DwfPriorityQueue<T>::coalescedElementNb() const
+    {
+        return 0u;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          Wait management                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfPriorityQueue<T>::disableWait()
+    {
+        {
+            std::unique_lock<std::mutex> datalock(m_data_mutex); // Ensures no waiting thread misses the flag between its check and its wait
+            m_wait_disabled=true;
+        }
+        m_control_content.notify_all(); // For all threads to exit waiting state
+        m_control_space.notify_all();
+    }
+
+    template<class T>
+    void DwfPriorityQueue<T>::enableWait()
+    {
+        m_wait_disabled=false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               Clear                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfPriorityQueue<T>::clear()
+    {
+        std::vector< std::deque<T> > empty(m_lanes.size());
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        std::swap( m_lanes, empty );
+        m_non_empty_lanes = 0u;
+        m_size = 0u;
+        notifyRoom(datalock);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Push                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfPriorityQueue<T>::push(const T& element, Priority priority)
+    {
+        if(tryPush(element, priority) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T>
+    void DwfPriorityQueue<T>::push(T&& element, Priority priority)
+    {
+        if(tryPush(std::move(element), priority) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T>
+    void DwfPriorityQueue<T>::pushBatch(std::vector<T>& elements, Priority priority)
+    {
+        checkPriority(priority);
+        if(elements.empty())
+        {
+            return;
+        }
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!hasRoom(elements.size()))
+        {
+            throw std::runtime_error("Queue is full. Cannot add elements");
+        }
+        std::deque<T>& lane = m_lanes[priority];
+        for(T& element : elements)
+        {
+            lane.push_back(std::move(element));
+        }
+        m_size += elements.size();
+        m_non_empty_lanes |= (static_cast<uint64_t>(1u) << priority);
+        datalock.unlock();
+        elements.clear();
+        m_control_content.notify_one();
+    }
+
+    template<class T>
+    PushStatus DwfPriorityQueue<T>::tryPush(const T& element, Priority priority)
+    {
+        return pushElement(element, priority, std::chrono::nanoseconds::zero());
+    }
+
+    template<class T>
+    PushStatus DwfPriorityQueue<T>::tryPush(T&& element, Priority priority)
+    {
+        return pushElement(std::move(element), priority, std::chrono::nanoseconds::zero());
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfPriorityQueue<T>::pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout, Priority priority)
+    {
+        const PushStatus status = pushElement(element, priority, timeout);
+        return status == PushStatus::FULL ? PushStatus::TIMEOUT : status; // Null timeouts report expiry like other ones
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfPriorityQueue<T>::pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout, Priority priority)
+    {
+        const PushStatus status = pushElement(std::move(element), priority, timeout);
+        return status == PushStatus::FULL ? PushStatus::TIMEOUT : status; // Null timeouts report expiry like other ones
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Pop                                 ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfPriorityQueue<T>::pop(T& element)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            m_control_content.wait(datalock, [this](){return m_size != 0u || m_wait_disabled;}); // Only exit wait if queue is not empty or if deletion has been requested
+            if(! m_wait_disabled) // Only try to get element if we are allowed to wait for elements
+            {
+                takeFront(element);
+                notifyRoom(datalock);
+            }
+        }
+    }
+
+    template<class T>
+    size_t DwfPriorityQueue<T>::popUpTo(size_t max_element_nb, std::vector<T>& elements)
+    {
+        size_t popped_nb = 0u;
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            m_control_content.wait(datalock, [this](){return m_size != 0u || m_wait_disabled;}); // Only exit wait if queue is not empty or if deletion has been requested
+            if(! m_wait_disabled) // Only try to get elements if we are allowed to wait for elements
+            {
+                while(m_size != 0u && (max_element_nb == C_NO_SIZE_LIMIT || popped_nb < max_element_nb))
+                {
+                    elements.emplace_back();
+                    takeFront(elements.back());
+                    ++popped_nb;
+                }
+                notifyRoom(datalock);
+            }
+        }
+        return popped_nb;
+    }
+
+    template<class T>
+    size_t DwfPriorityQueue<T>::popAll(std::vector<T>& elements)
+    {
+        return popUpTo(C_NO_SIZE_LIMIT, elements);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          Lanes management                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    size_t DwfPriorityQueue<T>::checkLaneNb(size_t lane_nb)
+    {
+        if(lane_nb == 0u || lane_nb > C_MAX_LANE_NB)
+        {
+            throw std::invalid_argument("Priority queue needs between 1 and 64 lanes");
+        }
+        return lane_nb;
+    }
+
+    template<class T>
+    void DwfPriorityQueue<T>::checkPriority(Priority priority) const
+    {
+        if(priority >= m_lanes.size())
+        {
+            throw std::invalid_argument("Priority has no lane in queue");
+        }
+    }
+
+    template<class T>
+    bool DwfPriorityQueue<T>::hasRoom(size_t element_nb) const
+    {
+        return m_max_element_nb == C_NO_SIZE_LIMIT || m_size + element_nb <= m_max_element_nb;
+    }
+
+    template<class T>
+    size_t DwfPriorityQueue<T>::highestSetBit(uint64_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<size_t>(__builtin_clzll(mask));
+#else
+        size_t bit = 0u;
+        for(size_t shift = 32u; shift > 0u; shift /= 2u) // Halve searched range at each step, 6 steps for 64 bits
+        {
+            if(mask >> shift)
+            {
+                mask >>= shift;
+                bit += shift;
+            }
+        }
+        return bit;
+#endif
+    }
+
+    template<class T>
+    void DwfPriorityQueue<T>::takeFront(T& element)
+    {
+        const size_t priority = highestSetBit(m_non_empty_lanes); // Highest non empty lane, in constant time
+        std::deque<T>& lane = m_lanes[priority];
+        element = std::move(lane.front());
+        lane.pop_front();
+        --m_size;
+        if(lane.empty())
+        {
+            m_non_empty_lanes &= ~(static_cast<uint64_t>(1u) << priority);
+        }
+    }
+
+    template<class T>
+    template<class U, class Rep, class Period>
+    PushStatus DwfPriorityQueue<T>::pushElement(U&& element, Priority priority, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        checkPriority(priority);
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!hasRoom(1u))
+        {
+            if(timeout <= std::chrono::duration<Rep, Period>::zero())
+            {
+                return PushStatus::FULL;
+            }
+            ++m_waiting_producer_nb;
+            const bool has_room = m_control_space.wait_for(datalock, timeout, [this](){return hasRoom(1u) || m_wait_disabled;}); // Only exit wait if element fits, if wait has been disabled or on timeout
+            --m_waiting_producer_nb;
+            if(!has_room || m_wait_disabled)
+            {
+                return PushStatus::TIMEOUT;
+            }
+        }
+        m_lanes[priority].push_back(std::forward<U>(element));
+        ++m_size;
+        m_non_empty_lanes |= (static_cast<uint64_t>(1u) << priority);
+        datalock.unlock();
+        m_control_content.notify_one();
+        return PushStatus::PUSHED;
+    }
+
+    template<class T>
+    void DwfPriorityQueue<T>::notifyRoom(std::unique_lock<std::mutex>& datalock)
+    {
+        const bool producer_waiting = m_waiting_producer_nb > 0u;
+        datalock.unlock();
+        if(producer_waiting) // Avoid notification cost when queue is not blocking anyone
+        {
+            m_control_space.notify_all();
+        }
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -72,11 +72,17 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #ifndef DWF_QUEUE_H
 #define DWF_QUEUE_H
 
-#include <queue>
+#include <deque>
+#include <vector>
+#include <functional>
 #include <cstdint>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <chrono>
+#include "pushstatus.h"
+#include "overflowpolicy.h"
+#include "waitstrategy.h"
 
 /*!
 * @namespace DwfContainers
@@ -89,6 +95,9 @@ namespace DwfContainers
     * @tparam T : type of elements stored in queue
     *
     * Queue size limitation (if any) is defined at queue creation and cannot be changed afterwards.
+    * So is the overflow policy defining whether push throws, waits for room, drops or coalesces elements when queue is full.
+    * And so is the wait strategy defining whether pop spins before parking when queue is empty.
+    * Dropped and coalesced elements are counted.
     *
     */
     template<class T>
@@ -97,6 +106,11 @@ namespace DwfContainers
     public:
         static const size_t C_NO_SIZE_LIMIT; /*!< Definition of a specific value to indicate queue has no size limitation.*/
 
+        /*! @typedef KeyEqual
+        *  @brief Function indicating whether two elements have the same key, used by OverflowPolicy::COALESCE_BY_ID
+        */
+        typedef std::function<bool(const T&, const T&)> KeyEqual;
+
         //////////////////////////////////////////////////////////////////////////
         ///                                                                    ///
         ///                     Constructors and Destructor                    ///
@@ -105,11 +119,15 @@ namespace DwfContainers
         /*!
         * @brief Constructor of DwfQueue class
         * @param max_element_nb : Max number of elements that can be stored in queue. Default indicates no size limitation.
+        * @param overflow_policy : Behavior of push when queue is full. Default throws an exception.
+        * @param key_equal : Function comparing element keys. Only used, and then mandatory, with OverflowPolicy::COALESCE_BY_ID.
+        * @param wait_strategy : Way pop methods wait for elements. Default parks consumer immediately.
         *
-        * Constructor of the DwfQueue class setting queue size limitation.
+        * Constructor of the DwfQueue class setting queue size limitation, overflow policy and wait strategy.
+        * Throws std::invalid_argument if policy is OverflowPolicy::COALESCE_BY_ID and key_equal is empty.
         *
         */
-        DwfQueue(size_t max_element_nb = C_NO_SIZE_LIMIT);
+        DwfQueue(size_t max_element_nb = C_NO_SIZE_LIMIT, OverflowPolicy overflow_policy = OverflowPolicy::THROW, KeyEqual key_equal = KeyEqual(), WaitStrategy wait_strategy = WaitStrategy());
 
         /*!
         * @brief Destructor of DwfQueue class
@@ -153,6 +171,29 @@ namespace DwfContainers
         */
         bool full() const;
 
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                         Overflow statistics                        ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Indicates number of elements dropped by overflow policy since queue creation
+        * @return Number of dropped elements
+        *
+        * Const method
+        *
+        */
+        uint64_t droppedElementNb() const;
+
+        /*!
+        * @brief Indicates number of elements coalesced by overflow policy since queue creation
+        * @return Number of queued elements replaced by a pushed element
+        *
+        * Const method
+        *
+        */
+        uint64_t coalescedElementNb() const;
+
         //////////////////////////////////////////////////////////////////////////
         ///                                                                    ///
         ///                          Wait management                           ///
@@ -161,7 +202,7 @@ namespace DwfContainers
         /*!
         * @brief Disable wait of elements in queue
         *
-        * Disable wait for queue to contain element in pop method.
+        * Disable wait for queue to contain element in pop method and for queue to have room in push methods.
         * Also unlocks all waiting threads.
         * Especially used during queue desctruction
         *
@@ -195,7 +236,8 @@ namespace DwfContainers
         * @param element : Reference to the element to push to queue
         *
         * Push an element if queue is not full and notify one of the waiting threads that an element is available.
-        * If queue is full, throws an exception.
+        * Capacity check and push are performed in a single critical section.
+        * If queue is full, applies overflow policy.
         *
         */
         void push(const T& element);
@@ -205,11 +247,68 @@ namespace DwfContainers
         * @param element : Reference to the element to push to queue
         *
         * Push an element if queue is not full and notify one of the waiting threads that an element is available.
-        * If queue is full, throws an exception. And element is not moved.
+        * Capacity check and push are performed in a single critical section.
+        * If queue is full, applies overflow policy. Element is not moved if an exception is thrown or if it is dropped.
         *
         */
         void push(T&& element);
 
+        /*!
+        * @brief Push several elements at once using move semantics
+        * @param elements : Elements to push to queue, in order. Cleared once elements are moved to queue.
+        *
+        * Push all elements under a single lock and wake up the consumer once.
+        * If queue cannot store all elements, throws an exception or waits for room depending on overflow policy. No element is moved if an exception is thrown.
+        * Batches larger than size limitation always throw with these policies.
+        * Other policies are applied element by element.
+        *
+        */
+        void pushBatch(std::vector<T>& elements);
+
+        /*!
+        * @brief Try to push an element by copy
+        * @param element : Reference to the element to push to queue
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full
+        *
+        * Same as push, without exception when queue is full. Overflow policy is not applied.
+        *
+        */
+        PushStatus tryPush(const T& element);
+
+        /*!
+        * @brief Try to push an element using move semantics
+        * @param element : Reference to the element to push to queue
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full. And element is not moved.
+        *
+        * Same as push, without exception when queue is full. Overflow policy is not applied.
+        *
+        */
+        PushStatus tryPush(T&& element);
+
+        /*!
+        * @brief Push an element by copy, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled
+        *
+        * Waits whatever the overflow policy.
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout);
+
+        /*!
+        * @brief Push an element using move semantics, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled. And element is not moved.
+        *
+        * Waits whatever the overflow policy.
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout);
+
         //////////////////////////////////////////////////////////////////////////
         ///                                                                    ///
         ///                                Pop                                 ///
@@ -221,20 +320,134 @@ namespace DwfContainers
         *
         * Wait for an element to be available in queue then copy it to argument and remove it from queue.
         * Calling to pop locks current thread until an element has been pushed to queue.
+        * Queue is polled according to wait strategy before parking.
         *
         */
         void pop(T& element);
 
+        /*!
+        * @brief Pop several elements at once
+        * @param max_element_nb : Maximum number of elements to pop. 0 indicates all available elements.
+        * @param elements : Vector popped elements are appended to, in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move up to max_element_nb elements to argument under a single lock.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popUpTo(size_t max_element_nb, std::vector<T>& elements);
+
+        /*!
+        * @brief Pop all available elements at once
+        * @param elements : Vector popped elements are appended to, in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move all available elements to argument under a single lock.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popAll(std::vector<T>& elements);
+
     private:
-        std::queue<T> m_queue; /*!< Elements container.*/
+        std::deque<T> m_queue; /*!< Elements container. A deque rather than a queue so that coalescing can look for elements with the same key.*/
 
         const size_t m_max_element_nb; /*!< Maximum size of the queue.*/
 
+        const OverflowPolicy m_overflow_policy; /*!< Behavior of push when queue is full.*/
+
+        const KeyEqual m_key_equal; /*!< Function comparing element keys when coalescing.*/
+
+        const WaitStrategy m_wait_strategy; /*!< Polling performed by pop methods before waiting on m_control_content.*/
+
+        std::atomic<size_t> m_element_nb; /*!< Number of elements in queue, updated under m_data_mutex so that consumers can poll it without locking.*/
+
+        std::atomic<uint64_t> m_dropped_nb; /*!< Number of elements dropped by overflow policy.*/
+
+        std::atomic<uint64_t> m_coalesced_nb; /*!< Number of elements coalesced by overflow policy.*/
+
         mutable std::mutex m_data_mutex; /*!< Mutex controlling access to the container data.*/
 
         std::condition_variable m_control_content; /*!< Condition variable used to wait for data in the queue.*/
 
+        std::condition_variable m_control_space; /*!< Condition variable used to wait for room in the queue.*/
+
+        size_t m_waiting_producer_nb; /*!< Number of threads waiting for room. Protected by m_data_mutex.*/
+
         std::atomic<bool> m_wait_disabled; /*!< Flag indicating that waiting for elements is disabled (ex: when queue is deleted). All waiting thread must be notified and no thread can wait any longer. */
+
+        /*!
+        * @brief Indicates if queue can store element_nb more elements
+        * @param element_nb : Number of elements to store
+        * @return true if elements fit in queue, false otherwise
+        *
+        * Must be called with m_data_mutex locked.
+        *
+        */
+        bool hasRoom(size_t element_nb) const;
+
+        /*!
+        * @brief Wait for queue to be able to store element_nb more elements
+        * @param datalock : Lock held on m_data_mutex
+        * @param element_nb : Number of elements to store
+        * @return true if elements fit in queue, false if wait was disabled
+        *
+        */
+        bool waitRoom(std::unique_lock<std::mutex>& datalock, size_t element_nb);
+
+        /*!
+        * @brief Wait at most timeout for queue to be able to store element_nb more elements
+        * @param datalock : Lock held on m_data_mutex
+        * @param element_nb : Number of elements to store
+        * @param timeout : Maximum duration to wait
+        * @return true if elements fit in queue, false if timeout expired or wait was disabled
+        *
+        */
+        template<class Rep, class Period>
+        bool waitRoomFor(std::unique_lock<std::mutex>& datalock, size_t element_nb, const std::chrono::duration<Rep, Period>& timeout);
+
+        /*!
+        * @brief Push an element, applying overflow policy if queue is full
+        * @param element : Element to push, forwarded to container
+        *
+        */
+        template<class U>
+        void pushElement(U&& element);
+
+        /*!
+        * @brief Apply overflow policy when queue is full
+        * @param datalock : Lock held on m_data_mutex
+        * @param element : Element being pushed. Only forwarded if coalesced.
+        * @return true if element must still be pushed, false if it was dropped or coalesced
+        *
+        * Throws an exception if policy is OverflowPolicy::THROW or if OverflowPolicy::BLOCK wait was disabled.
+        *
+        */
+        template<class U>
+        bool handleOverflow(std::unique_lock<std::mutex>& datalock, U&& element);
+
+        /*!
+        * @brief Push an element once room has been checked and notify one of the threads waiting for elements
+        * @param datalock : Lock held on m_data_mutex. Released by the method.
+        * @param element : Element to push, forwarded to container
+        *
+        */
+        template<class U>
+        void enqueue(std::unique_lock<std::mutex>& datalock, U&& element);
+
+        /*!
+        * @brief Poll queue content according to wait strategy
+        *
+        * Called without m_data_mutex locked so that polling does not slow producers down.
+        *
+        */
+        void pollContent() const;
+
+        /*!
+        * @brief Notify threads waiting for room that elements were removed
+        * @param datalock : Lock held on m_data_mutex. Released by the method.
+        *
+        */
+        void notifyRoom(std::unique_lock<std::mutex>& datalock);
     };
 }
 
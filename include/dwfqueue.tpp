@@ -83,8 +83,13 @@ namespace DwfContainers
     ///                                                                    ///
     //////////////////////////////////////////////////////////////////////////
     template<class T>
-    DwfQueue<T>::DwfQueue(size_t max_element_nb) : m_max_element_nb(max_element_nb), m_wait_disabled(false)
+    DwfQueue<T>::DwfQueue(size_t max_element_nb, OverflowPolicy overflow_policy, KeyEqual key_equal, WaitStrategy wait_strategy) : m_max_element_nb(max_element_nb), m_overflow_policy(overflow_policy), m_key_equal(key_equal),
+        m_wait_strategy(wait_strategy), m_element_nb(0u), m_dropped_nb(0u), m_coalesced_nb(0u), m_waiting_producer_nb(0u), m_wait_disabled(false)
     {
+        if(m_overflow_policy == OverflowPolicy::COALESCE_BY_ID && !m_key_equal)
+        {
+            throw std::invalid_argument("Coalescing queue needs a key comparison function");
+        }
     }
 
     template<class T>
@@ -126,6 +131,23 @@ namespace DwfContainers
         }
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         Overflow statistics                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    uint64_t DwfQueue<T>::droppedElementNb() const
+    {
+        return m_dropped_nb;
+    }
+
+    template<class T>
+    uint64_t DwfQueue<T>::coalescedElementNb() const
+    {
+        return m_coalesced_nb;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     ///                                                                    ///
     ///                          Wait management                           ///
@@ -134,8 +156,12 @@ namespace DwfContainers
     template<class T>
     void DwfQueue<T>::disableWait()
     {
-        m_wait_disabled=true;
+        {
+            std::unique_lock<std::mutex> datalock(m_data_mutex); // Ensures no producer misses the flag between its check and its wait
+            m_wait_disabled=true;
+        }
         m_control_content.notify_all(); // For all threads to exit waiting state
+        m_control_space.notify_all();
     }
 
     template<class T>
@@ -152,9 +178,11 @@ namespace DwfContainers
     template<class T>
     void DwfQueue<T>::clear()
     {
-        std::queue<T> empty;
+        std::deque<T> empty;
         std::unique_lock<std::mutex> datalock(m_data_mutex);
         std::swap( m_queue, empty );
+        m_element_nb.store(0u, std::memory_order_relaxed);
+        notifyRoom(datalock);
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -165,27 +193,102 @@ namespace DwfContainers
     template<class T>
     void DwfQueue<T>::push(const T& element)
     {
-        if(full())
+        pushElement(element);
+    }
+
+    template<class T>
+    void DwfQueue<T>::push(T&& element)
+    {
+        pushElement(std::move(element));
+    }
+
+    template<class T>
+    void DwfQueue<T>::pushBatch(std::vector<T>& elements)
+    {
+        if(elements.empty())
         {
-            throw std::runtime_error("Queue is full. Cannot add element");
+            return;
         }
         std::unique_lock<std::mutex> datalock(m_data_mutex);
-        m_queue.push(element);
+        if(m_overflow_policy == OverflowPolicy::THROW || m_overflow_policy == OverflowPolicy::BLOCK) // All or nothing
+        {
+            if(!hasRoom(elements.size()))
+            {
+                const bool can_fit = elements.size() <= m_max_element_nb; // Batches larger than size limit would wait forever
+                if(m_overflow_policy == OverflowPolicy::THROW || !can_fit || !waitRoom(datalock, elements.size()))
+                {
+                    throw std::runtime_error("Queue is full. Cannot add elements");
+                }
+            }
+            for(T& element : elements)
+            {
+                m_queue.push_back(std::move(element));
+            }
+        }
+        else // Element by element
+        {
+            for(T& element : elements)
+            {
+                if(hasRoom(1u) || handleOverflow(datalock, std::move(element)))
+                {
+                    m_queue.push_back(std::move(element));
+                }
+            }
+        }
+        m_element_nb.store(m_queue.size(), std::memory_order_release);
         datalock.unlock();
+        elements.clear();
         m_control_content.notify_one();
     }
 
     template<class T>
-    void DwfQueue<T>::push(T&& element)
+    PushStatus DwfQueue<T>::tryPush(const T& element)
     {
-        if(full())
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!hasRoom(1u)) // Checked under the same lock as push so that size limit cannot be exceeded
         {
-            throw std::runtime_error("Queue is full. Cannot add element");
+            return PushStatus::FULL;
         }
+        enqueue(datalock, element);
+        return PushStatus::PUSHED;
+    }
+
+    template<class T>
+    PushStatus DwfQueue<T>::tryPush(T&& element)
+    {
         std::unique_lock<std::mutex> datalock(m_data_mutex);
-        m_queue.push(std::move(element));
-        datalock.unlock();
-        m_control_content.notify_one();
+        if(!hasRoom(1u)) // Checked under the same lock as push so that size limit cannot be exceeded
+        {
+            return PushStatus::FULL;
+        }
+        enqueue(datalock, std::move(element));
+        return PushStatus::PUSHED;
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfQueue<T>::pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!hasRoom(1u) && !waitRoomFor(datalock, 1u, timeout))
+        {
+            return PushStatus::TIMEOUT;
+        }
+        enqueue(datalock, element);
+        return PushStatus::PUSHED;
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfQueue<T>::pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!hasRoom(1u) && !waitRoomFor(datalock, 1u, timeout))
+        {
+            return PushStatus::TIMEOUT;
+        }
+        enqueue(datalock, std::move(element));
+        return PushStatus::PUSHED;
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -196,6 +299,7 @@ namespace DwfContainers
     template<class T>
     void DwfQueue<T>::pop(T& element)
     {
+        pollContent();
         std::unique_lock<std::mutex> datalock(m_data_mutex);
         if(!m_wait_disabled) // Do nothing if we disabled wait
         {
@@ -203,9 +307,146 @@ namespace DwfContainers
             if(! m_wait_disabled) // Only try to get element if we are allowed to wait for elements
             {
                 element = std::move(m_queue.front());
-                m_queue.pop();
+                m_queue.pop_front();
+                m_element_nb.store(m_queue.size(), std::memory_order_relaxed);
+                notifyRoom(datalock);
+            }
+        }
+    }
+
+    template<class T>
+    size_t DwfQueue<T>::popUpTo(size_t max_element_nb, std::vector<T>& elements)
+    {
+        size_t popped_nb = 0u;
+        pollContent();
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            m_control_content.wait(datalock, [this](){return !m_queue.empty() || m_wait_disabled;}); // Only exit wait if queue is not empty or if deletion has been requested
+            if(! m_wait_disabled) // Only try to get elements if we are allowed to wait for elements
+            {
+                while(!m_queue.empty() && (max_element_nb == C_NO_SIZE_LIMIT || popped_nb < max_element_nb))
+                {
+                    elements.push_back(std::move(m_queue.front()));
+                    m_queue.pop_front();
+                    ++popped_nb;
+                }
+                m_element_nb.store(m_queue.size(), std::memory_order_relaxed);
+                notifyRoom(datalock);
             }
         }
+        return popped_nb;
+    }
+
+    template<class T>
+    size_t DwfQueue<T>::popAll(std::vector<T>& elements)
+    {
+        return popUpTo(C_NO_SIZE_LIMIT, elements);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          Room management                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    bool DwfQueue<T>::hasRoom(size_t element_nb) const
+    {
+        return m_max_element_nb == C_NO_SIZE_LIMIT || m_queue.size() + element_nb <= m_max_element_nb;
+    }
+
+    template<class T>
+    bool DwfQueue<T>::waitRoom(std::unique_lock<std::mutex>& datalock, size_t element_nb)
+    {
+        ++m_waiting_producer_nb;
+        m_control_space.wait(datalock, [this, element_nb](){return hasRoom(element_nb) || m_wait_disabled;}); // Only exit wait if elements fit or if wait has been disabled
+        --m_waiting_producer_nb;
+        return !m_wait_disabled;
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    bool DwfQueue<T>::waitRoomFor(std::unique_lock<std::mutex>& datalock, size_t element_nb, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        ++m_waiting_producer_nb;
+        const bool has_room = m_control_space.wait_for(datalock, timeout, [this, element_nb](){return hasRoom(element_nb) || m_wait_disabled;}); // Only exit wait if elements fit, if wait has been disabled or on timeout
+        --m_waiting_producer_nb;
+        return has_room && !m_wait_disabled;
+    }
+
+    template<class T>
+    template<class U>
+    void DwfQueue<T>::pushElement(U&& element)
+    {
+        std::unique_lock<std::mutex> datalock(m_data_mutex);
+        if(hasRoom(1u) || handleOverflow(datalock, std::forward<U>(element))) // Element is only forwarded by handleOverflow if it does not have to be pushed
+        {
+            enqueue(datalock, std::forward<U>(element));
+        }
+    }
+
+    template<class T>
+    template<class U>
+    bool DwfQueue<T>::handleOverflow(std::unique_lock<std::mutex>& datalock, U&& element)
+    {
+        switch(m_overflow_policy)
+        {
+            case OverflowPolicy::BLOCK:
+                if(!waitRoom(datalock, 1u))
+                {
+                    throw std::runtime_error("Queue is full. Cannot add element");
+                }
+                return true;
+            case OverflowPolicy::DROP_OLDEST:
+                m_queue.pop_front();
+                ++m_dropped_nb;
+                return true;
+            case OverflowPolicy::DROP_NEWEST:
+                ++m_dropped_nb;
+                return false;
+            case OverflowPolicy::COALESCE_BY_ID:
+                for(typename std::deque<T>::reverse_iterator it = m_queue.rbegin(); it != m_queue.rend(); ++it) // Latest element first, as it is the one element replaces
+                {
+                    if(m_key_equal(*it, element))
+                    {
+                        *it = std::forward<U>(element);
+                        ++m_coalesced_nb;
+                        return false;
+                    }
+                }
+                m_queue.pop_front(); // No element to coalesce with, keep most recent elements
+                ++m_dropped_nb;
+                return true;
+            default:
+                throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T>
+    template<class U>
+    void DwfQueue<T>::enqueue(std::unique_lock<std::mutex>& datalock, U&& element)
+    {
+        m_queue.push_back(std::forward<U>(element));
+        m_element_nb.store(m_queue.size(), std::memory_order_release);
+        datalock.unlock();
+        m_control_content.notify_one();
+    }
+
+    template<class T>
+    void DwfQueue<T>::pollContent() const
+    {
+        m_wait_strategy.poll([this](){return m_element_nb.load(std::memory_order_acquire) > 0u || m_wait_disabled;}); // Pop takes the lock and checks content again whatever the result
+    }
+
+    template<class T>
+    void DwfQueue<T>::notifyRoom(std::unique_lock<std::mutex>& datalock)
+    {
+        const bool producer_waiting = m_waiting_producer_nb > 0u;
+        datalock.unlock();
+        if(producer_waiting) // Avoid notification cost when queue is not blocking anyone
+        {
+            m_control_space.notify_all(); // All of them since waiting batches may need more room than a single element
+        }
     }
 }
 
@@ -0,0 +1,445 @@
+/*!
+ * @file dwfspscqueue.h
+ * @brief Class defining a lock-free single producer single consumer queue.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class defining a bounded lock-free ring buffer for one producer thread and one consumer thread.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_SPSC_QUEUE_H
+#define DWF_SPSC_QUEUE_H
+
+#include <vector>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include "pushstatus.h"
+#include <type_traits>
+
+/*!
+* @namespace DwfContainers
+* @brief A namespace used to regroup all elements related to data containers
+*/
+namespace DwfContainers
+{
+    /*! @class DwfSpscQueue
+    * @brief Class a lock-free size-limited single producer single consumer queue
+    * @tparam T : type of elements stored in queue
+    *
+    * Queue size limitation is mandatory, defined at queue creation and cannot be changed afterwards.
+    * Only one thread may push and only one thread may pop at a given time.
+    * Push and pop do not take any lock. A mutex and a condition variable are only used to park the consumer when queue is empty,
+    * and the producer only signals when the consumer is actually parked.
+    *
+    */
+    template<class T>
+    class DwfSpscQueue
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                     Constructors and Destructor                    ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Constructor of DwfSpscQueue class
+        * @param max_element_nb : Max number of elements that can be stored in queue. Must not be 0.
+        *
+        * Constructor of the DwfSpscQueue class allocating the ring buffer.
+        * Throws std::invalid_argument if max_element_nb is 0.
+        *
+        */
+        DwfSpscQueue(size_t max_element_nb);
+
+        /*!
+        * @brief Destructor of DwfSpscQueue class
+        *
+        * Disables wait, ensuring waiting thread is freed, and deletes remaining elements.
+        *
+        */
+        ~DwfSpscQueue();
+
+        DwfSpscQueue(const DwfSpscQueue&) = delete;
+        DwfSpscQueue& operator=(const DwfSpscQueue&) = delete;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                            Size Getters                            ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Indicated whether queue is empty
+        * @return true if queue is empty, false otherwise
+        *
+        * Const method
+        * Result is a snapshot which may be outdated if the other side is running.
+        *
+        */
+        bool empty() const;
+
+        /*!
+        * @brief Indicates number of elements stored in queue
+        * @return Number of elements in queue
+        *
+        * Const method
+        * Result is a snapshot which may be outdated if the other side is running.
+        *
+        */
+        size_t size() const;
+
+        /*!
+        * @brief Indicates if queue has reached its size limitation
+        * @return true queue is full, false otherwise
+        *
+        * Const method
+        * Result is a snapshot which may be outdated if the other side is running.
+        *
+        */
+        bool full() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                         Overflow statistics                        ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Indicates number of elements dropped by overflow policy since queue creation
+        * @return Always 0, as push on a full queue throws an exception
+        *
+        * Const method
+        *
+        */
+        uint64_t droppedElementNb() const;
+
+        /*!
+        * @brief Indicates number of elements coalesced by overflow policy since queue creation
+        * @return Always 0, as push on a full queue throws an exception
+        *
+        * Const method
+        *
+        */
+        uint64_t coalescedElementNb() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                          Wait management                           ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Disable wait of elements in queue
+        *
+        * Disable wait for queue to contain element in pop method.
+        * Also unlocks waiting thread.
+        * Especially used during queue desctruction
+        *
+        */
+        void disableWait();
+
+        /*!
+        * @brief Enable wait for elements in queue
+        *
+        */
+        void enableWait();
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                               Clear                                ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Delete all elements in queue
+        *
+        * Consumes elements, so it must be called from the consumer thread or while no pop is running.
+        *
+        */
+        void clear();
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                                Push                                ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Push an element by copy
+        * @param element : Reference to the element to push to queue
+        *
+        * Push an element if queue is not full and wake up the consumer if it is waiting.
+        * If queue is full, throws an exception.
+        *
+        */
+        void push(const T& element);
+
+        /*!
+        * @brief Push an element using move semantics
+        * @param element : Reference to the element to push to queue
+        *
+        * Push an element if queue is not full and wake up the consumer if it is waiting.
+        * If queue is full, throws an exception. And element is not moved.
+        *
+        */
+        void push(T&& element);
+
+        /*!
+        * @brief Push several elements at once using move semantics
+        * @param elements : Elements to push to queue, in order. Cleared once elements are moved to queue.
+        *
+        * Push all elements, publishing producer index once, and wake up the consumer once.
+        * If queue cannot store all elements, throws an exception. And no element is moved.
+        *
+        */
+        void pushBatch(std::vector<T>& elements);
+
+        /*!
+        * @brief Try to push an element by copy
+        * @param element : Reference to the element to push to queue
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full
+        *
+        * Same as push, without exception when queue is full.
+        *
+        */
+        PushStatus tryPush(const T& element);
+
+        /*!
+        * @brief Try to push an element using move semantics
+        * @param element : Reference to the element to push to queue
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::FULL if queue is full. And element is not moved.
+        *
+        * Same as push, without exception when queue is full.
+        *
+        */
+        PushStatus tryPush(T&& element);
+
+        /*!
+        * @brief Push an element by copy, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled
+        *
+        * Consumer does not signal freed room so that pop stays lock-free. Producer polls queue, yielding then sleeping between attempts.
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout);
+
+        /*!
+        * @brief Push an element using move semantics, waiting at most timeout for queue to have room
+        * @param element : Reference to the element to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled. And element is not moved.
+        *
+        * Consumer does not signal freed room so that pop stays lock-free. Producer polls queue, yielding then sleeping between attempts.
+        *
+        */
+        template<class Rep, class Period>
+        PushStatus pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout);
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                                Pop                                 ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        /*!
+        * @brief Pop an element by copy
+        * @param element : Reference to the element to copy queue head to
+        *
+        * Wait for an element to be available in queue then copy it to argument and remove it from queue.
+        * Calling to pop locks current thread until an element has been pushed to queue.
+        *
+        */
+        void pop(T& element);
+
+        /*!
+        * @brief Pop several elements at once
+        * @param max_element_nb : Maximum number of elements to pop. 0 indicates all available elements.
+        * @param elements : Vector popped elements are appended to, in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move up to max_element_nb elements to argument, publishing consumer index once.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popUpTo(size_t max_element_nb, std::vector<T>& elements);
+
+        /*!
+        * @brief Pop all available elements at once
+        * @param elements : Vector popped elements are appended to, in queue order
+        * @return Number of popped elements
+        *
+        * Wait for at least one element to be available in queue then move all available elements to argument, publishing consumer index once.
+        * Returns 0 without modifying argument if wait is disabled.
+        *
+        */
+        size_t popAll(std::vector<T>& elements);
+
+    private:
+        /*! @typedef Slot
+        *  @brief Uninitialized storage of an element
+        */
+        using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+        /*!
+        * @brief Get slot associated with an index
+        * @param index : Monotonic index of an element
+        * @return Pointer to storage of the element
+        *
+        */
+        T* slot(size_t index);
+
+        /*!
+        * @brief Reserve next slot for producer
+        * @return Pointer to storage of the element to construct. nullptr if queue is full.
+        *
+        */
+        T* reserve();
+
+        /*!
+        * @brief Publish elements constructed in reserved slots and wake up consumer if needed
+        * @param element_nb : Number of constructed elements
+        *
+        */
+        void publish(size_t element_nb);
+
+        /*!
+        * @brief Take front element if any
+        * @param element : Reference to the element to move queue head to
+        * @return true if an element was taken, false if queue is empty
+        *
+        */
+        bool tryTake(T& element);
+
+        /*!
+        * @brief Take up to max_element_nb front elements
+        * @param max_element_nb : Maximum number of elements to take. 0 indicates all available elements.
+        * @param elements : Vector taken elements are appended to
+        * @return Number of taken elements
+        *
+        */
+        size_t takeUpTo(size_t max_element_nb, std::vector<T>& elements);
+
+        /*!
+        * @brief Park consumer until queue is not empty or wait is disabled
+        *
+        */
+        void waitContent();
+
+        const size_t m_max_element_nb; /*!< Maximum size of the queue.*/
+        const size_t m_mask; /*!< Mask converting monotonic indexes to ring buffer positions. Ring buffer size is a power of two.*/
+        std::vector<Slot> m_slots; /*!< Elements storage.*/
+
+        std::atomic<size_t> m_head; /*!< Index of next element to pop. Written by consumer only.*/
+        size_t m_cached_tail; /*!< Consumer copy of m_tail, refreshed only when queue looks empty.*/
+        char m_consumer_padding[64]; /*!< Padding keeping consumer data away from producer data.*/
+
+        std::atomic<size_t> m_tail; /*!< Index of next element to push. Written by producer only.*/
+        size_t m_cached_head; /*!< Producer copy of m_head, refreshed only when queue looks full.*/
+        char m_producer_padding[64]; /*!< Padding keeping producer data away from wait control data.*/
+
+        std::mutex m_wait_mutex; /*!< Mutex used to park consumer.*/
+        std::condition_variable m_control_content; /*!< Condition variable used to wait for data in the queue.*/
+        std::atomic<bool> m_consumer_waiting; /*!< Flag indicating that consumer is parked or about to be, so producer must notify it.*/
+
+        std::atomic<bool> m_wait_disabled; /*!< Flag indicating that waiting for elements is disabled (ex: when queue is deleted). Waiting thread must be notified and no thread can wait any longer. */
+
+        /*!
+        * @brief Poll queue until element is pushed, timeout expires or wait is disabled
+        * @param element : Element to push, forwarded to tryPush. Only moved once pushed.
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if element was pushed, PushStatus::TIMEOUT otherwise
+        *
+        */
+        template<class U, class Rep, class Period>
+        PushStatus pollPush(U&& element, const std::chrono::duration<Rep, Period>& timeout);
+    };
+}
+
+#include "dwfspscqueue.tpp"
+
+#endif //DWF_SPSC_QUEUE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,461 @@
+/*!
+ * @file dwfspscqueue.tpp
+ * @brief Class defining a lock-free single producer single consumer queue.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class defining a bounded lock-free ring buffer for one producer thread and one consumer thread.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfspscqueue.h"
+#include <stdexcept>
+#include <new>
+#include <thread>
+#include <algorithm>
+
+namespace DwfContainers
+{
+    /*!
+    * @brief Round a size to the next power of two
+    * @param size : size to round
+    * @return Smallest power of two greater or equal to size
+    *
+    */
+    inline size_t nextPowerOfTwo(size_t size)
+    {
+        size_t power = 1u;
+        while(power < size)
+        {
+            power <<= 1u;
+        }
+        return power;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     Constructors and Destructor                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    DwfSpscQueue<T>::DwfSpscQueue(size_t max_element_nb) : m_max_element_nb(max_element_nb), m_mask(nextPowerOfTwo(max_element_nb) - 1u), m_slots(),
+        m_head(0u), m_cached_tail(0u), m_tail(0u), m_cached_head(0u), m_consumer_waiting(false), m_wait_disabled(false)
+    {
+        if(max_element_nb == 0u)
+        {
+            throw std::invalid_argument("Lock-free queue must be size limited");
+        }
+        m_slots.resize(m_mask + 1u);
+    }
+
+    template<class T>
+    DwfSpscQueue<T>::~DwfSpscQueue()
+    {
+        disableWait();
+        clear();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            Size Getters                            ///
+    ///                                                                    ///
+    /////////////////////////////////////////////////////////////////////////
+    template<class T>
+    bool DwfSpscQueue<T>::empty() const
+    {
+        return size() == 0u;
+    }
+
+    template<class T>
+    size_t DwfSpscQueue<T>::size() const
+    {
+        const size_t head = m_head.load(std::memory_order_acquire);
+        return m_tail.load(std::memory_order_acquire) - head;
+    }
+
+    template<class T>
+    bool DwfSpscQueue<T>::full() const
+    {
+        return size() >= m_max_element_nb;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         Overflow statistics                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    uint64_t DwfSpscQueue<T>::droppedElementNb() const
+    {
+        return 0u;
+    }
+
+    template<class T>
+    uint64_t DwfSpscQueue<T>::coalescedElementNb() const
+    {
+        return 0u;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          Wait management                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfSpscQueue<T>::disableWait()
+    {
+        m_wait_disabled=true;
+        std::lock_guard<std::mutex> waitlock(m_wait_mutex); // Consumer is either not waiting yet or already waiting when we notify
+        m_control_content.notify_all(); // For waiting thread to exit waiting state
+    }
+
+    template<class T>
+    void DwfSpscQueue<T>::enableWait()
+    {
+        m_wait_disabled=false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               Clear                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfSpscQueue<T>::clear()
+    {
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        size_t head = m_head.load(std::memory_order_relaxed);
+        for(; head != tail; ++head)
+        {
+            slot(head)->~T();
+        }
+        m_cached_tail = tail;
+        m_head.store(head, std::memory_order_release);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Push                                ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfSpscQueue<T>::push(const T& element)
+    {
+        if(tryPush(element) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T>
+    void DwfSpscQueue<T>::push(T&& element)
+    {
+        if(tryPush(std::move(element)) == PushStatus::FULL)
+        {
+            throw std::runtime_error("Queue is full. Cannot add element");
+        }
+    }
+
+    template<class T>
+    PushStatus DwfSpscQueue<T>::tryPush(const T& element)
+    {
+        T* free_slot = reserve();
+        if(free_slot == nullptr)
+        {
+            return PushStatus::FULL;
+        }
+        new (free_slot) T(element);
+        publish(1u);
+        return PushStatus::PUSHED;
+    }
+
+    template<class T>
+    PushStatus DwfSpscQueue<T>::tryPush(T&& element)
+    {
+        T* free_slot = reserve();
+        if(free_slot == nullptr)
+        {
+            return PushStatus::FULL;
+        }
+        new (free_slot) T(std::move(element));
+        publish(1u);
+        return PushStatus::PUSHED;
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfSpscQueue<T>::pushFor(const T& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return pollPush(element, timeout);
+    }
+
+    template<class T>
+    template<class Rep, class Period>
+    PushStatus DwfSpscQueue<T>::pushFor(T&& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return pollPush(std::move(element), timeout);
+    }
+
+    template<class T>
+    void DwfSpscQueue<T>::pushBatch(std::vector<T>& elements)
+    {
+        if(elements.empty())
+        {
+            return;
+        }
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if(tail + elements.size() - m_cached_head > m_max_element_nb) // Looks full, refresh consumer index
+        {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            if(tail + elements.size() - m_cached_head > m_max_element_nb)
+            {
+                throw std::runtime_error("Queue is full. Cannot add elements");
+            }
+        }
+        for(size_t i = 0u; i < elements.size(); ++i)
+        {
+            new (slot(tail + i)) T(std::move(elements[i]));
+        }
+        publish(elements.size());
+        elements.clear();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                                Pop                                 ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    void DwfSpscQueue<T>::pop(T& element)
+    {
+        while(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            if(tryTake(element))
+            {
+                return;
+            }
+            waitContent();
+        }
+    }
+
+    template<class T>
+    size_t DwfSpscQueue<T>::popUpTo(size_t max_element_nb, std::vector<T>& elements)
+    {
+        while(!m_wait_disabled) // Do nothing if we disabled wait
+        {
+            const size_t popped_nb = takeUpTo(max_element_nb, elements);
+            if(popped_nb > 0u)
+            {
+                return popped_nb;
+            }
+            waitContent();
+        }
+        return 0u;
+    }
+
+    template<class T>
+    size_t DwfSpscQueue<T>::popAll(std::vector<T>& elements)
+    {
+        return popUpTo(0u, elements);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              Internals                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    template<class T>
+    T* DwfSpscQueue<T>::slot(size_t index)
+    {
+        return reinterpret_cast<T*>(&m_slots[index & m_mask]);
+    }
+
+    template<class T>
+    T* DwfSpscQueue<T>::reserve()
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if(tail - m_cached_head >= m_max_element_nb) // Looks full, refresh consumer index
+        {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            if(tail - m_cached_head >= m_max_element_nb)
+            {
+                return nullptr;
+            }
+        }
+        return slot(tail);
+    }
+
+    template<class T>
+    void DwfSpscQueue<T>::publish(size_t element_nb)
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + element_nb); // Sequentially consistent with consumer waiting flag
+        if(m_consumer_waiting.load())
+        {
+            std::lock_guard<std::mutex> waitlock(m_wait_mutex); // Consumer is either checking queue content or waiting when we notify
+            m_control_content.notify_one();
+        }
+    }
+
+    template<class T>
+    size_t DwfSpscQueue<T>::takeUpTo(size_t max_element_nb, std::vector<T>& elements)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+        size_t popped_nb = m_cached_tail - head;
+        if(max_element_nb != 0u && popped_nb > max_element_nb)
+        {
+            popped_nb = max_element_nb;
+        }
+        for(size_t index = head; index != head + popped_nb; ++index)
+        {
+            T* front = slot(index);
+            elements.push_back(std::move(*front));
+            front->~T();
+        }
+        m_head.store(head + popped_nb, std::memory_order_release); // Slots are given back to producer all at once
+        return popped_nb;
+    }
+
+    template<class T>
+    void DwfSpscQueue<T>::waitContent()
+    {
+        // Queue is empty, park until producer publishes an element or wait is disabled
+        std::unique_lock<std::mutex> waitlock(m_wait_mutex);
+        m_consumer_waiting.store(true); // Sequentially consistent with tail publication so either producer sees us waiting or we see its element
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        m_control_content.wait(waitlock, [this, head](){return m_tail.load() != head || m_wait_disabled;}); // Only exit wait if queue is not empty or if deletion has been requested
+        m_consumer_waiting.store(false, std::memory_order_relaxed);
+    }
+
+    template<class T>
+    bool DwfSpscQueue<T>::tryTake(T& element)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if(head == m_cached_tail) // Looks empty, refresh producer index
+        {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+            if(head == m_cached_tail)
+            {
+                return false;
+            }
+        }
+        T* front = slot(head);
+        element = std::move(*front);
+        front->~T();
+        m_head.store(head + 1u, std::memory_order_release);
+        return true;
+    }
+
+    template<class T>
+    template<class U, class Rep, class Period>
+    PushStatus DwfSpscQueue<T>::pollPush(U&& element, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        static const uint32_t C_YIELD_NB = 64u; // Attempts separated by a yield before sleeping between attempts
+        static const std::chrono::microseconds C_MAX_SLEEP(50); // Bounds latency added once room is freed
+
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        uint32_t attempt_nb = 0u;
+        while(tryPush(std::forward<U>(element)) == PushStatus::FULL) // Element is only moved once pushed
+        {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if(m_wait_disabled || now >= deadline)
+            {
+                return PushStatus::TIMEOUT;
+            }
+            if(attempt_nb < C_YIELD_NB)
+            {
+                ++attempt_nb;
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(C_MAX_SLEEP, deadline - now));
+            }
+        }
+        return PushStatus::PUSHED;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
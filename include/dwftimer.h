@@ -72,12 +72,13 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #ifndef DWF_TIMER_H
 #define DWF_TIMER_H
 
+#include "dwftimerservice.h"
+#include "dwftimerhandle.h"
+#include "overrunpolicy.h"
 #include <chrono>
 #include <atomic>
 #include <functional>
 #include <thread>
-#include <condition_variable>
-#include <mutex>
 
 /*!
 * @namespace DwfTime
@@ -91,7 +92,8 @@ namespace DwfTime
     * Timer can be either single-shot or periodic.
     * Class also allows to statically start a single shot timer.
     * Interface is freely based on QTimer : https://doc.qt.io/qt-5/qtimer.html
-    * Timeout is waited using a condition variable so that it can be interrupted with minimal time loss (i.e. without having to wait for wait to complete).
+    * Timeouts of all timers are waited by the worker threads of DwfTimerService, so that timers do not need a dedicated thread each.
+    * Timeout function is called in one of these workers. Functions running long delay other timers only if all workers are busy.
     *
     */
     class DwfTimer
@@ -111,15 +113,16 @@ namespace DwfTime
         * @brief Start a single shot timer
         * @param timer_duration : duration of timer before timeout
         * @param called_on_timeout : call to perform on timeout
+        * @return Handle allowing to cancel timeout. Can be ignored.
         *
         * Service if you need to delay call of a function by a certain duration.
-        * Timer cannot be stopped.
-        * Function is not called in a new thread, but you can detach it in another thread.
+        * Returns immediately : function is called by a DwfTimerService worker, so that calling thread, for instance an event processing thread, is not blocked.
+        * Single shot timers are scheduled without any thread creation, so thousands of them can be started per second.
         * Static method.
         *
         */
         template< class Rep, class Period >
-        static void startSingleShot(const std::chrono::duration<Rep,Period>& timer_duration, TimeoutFunction called_on_timeout);
+        static DwfTimerHandle startSingleShot(const std::chrono::duration<Rep,Period>& timer_duration, TimeoutFunction called_on_timeout);
 
         //////////////////////////////////////////////////////////////////////////
         ///                                                                    ///
@@ -128,17 +131,19 @@ namespace DwfTime
         //////////////////////////////////////////////////////////////////////////
         /*!
         * @brief Constructor of DwfTimer class
+        * @param backend : Way timeouts are waited. TimerBackend::TIMERFD lowers jitter of high rate periodic timers on Linux. Default is portable condition variable backend.
         *
         * Constructor of the DwfTimer class.
         * Default constructed timer is a not started, single shot timer with an execution period of 0 (i.e. function is called instantly) and no timeout function to call.
+        * Timer is serviced by the shared DwfTimerService of backend.
         *
         */
-        DwfTimer();
+        explicit DwfTimer(TimerBackend backend = TimerBackend::CONDITION_VARIABLE);
 
         /*!
         * @brief Destructor of DwfTimer class
         *
-        * Stop timer thread if launched.
+        * Stop timer if started then remove its task from DwfTimerService.
         *
         */
         ~DwfTimer();
@@ -179,6 +184,16 @@ namespace DwfTime
         template< class Rep, class Period >
         void setPeriod(const std::chrono::duration<Rep,Period>& timer_period);
 
+        /*!
+        * @brief Set behavior of a periodic timer when it misses deadlines
+        * @param overrun_policy : behavior when deadlines pass while timeout function is still running. Default is OverrunPolicy::FIRE_IMMEDIATELY.
+        *
+        * Deadlines of a periodic timer are start time plus a whole number of periods, whatever the duration of timeout function.
+        * Can only be set if timer is not running.
+        *
+        */
+        void setOverrunPolicy(OverrunPolicy overrun_policy);
+
         //////////////////////////////////////////////////////////////////////////
         ///                                                                    ///
         ///                              Getters                               ///
@@ -193,6 +208,24 @@ namespace DwfTime
         */
         bool isStarted() const;
 
+        /*!
+        * @brief Get timer period or duration
+        * @return Period of a periodic timer or duration of a single shot timer, in microseconds
+        *
+        * Constant method.
+        *
+        */
+        std::chrono::microseconds period() const;
+
+        /*!
+        * @brief Get number of deadlines a periodic timer missed
+        * @return Number of deadlines passed while timeout function was still running, since timer was last started
+        *
+        * Constant method.
+        *
+        */
+        uint64_t missedDeadlineNb() const;
+
         //////////////////////////////////////////////////////////////////////////
         ///                                                                    ///
         ///                           Start and Stop                           ///
@@ -201,7 +234,7 @@ namespace DwfTime
         /*!
         * @brief Start timer or restart timer
         *
-        * Start timer in a dedicated thread.
+        * Arm timer task in DwfTimerService. Neither a thread nor memory is allocated, so that timers can be restarted at high rate.
         * If timer is running, it is stopped before being restarted.
         *
         */
@@ -210,16 +243,21 @@ namespace DwfTime
         /*!
         * @brief Stop timer
         *
-        * Stop timer and join wait thread.
+        * Stop timer. If timeout function is running, waits for it to return, unless stop is called from timeout function itself.
         *
         */
         void stop();
 
     private:
         /*!
-        * @brief Function used to wait for timer timeout and execute desired function
+        * @brief Function called by DwfTimerService on timer timeout
+        *
+        * Mark single shot timers as stopped then execute desired function.
+        *
         */
-        void waitTimeout();
+        void onTimeout();
+
+        DwfTimerService& m_service; /*!< Service waiting for timer timeouts. Obtained on construction so that it outlives timers with static storage duration.*/
 
         std::atomic<bool> m_started; /*!< Flag indicating if timer has been started.*/
 
@@ -229,18 +267,16 @@ namespace DwfTime
 
         std::chrono::microseconds m_timer_period; /*!< Timer period in microseconds.*/
 
-        mutable std::mutex m_cv_mutex; /*!< Mutex protecting the condition variable. */
-
-        std::condition_variable m_timeout_wait; /*!< Condition variable used to wait for timeout. */
+        OverrunPolicy m_overrun_policy; /*!< Behavior of periodic timer when deadlines are missed.*/
 
-        std::thread m_wait_thread; /*!< Thread in which wait and called function are to be executed. */
+        const DwfTimerService::TaskID m_task; /*!< Task of the timer in service, armed while timer is started. Kept from one start to the other.*/
     };
 
     template< class Rep, class Period >
-    void DwfTimer::startSingleShot(const std::chrono::duration<Rep, Period>& timer_duration, TimeoutFunction called_on_timeout)
+    DwfTimerHandle DwfTimer::startSingleShot(const std::chrono::duration<Rep, Period>& timer_duration, TimeoutFunction called_on_timeout)
     {
-        std::this_thread::sleep_for(timer_duration);
-        called_on_timeout();
+        DwfTimerService& service = DwfTimerService::instance();
+        return DwfTimerHandle(service, service.schedule(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timer_duration), std::move(called_on_timeout)));
     }
 
     template< class Rep, class Period >
@@ -0,0 +1,157 @@
+/*!
+ * @file dwftimerhandle.h
+ * @brief Handle on a timeout scheduled in DwfTimerService
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Handle returned by DwfTimer::startSingleShot, allowing to cancel timeout before it happens.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_TIMER_HANDLE_H
+#define DWF_TIMER_HANDLE_H
+
+#include "dwftimerservice.h"
+
+/*!
+* @namespace DwfTime
+* @brief A namespace used to regroup all elements related to time management
+*/
+namespace DwfTime
+{
+    /*! @class DwfTimerHandle
+    * @brief Handle on a timeout scheduled in DwfTimerService
+    *
+    * Lightweight copyable reference to a service task. Destroying a handle does not cancel timeout, so that it can be ignored by fire and forget callers.
+    * Default constructed handle refers to no task.
+    *
+    */
+    class DwfTimerHandle
+    {
+    public:
+        /*!
+        * @brief Constructor of DwfTimerHandle class
+        *
+        * Constructor of a handle referring to no task.
+        *
+        */
+        DwfTimerHandle();
+
+        /*!
+        * @brief Constructor of DwfTimerHandle class
+        * @param service : Service the task is scheduled in
+        * @param task : ID of the task
+        *
+        */
+        DwfTimerHandle(DwfTimerService& service, DwfTimerService::TaskID task);
+
+        /*!
+        * @brief Cancel timeout
+        * @return true if timeout was cancelled before its function was called, false if function was already called or handle refers to no task
+        *
+        * If timeout function is running, waits for it to return unless called from the function itself, and returns false.
+        *
+        */
+        bool cancel();
+
+        /*!
+        * @brief Indicates whether timeout is still to come
+        * @return true if timeout function was neither called nor cancelled, false otherwise
+        *
+        * Constant method.
+        *
+        */
+        bool isPending() const;
+
+    private:
+        DwfTimerService* m_service; /*!< Service the task is scheduled in. nullptr if handle refers to no task.*/
+
+        DwfTimerService::TaskID m_task; /*!< ID of the task.*/
+    };
+}
+
+#endif //DWF_TIMER_HANDLE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,484 @@
+/*!
+ * @file dwftimerservice.h
+ * @brief Class scheduling timeouts of all timers on a small pool of threads.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class scheduling timeout functions on a fixed number of worker threads, whatever the number of timers.
+ * Used by DwfTimer so that each timer does not need a dedicated thread.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_TIMER_SERVICE_H
+#define DWF_TIMER_SERVICE_H
+
+#include "overrunpolicy.h"
+#include "timerbackend.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*!
+* @namespace DwfTime
+* @brief A namespace used to regroup all elements related to time management
+*/
+namespace DwfTime
+{
+    /*! @class DwfTimerService
+    * @brief Class scheduling timeouts of all timers on a small pool of threads
+    *
+    * Timeouts are stored in a min-heap of deadlines shared by a fixed number of worker threads.
+    * Workers wait for the earliest deadline with a condition variable, so that adding an earlier timeout wakes them up.
+    * With TimerBackend::TIMERFD, a single worker waits for it in an epoll loop on a timerfd instead, and adding an earlier timeout reprograms the timerfd.
+    * Other workers then wait on the condition variable until a worker is needed to run a task or to take over the wait.
+    * A task is never run by two workers at once. A worker about to run a task wakes another one up if deadlines remain,
+    * so that tasks running long delay other timeouts only if all workers are busy.
+    * Tasks created with createTask are kept until cancelled, so that they can be armed again and again without any allocation.
+    * Cancelling, disarming or re-arming a task is O(1) : its pending deadline is discarded when it expires.
+    * Thread safe.
+    *
+    */
+    class DwfTimerService
+    {
+    public:
+        /*! @typedef TaskFunction
+        *  @brief Signature of a function to call on timeout
+        */
+        using TaskFunction = std::function<void(void)>;
+
+        /*! @typedef TaskID
+        *  @brief ID identifying a task. IDs are never reused.
+        */
+        using TaskID = uint64_t;
+
+        static const TaskID C_NO_TASK; /*!< ID never given to a task.*/
+
+        static const size_t C_SHARED_WORKER_NB; /*!< Number of worker threads of each shared service.*/
+
+        /*!
+        * @brief Get service shared by all DwfTimer using a backend
+        * @param backend : Way service waits for deadlines. Default is portable condition variable backend.
+        * @return Shared service of the backend
+        *
+        * Service of each backend is created on first call, with C_SHARED_WORKER_NB workers whatever the number of hardware threads, as timeout functions are expected to be short.
+        * Create a dedicated DwfTimerService for timers needing more workers.
+        * Static method.
+        *
+        */
+        static DwfTimerService& instance(TimerBackend backend = TimerBackend::CONDITION_VARIABLE);
+
+        /*!
+        * @brief Constructor of DwfTimerService class
+        * @param worker_nb : Number of worker threads running tasks. 0 is replaced by 1.
+        * @param backend : Way service waits for deadlines. Default is portable condition variable backend.
+        *
+        * Spawns worker threads.
+        * Throws std::invalid_argument if backend is not available on this platform, std::system_error if its file descriptors cannot be created.
+        *
+        */
+        explicit DwfTimerService(size_t worker_nb, TimerBackend backend = TimerBackend::CONDITION_VARIABLE);
+
+        /*!
+        * @brief Destructor of DwfTimerService class
+        *
+        * Joins worker threads once running tasks have returned. Pending tasks are never run.
+        *
+        */
+        ~DwfTimerService();
+
+        DwfTimerService(const DwfTimerService&) = delete;
+        DwfTimerService& operator=(const DwfTimerService&) = delete;
+
+        /*!
+        * @brief Schedule a single shot task
+        * @param deadline : Time of the call of task function
+        * @param task_function : Function to call on timeout
+        * @return ID of the task, used to cancel it
+        *
+        * Task is removed once called.
+        *
+        */
+        TaskID schedule(std::chrono::steady_clock::time_point deadline, TaskFunction task_function);
+
+        /*!
+        * @brief Schedule a periodic task
+        * @param deadline : Time of the first call of task function
+        * @param period : Period of following calls
+        * @param overrun_policy : Behavior when deadlines pass before task function can be called
+        * @param task_function : Function to call on timeout
+        * @return ID of the task, used to cancel it
+        *
+        * Following deadlines are the first one plus a whole number of periods, so that delays of calls do not accumulate.
+        *
+        */
+        TaskID schedulePeriodic(std::chrono::steady_clock::time_point deadline, std::chrono::microseconds period, OverrunPolicy overrun_policy, TaskFunction task_function);
+
+        /*!
+        * @brief Create a task kept until cancelled
+        * @param task_function : Function to call on timeout
+        * @return ID of the task, used to arm, disarm and cancel it
+        *
+        * Task is created disarmed. It stays registered once disarmed or once called as a single shot task.
+        *
+        */
+        TaskID createTask(TaskFunction task_function);
+
+        /*!
+        * @brief Arm a task created by createTask as a single shot task
+        * @param task : ID of the task
+        * @param deadline : Time of the call of task function
+        * @return true if task was armed, false if it does not exist
+        *
+        * Replaces previous deadlines of task. If task function is running, waits for it to return, unless arm is called from task function itself.
+        *
+        */
+        bool arm(TaskID task, std::chrono::steady_clock::time_point deadline);
+
+        /*!
+        * @brief Arm a task created by createTask as a periodic task
+        * @param task : ID of the task
+        * @param deadline : Time of the first call of task function
+        * @param period : Period of following calls
+        * @param overrun_policy : Behavior when deadlines pass before task function can be called
+        * @return true if task was armed, false if it does not exist
+        *
+        * Replaces previous deadlines of task and resets its missed deadlines count.
+        * If task function is running, waits for it to return, unless arm is called from task function itself.
+        *
+        */
+        bool armPeriodic(TaskID task, std::chrono::steady_clock::time_point deadline, std::chrono::microseconds period, OverrunPolicy overrun_policy);
+
+        /*!
+        * @brief Disarm a task without removing it
+        * @param task : ID of the task
+        * @return true if task was armed, false if it was disarmed or does not exist
+        *
+        * If task function is running, waits for it to return, unless disarm is called from task function itself.
+        * Task function is not called once disarm returns, until task is armed again.
+        *
+        */
+        bool disarm(TaskID task);
+
+        /*!
+        * @brief Cancel a task
+        * @param task : ID of the task to cancel
+        * @return true if task existed, false if it was already cancelled or if it was a scheduled single shot task already called
+        *
+        * Removes task, whether it is armed or not.
+        * If task function is running, waits for it to return, unless cancel is called from task function itself.
+        * Task function is not called once cancel returns.
+        *
+        */
+        bool cancel(TaskID task);
+
+        /*!
+        * @brief Get number of armed tasks
+        * @return Number of tasks waiting for a deadline
+        *
+        * Constant method.
+        *
+        */
+        size_t taskNb() const;
+
+        /*!
+        * @brief Get number of deadlines a periodic task missed
+        * @param task : ID of the task
+        * @return Number of deadlines passed while task function was still running or waiting for a worker, since task was last armed. 0 if task does not exist.
+        *
+        * Missed deadlines are counted whatever the overrun policy, including the ones called late by OverrunPolicy::CATCH_UP.
+        * Constant method.
+        *
+        */
+        uint64_t missedDeadlineNb(TaskID task) const;
+
+        /*!
+        * @brief Indicates whether a task waits for a deadline
+        * @param task : ID of the task
+        * @return true if task is armed and not cancelled, false otherwise. Single shot tasks are no longer armed once their function is called.
+        *
+        * Constant method.
+        *
+        */
+        bool isArmed(TaskID task) const;
+
+        /*!
+        * @brief Get number of worker threads
+        * @return Number of worker threads
+        *
+        * Constant method.
+        *
+        */
+        size_t workerNb() const;
+
+        /*!
+        * @brief Get way service waits for deadlines
+        * @return Backend of the service
+        *
+        * Constant method.
+        *
+        */
+        TimerBackend backend() const;
+
+    private:
+        /*! @struct Task
+        *  @brief Task registered in service
+        */
+        struct Task
+        {
+            TaskFunction task_function; /*!< Function to call on timeout.*/
+            bool persistent; /*!< Flag indicating task is kept until cancelled.*/
+            bool armed; /*!< Flag indicating task waits for a deadline.*/
+            uint64_t generation; /*!< Incremented each time task is armed or disarmed, so that workers notice it was done by task function.*/
+            std::chrono::steady_clock::time_point armed_deadline; /*!< Next call of task while it is armed.*/
+            bool queued; /*!< Flag indicating a deadline of task is in heap.*/
+            std::chrono::steady_clock::time_point queued_deadline; /*!< Time of the deadline of task in heap. Can be earlier than armed deadline, worker then queues armed deadline when reaching it.*/
+            uint64_t queue_generation; /*!< Incremented each time a deadline of task is added to heap, so that previous ones are discarded.*/
+            bool periodic; /*!< Flag indicating task is called periodically.*/
+            std::chrono::microseconds period; /*!< Period of calls of periodic tasks.*/
+            OverrunPolicy overrun_policy; /*!< Behavior of periodic tasks when deadlines are missed.*/
+            uint64_t missed_deadline_nb; /*!< Number of missed deadlines.*/
+            std::chrono::steady_clock::time_point counted_until; /*!< Latest missed deadline counted, so that deadlines called late are counted once.*/
+            std::thread::id running_thread; /*!< Worker running task function. Default id if it is not running.*/
+            bool awaited; /*!< Flag indicating a thread waits for task function to return.*/
+            bool cancelled; /*!< Flag indicating task was cancelled while its function was running.*/
+        };
+
+        /*! @struct Deadline
+        *  @brief Next call of a task, element of deadline heap
+        */
+        struct Deadline
+        {
+            std::chrono::steady_clock::time_point time; /*!< Time of the call.*/
+            TaskID task; /*!< Task to call.*/
+            uint64_t generation; /*!< Queue generation of task when deadline was added. Deadline is discarded if another one was added since.*/
+
+            /*!
+            * @brief Order deadlines so that the earliest is at the top of the heap
+            * @param other : deadline to compare to
+            * @return true if this deadline is later than other
+            *
+            */
+            bool operator>(const Deadline& other) const
+            {
+                return time > other.time;
+            }
+        };
+
+        mutable std::mutex m_mutex; /*!< Mutex protecting tasks and deadlines.*/
+
+        std::condition_variable m_deadline_changed; /*!< Condition variable notified when earliest deadline changes or when service stops.*/
+
+        std::condition_variable m_task_done; /*!< Condition variable notified when an awaited task function returns.*/
+
+        std::unordered_map<TaskID, Task> m_tasks; /*!< Registered tasks.*/
+
+        std::vector<Deadline> m_deadlines; /*!< Min-heap of next calls. Deadlines of cancelled, disarmed or re-armed tasks are discarded when reached.*/
+
+        TaskID m_next_task; /*!< ID given to next created task.*/
+
+        bool m_running; /*!< Flag indicating whether workers should keep running.*/
+
+        const TimerBackend m_backend; /*!< Way service waits for deadlines.*/
+
+        int m_epoll_fd; /*!< Epoll instance waiting on timer and wake-up file descriptors. -1 with condition variable backend.*/
+
+        int m_timer_fd; /*!< Timerfd armed with the earliest deadline while a worker waits in epoll. -1 with condition variable backend.*/
+
+        int m_wake_fd; /*!< Eventfd waking worker waiting in epoll when service stops. -1 with condition variable backend.*/
+
+        bool m_deadline_waited; /*!< Flag indicating a worker waits in epoll for the earliest deadline.*/
+
+        std::vector<std::thread> m_workers; /*!< Worker threads.*/
+
+        /*!
+        * @brief Wait for deadlines and run task functions until service stops
+        *
+        * Method run in worker threads.
+        *
+        */
+        void runWorker();
+
+        /*!
+        * @brief Wait until a deadline, or until earliest deadline changes or service stops
+        * @param lock : Lock on m_mutex, released while waiting
+        * @param deadline : Earliest deadline
+        *
+        * With timerfd backend, only one worker waits in epoll. Others wait on m_deadline_changed until notified.
+        *
+        */
+        void waitDeadline(std::unique_lock<std::mutex>& lock, std::chrono::steady_clock::time_point deadline);
+
+        /*!
+        * @brief Create epoll, timerfd and eventfd file descriptors of timerfd backend
+        *
+        * Throws std::invalid_argument if timerfd is not available, std::system_error if a file descriptor cannot be created.
+        *
+        */
+        void openTimerFd();
+
+        /*!
+        * @brief Close file descriptors of timerfd backend
+        *
+        */
+        void closeTimerFd();
+
+        /*!
+        * @brief Arm timerfd with an absolute deadline
+        * @param deadline : Time of expiration. steady_clock is CLOCK_MONOTONIC on Linux.
+        *
+        */
+        void setTimerFd(std::chrono::steady_clock::time_point deadline);
+
+        /*!
+        * @brief Register a task
+        * @param task_function : Function to call on timeout
+        * @param persistent : true if task is kept until cancelled
+        * @return ID of the task
+        *
+        * Must be called with m_mutex locked.
+        *
+        */
+        TaskID addTask(TaskFunction&& task_function, bool persistent);
+
+        /*!
+        * @brief Wait for function of a task to return, unless it runs in calling thread
+        * @param lock : Lock of m_mutex held by caller
+        * @param task : ID of the task
+        * @return Iterator to the task, end of task map if it does not exist or was cancelled meanwhile
+        *
+        */
+        std::unordered_map<TaskID, Task>::iterator waitTaskFunction(std::unique_lock<std::mutex>& lock, TaskID task);
+
+        /*!
+        * @brief Arm a task and add its first deadline
+        * @param task : Task to arm
+        * @param id : ID of the task
+        * @param deadline : Time of the first call of task function
+        * @param periodic : true if task is called periodically
+        * @param period : Period of calls of periodic tasks
+        * @param overrun_policy : Behavior of periodic tasks when deadlines are missed
+        *
+        * If task function is running in calling thread, deadline is added once it returns.
+        * No deadline is added if task already has an earlier one in heap, so that restarting a timer many times does not fill heap with discarded deadlines.
+        * Must be called with m_mutex locked.
+        *
+        */
+        void armTask(Task& task, TaskID id, std::chrono::steady_clock::time_point deadline, bool periodic, std::chrono::microseconds period, OverrunPolicy overrun_policy);
+
+        /*!
+        * @brief Compute next deadline of a periodic task once its function returned
+        * @param task : Task whose function returned
+        * @param deadline : Deadline of the call that returned
+        * @return Next deadline of task
+        *
+        * Applies task overrun policy and counts missed deadlines.
+        * Must be called with m_mutex locked.
+        * Static method.
+        *
+        */
+        static std::chrono::steady_clock::time_point nextDeadline(Task& task, std::chrono::steady_clock::time_point deadline);
+
+        /*!
+        * @brief Add a deadline of a task to heap, waking a worker if it becomes the earliest
+        * @param task : Task to call
+        * @param id : ID of the task
+        * @param deadline : Time of the call
+        *
+        * Previous deadline of task in heap is discarded.
+        * Must be called with m_mutex locked.
+        *
+        */
+        void pushDeadline(Task& task, TaskID id, std::chrono::steady_clock::time_point deadline);
+    };
+}
+
+#endif //DWF_TIMER_SERVICE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,254 @@
+/*!
+ * @file dwfvalueevent.h
+ * @brief Definition of events stored by value.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Definition of events made of an EventID and a small fixed size payload, copied into event queues instead of being allocated.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_VALUE_EVENT_H
+#define DWF_VALUE_EVENT_H
+
+#include "dwfevent.h"
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+/*!
+* @namespace EventSystem
+* @brief A namespace used to regroup all elements related to envent processing systems
+*/
+namespace EventSystem
+{
+    /*! @class DwfValueEvent
+    * @brief Event made of an EventID and a payload of at most C_PAYLOAD_SIZE bytes
+    *
+    * Trivially copyable so that it can be stored inline in event queues, without any allocation.
+    * Payload can be any trivially copyable type fitting in C_PAYLOAD_SIZE bytes. It is copied in and out of the event.
+    * Use DwfPayloadEvent for larger or non trivially copyable data.
+    *
+    */
+    class DwfValueEvent
+    {
+    public:
+        static const size_t C_PAYLOAD_SIZE = 24u; /*!< Maximum size of the payload.*/
+
+        /*!
+        * @brief Constructor of the DwfValueEvent class
+        * @param id : Value of the event id.
+        *
+        * Event has no payload.
+        *
+        */
+        DwfValueEvent(EventID id) : m_id(id), m_payload_size(0u), m_payload()
+        {
+        }
+
+        /*!
+        * @brief Constructor of the DwfValueEvent class
+        * @tparam Payload : type of the payload. Must be trivially copyable and fit in C_PAYLOAD_SIZE bytes.
+        * @param id : Value of the event id.
+        * @param payload : Data carried by the event.
+        *
+        */
+        template<class Payload>
+        DwfValueEvent(EventID id, const Payload& payload) : m_id(id), m_payload_size(sizeof(Payload)), m_payload()
+        {
+            static_assert(std::is_trivially_copyable<Payload>::value, "Payload of a value event must be trivially copyable");
+            static_assert(sizeof(Payload) <= C_PAYLOAD_SIZE, "Payload does not fit in a value event");
+            std::memcpy(m_payload, &payload, sizeof(Payload));
+        }
+
+        /*!
+        * @brief Get event ID
+        * @return Id of the event
+        *
+        * Constant method
+        *
+        */
+        EventID getId() const
+        {
+            return m_id;
+        }
+
+        /*!
+        * @brief Get size of the payload
+        * @return Size of the payload in bytes. 0 if event has no payload.
+        *
+        * Constant method
+        *
+        */
+        size_t payloadSize() const
+        {
+            return m_payload_size;
+        }
+
+        /*!
+        * @brief Get payload
+        * @tparam Payload : type of the payload, as given to constructor
+        * @return Copy of the payload
+        *
+        * Throws std::logic_error if payload does not have the size of Payload.
+        * Constant method
+        *
+        */
+        template<class Payload>
+        Payload payload() const
+        {
+            static_assert(std::is_trivially_copyable<Payload>::value, "Payload of a value event must be trivially copyable");
+            static_assert(sizeof(Payload) <= C_PAYLOAD_SIZE, "Payload does not fit in a value event");
+            if(sizeof(Payload) != m_payload_size)
+            {
+                throw std::logic_error("Value event payload has another type");
+            }
+            Payload payload;
+            std::memcpy(&payload, m_payload, sizeof(Payload));
+            return payload;
+        }
+
+    private:
+        EventID m_id; /*!< Id of the event.*/
+
+        uint8_t m_payload_size; /*!< Size of the payload in bytes.*/
+
+        alignas(8) unsigned char m_payload[C_PAYLOAD_SIZE]; /*!< Payload storage.*/
+    };
+
+    /*! @class BoxedValueEvent
+    * @brief DwfEvent carrying a DwfValueEvent
+    *
+    * Inherits from DwfEvent.
+    * Used to hand value events to processEvent and to transition functions, which take std::unique_ptr<DwfEvent>.
+    * Event processors reuse the same box for every value event, so that no memory is allocated.
+    *
+    */
+    class BoxedValueEvent : public DwfEvent
+    {
+    public:
+        /*!
+        * @brief Constructor of the BoxedValueEvent class
+        * @param value : Boxed event. Box has the same id.
+        *
+        */
+        BoxedValueEvent(const DwfValueEvent& value) : DwfEvent(value.getId()), m_value(value)
+        {
+        }
+
+        /*!
+        * @brief Get boxed event
+        * @return Boxed event
+        *
+        * Constant method
+        *
+        */
+        const DwfValueEvent& value() const
+        {
+            return m_value;
+        }
+
+        /*!
+        * @brief Get value event carried by an event
+        * @param event : Event received by processEvent or by a transition function
+        * @return Pointer to carried value event. nullptr if event is not a BoxedValueEvent.
+        *
+        * Static method
+        *
+        */
+        static const DwfValueEvent* valueOf(const DwfEvent& event)
+        {
+            const BoxedValueEvent* box = dynamic_cast<const BoxedValueEvent*>(&event);
+            return box != nullptr ? &box->m_value : nullptr;
+        }
+
+    private:
+        DwfValueEvent m_value; /*!< Boxed event.*/
+    };
+}
+
+#endif //DWF_VALUE_EVENT_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,267 @@
+/*!
+ * @file eventqueue.h
+ * @brief Class adapting a queue class to the event queue interface.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class adapting a queue of std::unique_ptr<DwfEvent> to the AbstractEventQueue interface.
+ * Inherits from AbstractEventQueue.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include "abstracteventqueue.h"
+#include <utility>
+#include <type_traits>
+
+namespace DwfContainers
+{
+    template<class T>
+    class DwfSpscQueue;
+}
+
+/*!
+* @namespace EventSystem
+* @brief A namespace used to regroup all elements related to envent processing systems
+*/
+namespace EventSystem
+{
+    /*! @struct IsSingleProducerQueue
+    * @brief Trait indicating whether a queue class only supports a single producer thread
+    * @tparam Queue : adapted queue class
+    *
+    * False by default. Specialize it for single producer queues other than DwfSpscQueue.
+    *
+    */
+    template<class Queue>
+    struct IsSingleProducerQueue : std::false_type
+    {
+    };
+
+    /*! @struct IsSingleProducerQueue
+    * @brief Specialization of IsSingleProducerQueue for DwfSpscQueue
+    * @tparam T : type of queue elements
+    *
+    */
+    template<class T>
+    struct IsSingleProducerQueue< DwfContainers::DwfSpscQueue<T> > : std::true_type
+    {
+    };
+
+    /*! @class EventQueue
+    * @brief Class adapting a queue class to the event queue interface.
+    * @tparam Queue : queue of std::unique_ptr<DwfEvent> providing push, tryPush, pushFor, pushBatch, pop, popUpTo, disableWait, enableWait, clear, droppedElementNb and coalescedElementNb methods
+    *
+    * Inherits from AbstractEventQueue.
+    * Usage : AbstractEventProcessor(std::unique_ptr<AbstractEventQueue>(new EventQueue< DwfSpscQueue< std::unique_ptr<DwfEvent> > >(1024)))
+    *
+    */
+    template<class Queue>
+    class EventQueue : public AbstractEventQueue
+    {
+    public:
+        /*!
+        * @brief Constructor of EventQueue class
+        * @param args : Arguments forwarded to queue constructor
+        *
+        */
+        template<class... Args>
+        EventQueue(Args&&... args);
+
+        /*!
+        * @brief Destructor of EventQueue class
+        *
+        */
+        virtual ~EventQueue();
+
+        /*!
+        * @brief Push an event using move semantics
+        * @param event : event to push to queue
+        *
+        * If queue is full, throws an exception or waits for room depending on queue overflow policy. Event is not moved if an exception is thrown.
+        *
+        */
+        virtual void push(std::unique_ptr<DwfEvent>&& event);
+
+        /*!
+        * @brief Try to push an event using move semantics
+        * @param event : event to push to queue
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::FULL if queue is full. And event is not moved.
+        *
+        */
+        virtual DwfContainers::PushStatus tryPush(std::unique_ptr<DwfEvent>&& event);
+
+        /*!
+        * @brief Push an event using move semantics, waiting at most timeout for queue to have room
+        * @param event : event to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled. And event is not moved.
+        *
+        */
+        virtual DwfContainers::PushStatus pushFor(std::unique_ptr<DwfEvent>&& event, std::chrono::nanoseconds timeout);
+
+        /*!
+        * @brief Push several events at once using move semantics
+        * @param events : events to push to queue, in order. Cleared once events are moved to queue.
+        *
+        * If queue cannot store all events, throws an exception. And no event is moved.
+        *
+        */
+        virtual void pushBatch(std::vector< std::unique_ptr<DwfEvent> >& events);
+
+        /*!
+        * @brief Wait for an event and pop it
+        * @param event : Reference to the event to move queue head to. Left untouched if wait is disabled.
+        *
+        */
+        virtual void pop(std::unique_ptr<DwfEvent>& event);
+
+        /*!
+        * @brief Wait for events and pop several of them at once
+        * @param max_event_nb : Maximum number of events to pop. 0 indicates all available events.
+        * @param events : Vector popped events are appended to, in queue order
+        * @return Number of popped events. 0 if wait is disabled.
+        *
+        */
+        virtual size_t popUpTo(size_t max_event_nb, std::vector< std::unique_ptr<DwfEvent> >& events);
+
+        /*!
+        * @brief Disable wait of events in queue, unlocking waiting thread
+        *
+        */
+        virtual void disableWait();
+
+        /*!
+        * @brief Enable wait for events in queue
+        *
+        */
+        virtual void enableWait();
+
+        /*!
+        * @brief Delete all events in queue
+        *
+        */
+        virtual void clear();
+
+        /*!
+        * @brief Indicates number of events dropped by queue overflow policy
+        * @return Number of dropped events
+        *
+        */
+        virtual uint64_t droppedEventNb() const;
+
+        /*!
+        * @brief Indicates number of events coalesced by queue overflow policy
+        * @return Number of queued events replaced by a pushed event
+        *
+        */
+        virtual uint64_t coalescedEventNb() const;
+
+        /*!
+        * @brief Indicates whether queue only supports a single producer thread
+        * @return IsSingleProducerQueue<Queue>::value
+        *
+        */
+        virtual bool isSingleProducer() const;
+
+        /*!
+        * @brief Access adapted queue
+        * @return Reference to adapted queue
+        *
+        */
+        Queue& queue();
+
+    private:
+        Queue m_queue; /*!< Adapted queue.*/
+    };
+}
+
+#include "eventqueue.tpp"
+
+#endif //EVENT_QUEUE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
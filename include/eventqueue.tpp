@@ -0,0 +1,188 @@
+/*!
+ * @file eventqueue.tpp
+ * @brief Class adapting a queue class to the event queue interface.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class adapting a queue of std::unique_ptr<DwfEvent> to the AbstractEventQueue interface.
+ * Inherits from AbstractEventQueue.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "eventqueue.h"
+
+namespace EventSystem
+{
+    template<class Queue>
+    template<class... Args>
+    EventQueue<Queue>::EventQueue(Args&&... args) : m_queue(std::forward<Args>(args)...)
+    {
+    }
+
+    template<class Queue>
+    EventQueue<Queue>::~EventQueue()
+    {
+    }
+
+    template<class Queue>
+    void EventQueue<Queue>::push(std::unique_ptr<DwfEvent>&& event)
+    {
+        m_queue.push(std::move(event));
+    }
+
+    template<class Queue>
+    DwfContainers::PushStatus EventQueue<Queue>::tryPush(std::unique_ptr<DwfEvent>&& event)
+    {
+        return m_queue.tryPush(std::move(event));
+    }
+
+    template<class Queue>
+    DwfContainers::PushStatus EventQueue<Queue>::pushFor(std::unique_ptr<DwfEvent>&& event, std::chrono::nanoseconds timeout)
+    {
+        return m_queue.pushFor(std::move(event), timeout);
+    }
+
+    template<class Queue>
+    void EventQueue<Queue>::pushBatch(std::vector< std::unique_ptr<DwfEvent> >& events)
+    {
+        m_queue.pushBatch(events);
+    }
+
+    template<class Queue>
+    void EventQueue<Queue>::pop(std::unique_ptr<DwfEvent>& event)
+    {
+        m_queue.pop(event);
+    }
+
+    template<class Queue>
+    size_t EventQueue<Queue>::popUpTo(size_t max_event_nb, std::vector< std::unique_ptr<DwfEvent> >& events)
+    {
+        return m_queue.popUpTo(max_event_nb, events);
+    }
+
+    template<class Queue>
+    void EventQueue<Queue>::disableWait()
+    {
+        m_queue.disableWait();
+    }
+
+    template<class Queue>
+    void EventQueue<Queue>::enableWait()
+    {
+        m_queue.enableWait();
+    }
+
+    template<class Queue>
+    void EventQueue<Queue>::clear()
+    {
+        m_queue.clear();
+    }
+
+    template<class Queue>
+    uint64_t EventQueue<Queue>::droppedEventNb() const
+    {
+        return m_queue.droppedElementNb();
+    }
+
+    template<class Queue>
+    uint64_t EventQueue<Queue>::coalescedEventNb() const
+    {
+        return m_queue.coalescedElementNb();
+    }
+
+    template<class Queue>
+    bool EventQueue<Queue>::isSingleProducer() const
+    {
+        return IsSingleProducerQueue<Queue>::value;
+    }
+
+    template<class Queue>
+    Queue& EventQueue<Queue>::queue()
+    {
+        return m_queue;
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
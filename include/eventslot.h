@@ -0,0 +1,191 @@
+/*!
+ * @file eventslot.h
+ * @brief Definition of queue elements storing either a value event or a polymorphic event.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef EVENT_SLOT_H
+#define EVENT_SLOT_H
+
+#include "dwfevent.h"
+#include "dwfvalueevent.h"
+#include <memory>
+
+/*!
+* @namespace EventSystem
+* @brief A namespace used to regroup all elements related to envent processing systems
+*/
+namespace EventSystem
+{
+    /*! @class EventSlot
+    * @brief Queue element storing either a DwfValueEvent inline or a std::unique_ptr<DwfEvent>
+    *
+    * Move only.
+    *
+    */
+    class EventSlot
+    {
+    public:
+        /*!
+        * @brief Constructor of the EventSlot class storing a value event
+        * @param value : Event copied in slot
+        *
+        */
+        explicit EventSlot(const DwfValueEvent& value) : m_value(value), m_event(), m_by_value(true)
+        {
+        }
+
+        /*!
+        * @brief Constructor of the EventSlot class storing a polymorphic event
+        * @param event : Event moved to slot
+        *
+        */
+        explicit EventSlot(std::unique_ptr<DwfEvent>&& event) : m_value(0u), m_event(std::move(event)), m_by_value(false)
+        {
+        }
+
+        EventSlot(EventSlot&&) = default;
+        EventSlot& operator=(EventSlot&&) = default;
+
+        /*!
+        * @brief Indicates whether slot stores a value event
+        * @return true if slot stores a value event, false if it stores a polymorphic event
+        *
+        * Constant method
+        *
+        */
+        bool byValue() const
+        {
+            return m_by_value;
+        }
+
+        /*!
+        * @brief Get id of stored event
+        * @return Id of the stored event. 0 for a moved or null polymorphic event.
+        *
+        * Constant method
+        *
+        */
+        EventID getId() const
+        {
+            return m_by_value ? m_value.getId() : (m_event ? m_event->getId() : 0u);
+        }
+
+        /*!
+        * @brief Get stored value event
+        * @return Stored value event. Only meaningful if byValue() is true.
+        *
+        * Constant method
+        *
+        */
+        const DwfValueEvent& value() const
+        {
+            return m_value;
+        }
+
+        /*!
+        * @brief Get stored polymorphic event
+        * @return Reference to stored polymorphic event, so that it can be moved out of slot. Null if byValue() is true.
+        *
+        */
+        std::unique_ptr<DwfEvent>& event()
+        {
+            return m_event;
+        }
+
+    private:
+        DwfValueEvent m_value; /*!< Value event. Only meaningful if m_by_value is true.*/
+
+        std::unique_ptr<DwfEvent> m_event; /*!< Polymorphic event. Null if m_by_value is true.*/
+
+        bool m_by_value; /*!< Whether slot stores a value event.*/
+    };
+}
+
+#endif //EVENT_SLOT_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,252 @@
+/*!
+ * @file flatstatemachine.h
+ * @brief Class representing event based state machine dispatching events through a flat transition table.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class representing an event based state machine.
+ * Transition map is compiled into a contiguous table indexed by state and event IDs when machine is started.
+ * Inherits from AbstractEventProcessor.
+ * Abstract class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef FLAT_STATE_MACHINE_H
+#define FLAT_STATE_MACHINE_H
+
+#include "abstractstatemachine.h"
+#include <vector>
+
+/*!
+* @namespace DwfStateMachine
+* @brief A namespace used to regroup all elements related to state machines
+*/
+namespace DwfStateMachine
+{
+    /*! @class FlatStateMachine
+    * @brief Class representing event based state machine dispatching events through a flat transition table.
+    *
+    * Class representing an event based state machine, alternative to AbstractStateMachine for machines with many states and events.
+    * Transition map is filled the same way as for AbstractStateMachine, then compiled during setupAndStart phase into a contiguous table
+    * with one cell per (StateID, EventID) couple. Dispatching an event is then a single table access, without any hash computation.
+    * Table size is (greatest StateID + 1) x (greatest EventID + 1), so IDs should be dense and start close to 0.
+    * Inherits from AbstractEventProcessor.
+    * Abstract class. You must derive it and fill the table of transitions
+    *
+    * Call behavior of a daughter class should be
+    * - DaughterStateMachine state_mach(<initial_state>);
+    * - state_mach.setupAndStart();
+    *
+    * You must redefine the function setupTransitionMap() to construct the desired transition map during setupAndStart phase.
+    * Transition map is only read when compiling the table, altering it afterwards has no effect on dispatch.
+    *
+    * You must redefine the function onDeadEndState() which defines the class behavior if a state has no associated transition
+    * (i.e. state has no entry in m_transition_map). Events without transition in current state are ignored, including all events of a state with an empty entry, as with AbstractStateMachine.
+    *
+    */
+    class FlatStateMachine : public EventSystem::AbstractEventProcessor
+    {
+    public:
+        /*! @typedef TransitionFunction
+        *  @brief Signature of a transition function
+        */
+        using TransitionFunction = AbstractStateMachine::TransitionFunction;
+
+        /*! @typedef EventTransitionMap
+        *  @brief Map associating an event with the triggered transition
+        */
+        using EventTransitionMap = AbstractStateMachine::EventTransitionMap;
+
+        /*! @typedef TransitionMap
+        *  @brief Map associating a state with its supported events and the triggered transition
+        */
+        using TransitionMap = AbstractStateMachine::TransitionMap;
+
+        static const size_t C_MAX_TABLE_SIZE; /*!< Maximum number of cells of the compiled transition table.*/
+
+        /*!
+        * @brief Constructor of FlatStateMachine class
+        * @param initial_state : Initial State of the machine.
+        * @param max_element_nb : Max number of elements that can be stored in event queue. Default indicates no size limitation.
+        *
+        * Constructor of the FlatStateMachine class defining initial state, and setting event processing.
+        *
+        */
+        FlatStateMachine(DwfState initial_state, size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT);
+
+        /*!
+        * @brief Constructor of FlatStateMachine class
+        * @param initial_state : Initial State of the machine.
+        * @param event_queue : Queue used to store events.
+        *
+        * Constructor of the FlatStateMachine class defining initial state, and selecting event queue implementation.
+        *
+        */
+        FlatStateMachine(DwfState initial_state, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue);
+
+        /*!
+        * @brief Destructor of FlatStateMachine class
+        *
+        * Stop event processing before deleting events
+        *
+        */
+        virtual ~FlatStateMachine();
+
+        /*!
+        * @brief Configure state machine and start event processing
+        *
+        * Create the transition map using method setupTransitionMap and compile it into the transition table.
+        * Start event processing.
+        * If compiled table would exceed C_MAX_TABLE_SIZE cells, throws std::length_error and event processing is not started.
+        * Virtual method.
+        *
+        */
+        virtual void setupAndStart();
+
+    protected:
+        /*!
+        * @brief Process received event
+        * @param event : latest event extracted from event queue
+        *
+        * Selects a transition function in the transition table depending on current state and event IDs.
+        * Calls it with received event as argument.
+        * Calls onDeadEndState if current state has no entry in transition map.
+        * Final virtual method.
+        *
+        */
+        virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event) final;
+
+        /*!
+        * @brief Fill the transition map
+        *
+        * Purely Virtual method
+        *
+        */
+        virtual void setupTransitionMap() = 0;
+
+        /*!
+        * @brief Dead end state reaching handler
+        * @param reason : reason why current state is a dead end state
+        *
+        * When reaching a state which has no event/TransitionFunction map associated, you cannot get out of this state.
+        * We call this a "dead end state". This may be a desired behavior or a design flaw in your state machine.
+        * This method is used to handle such a situation, in your daughter class..
+        * Purely Virtual method
+        *
+        */
+        virtual void onDeadEndState(DeadEndReason reason) = 0;
+
+        DwfState m_current_state; /*!< Current state.*/
+
+        TransitionMap m_transition_map; /*!< List of possible transition functions depending on current_state and events. Protected so that child class can setup map content easily.*/
+
+    private:
+        /*! @typedef TransitionIndex
+        *  @brief Index of a transition function in m_transition_functions. 0 indicates no transition.
+        */
+        using TransitionIndex = uint32_t;
+
+        /*!
+        * @brief Compile transition map into transition table
+        *
+        * If compiled table would exceed C_MAX_TABLE_SIZE cells, throws std::length_error and previous table is kept.
+        *
+        */
+        void compileTransitionTable();
+
+        std::vector<TransitionFunction> m_transition_functions; /*!< Transition functions referenced by the transition table. First one is an empty placeholder.*/
+
+        std::vector<TransitionIndex> m_transition_table; /*!< Transition table, one row of m_event_nb cells per state.*/
+
+        std::vector<bool> m_is_dead_end; /*!< Flag indicating, for each state, if it has no entry in transition map.*/
+
+        StateID m_state_nb; /*!< Number of rows of the transition table.*/
+
+        EventSystem::EventID m_event_nb; /*!< Number of columns of the transition table.*/
+    };
+}
+#endif // FLAT_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,145 @@
+/*!
+ * @file priorityeventqueue.h
+ * @brief Definition of an event queue with priority lanes
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef PRIORITY_EVENT_QUEUE_H
+#define PRIORITY_EVENT_QUEUE_H
+
+#include "eventqueue.h"
+#include "dwfpriorityqueue.h"
+
+/*!
+* @namespace EventSystem
+* @brief A namespace used to regroup all elements related to envent processing systems
+*/
+namespace EventSystem
+{
+    /*! @class PriorityEventQueue
+    * @brief Class adapting DwfPriorityQueue to the event queue interface, honoring event priorities.
+    *
+    * Inherits from EventQueue< DwfContainers::DwfPriorityQueue< std::unique_ptr<DwfEvent> > >.
+    * Events pushed without priority use the lowest priority.
+    * Usage : AbstractEventProcessor(std::unique_ptr<AbstractEventQueue>(new PriorityEventQueue(2))) then pushEvent(event, 1) for urgent events.
+    *
+    */
+    class PriorityEventQueue : public EventQueue< DwfContainers::DwfPriorityQueue< std::unique_ptr<DwfEvent> > >
+    {
+    public:
+        /*!
+        * @brief Constructor of PriorityEventQueue class
+        * @param lane_nb : Number of priority lanes. Priorities range from 0 to lane_nb - 1.
+        * @param max_element_nb : Max number of events that can be stored in queue, all lanes included. Default indicates no size limitation.
+        *
+        * Throws std::invalid_argument if lane_nb is 0 or greater than DwfPriorityQueue::C_MAX_LANE_NB.
+        *
+        */
+        PriorityEventQueue(size_t lane_nb, size_t max_element_nb = DwfContainers::DwfPriorityQueue< std::unique_ptr<DwfEvent> >::C_NO_SIZE_LIMIT);
+
+        /*!
+        * @brief Destructor of PriorityEventQueue class
+        *
+        */
+        virtual ~PriorityEventQueue();
+
+        /*!
+        * @brief Push an event in the lane of its priority using move semantics
+        * @param event : event to push to queue
+        * @param priority : priority of event. 0 is the lowest priority.
+        *
+        * If queue is full, throws an exception. And event is not moved.
+        * Throws std::invalid_argument if priority has no lane.
+        *
+        */
+        virtual void pushWithPriority(std::unique_ptr<DwfEvent>&& event, DwfContainers::Priority priority);
+    };
+}
+
+#endif //PRIORITY_EVENT_QUEUE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,352 @@
+/*!
+ * @file staticstatemachine.h
+ * @brief Class representing event based state machine whose transitions are defined at compile time.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class representing an event based state machine whose transition table is given as template parameters.
+ * Inherits from AbstractEventProcessor.
+ * Abstract class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef STATIC_STATE_MACHINE_H
+#define STATIC_STATE_MACHINE_H
+
+#include "dwfstate.h"
+#include "abstractstatemachine.h"
+
+/*!
+* @namespace DwfStateMachine
+* @brief A namespace used to regroup all elements related to state machines
+*/
+namespace DwfStateMachine
+{
+    /*! @struct NoAction
+    * @brief Transition action doing nothing
+    *
+    */
+    struct NoAction
+    {
+        /*!
+        * @brief Overload of operator(). Does nothing
+        *
+        * Constant method
+        *
+        */
+        template<class Machine>
+        void operator()(Machine&, std::unique_ptr<EventSystem::DwfEvent>&&) const
+        {
+        }
+    };
+
+    /*! @struct Transition
+    * @brief Definition of a transition as a type
+    * @tparam From : ID of the state in which transition can be triggered
+    * @tparam Event : ID of the event triggering transition
+    * @tparam To : ID of the state reached by transition
+    * @tparam Action : default constructible functor called on transition, with the machine and the received event as arguments
+    *
+    */
+    template<StateID From, EventSystem::EventID Event, StateID To, class Action = NoAction>
+    struct Transition
+    {
+        static constexpr StateID C_FROM = From; /*!< ID of the state in which transition can be triggered.*/
+        static constexpr EventSystem::EventID C_EVENT = Event; /*!< ID of the event triggering transition.*/
+        static constexpr StateID C_TO = To; /*!< ID of the state reached by transition.*/
+        using ActionType = Action; /*!< Functor called on transition.*/
+    };
+
+    /*! @struct TransitionTable
+    * @brief Compile time transition table
+    * @tparam Transitions : list of Transition types
+    *
+    * Dispatch is an unrolled sequence of comparisons with constants the compiler turns into a switch, calling actions inline.
+    *
+    */
+    template<class... Transitions>
+    struct TransitionTable;
+
+    /*! @struct TransitionTable
+    * @brief Empty transition table, end of recursion
+    *
+    */
+    template<>
+    struct TransitionTable<>
+    {
+        static constexpr bool hasTransitionFrom(StateID)
+        {
+            return false;
+        }
+
+        static constexpr bool hasTransition(StateID, EventSystem::EventID)
+        {
+            return false;
+        }
+
+        static constexpr bool isDeterministic()
+        {
+            return true;
+        }
+
+        template<class Machine>
+        static void dispatch(Machine&, DwfState&, EventSystem::EventID, std::unique_ptr<EventSystem::DwfEvent>&&)
+        {
+            // If there is no transition associated with event for current state, we do nothing.
+            // Indeed in some states, it is perfectly legit to choose to ignore events.
+        }
+    };
+
+    /*! @struct TransitionTable
+    * @brief Transition table containing at least one transition
+    * @tparam Head : first transition of the table
+    * @tparam Tail : other transitions of the table
+    *
+    */
+    template<class Head, class... Tail>
+    struct TransitionTable<Head, Tail...>
+    {
+        /*!
+        * @brief Indicates whether a state has at least one transition
+        * @param state : ID of the state
+        * @return true if a transition starts from state, false otherwise
+        *
+        */
+        static constexpr bool hasTransitionFrom(StateID state)
+        {
+            return state == Head::C_FROM || TransitionTable<Tail...>::hasTransitionFrom(state);
+        }
+
+        /*!
+        * @brief Indicates whether an event triggers a transition in a state
+        * @param state : ID of the state
+        * @param event : ID of the event
+        * @return true if a transition exists, false otherwise
+        *
+        */
+        static constexpr bool hasTransition(StateID state, EventSystem::EventID event)
+        {
+            return (state == Head::C_FROM && event == Head::C_EVENT) || TransitionTable<Tail...>::hasTransition(state, event);
+        }
+
+        /*!
+        * @brief Indicates whether table has at most one transition per state and event
+        * @return true if table is deterministic, false otherwise
+        *
+        */
+        static constexpr bool isDeterministic()
+        {
+            return !TransitionTable<Tail...>::hasTransition(Head::C_FROM, Head::C_EVENT) && TransitionTable<Tail...>::isDeterministic();
+        }
+
+        /*!
+        * @brief Call transition matching current state and event, if any, and update current state
+        * @param machine : machine passed to transition action
+        * @param current_state : current state of the machine, set to target state if a transition is triggered
+        * @param event_id : ID of the received event
+        * @param event : received event, passed to transition action
+        *
+        * Action is called while current state is still the source state, as transition functions of AbstractStateMachine are.
+        * Current state is then set to transition target state.
+        *
+        */
+        template<class Machine>
+        static void dispatch(Machine& machine, DwfState& current_state, EventSystem::EventID event_id, std::unique_ptr<EventSystem::DwfEvent>&& event)
+        {
+            if(current_state.getId() == Head::C_FROM && event_id == Head::C_EVENT)
+            {
+                typename Head::ActionType()(machine, std::move(event));
+                current_state = DwfState(Head::C_TO);
+            }
+            else
+            {
+                TransitionTable<Tail...>::dispatch(machine, current_state, event_id, std::move(event));
+            }
+        }
+    };
+
+    /*! @class StaticStateMachine
+    * @brief Class representing event based state machine whose transitions are defined at compile time.
+    * @tparam Derived : daughter class, passed to transition actions
+    * @tparam Transitions : list of Transition types defining the machine
+    *
+    * Class representing an event based state machine, alternative to AbstractStateMachine for machines whose topology is known at build time.
+    * States, events and transition actions are encoded as types so that dispatch involves no std::function and no hash table.
+    * Uses DwfState and DwfEvent IDs as well as AbstractEventProcessor threading so machines can be migrated from AbstractStateMachine one at a time.
+    * Inherits from AbstractEventProcessor.
+    * Abstract class. You must derive it as class Daughter : public StaticStateMachine<Daughter, Transition<...>, ...>
+    *
+    * Call behavior of a daughter class should be
+    * - DaughterStateMachine state_mach(<initial_state>);
+    * - state_mach.setupAndStart();
+    *
+    * Transition actions are functors taking the daughter class and the received event. They should be declared before daughter class.
+    * Actions are called before current state is updated, so that they see the source state as AbstractStateMachine transition functions do.
+    *
+    * You must redefine the function onDeadEndState() which defines the class behavior if a state has no associated transition.
+    * It is called with DeadEndReason::NO_TRANSITION_MAP, as AbstractStateMachine does. Events without transition from a state having transitions are ignored.
+    *
+    */
+    template<class Derived, class... Transitions>
+    class StaticStateMachine : public EventSystem::AbstractEventProcessor
+    {
+    public:
+        /*! @typedef Table
+        *  @brief Transition table of the machine
+        */
+        using Table = TransitionTable<Transitions...>;
+
+        static_assert(Table::isDeterministic(), "StaticStateMachine cannot have several transitions for the same state and event");
+
+        /*!
+        * @brief Constructor of StaticStateMachine class
+        * @param initial_state : Initial State of the machine.
+        * @param max_element_nb : Max number of elements that can be stored in event queue. Default indicates no size limitation.
+        *
+        * Constructor of the StaticStateMachine class defining initial state, and setting event processing.
+        *
+        */
+        StaticStateMachine(DwfState initial_state, size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT);
+
+        /*!
+        * @brief Constructor of StaticStateMachine class
+        * @param initial_state : Initial State of the machine.
+        * @param event_queue : Queue used to store events.
+        *
+        * Constructor of the StaticStateMachine class defining initial state, and selecting event queue implementation.
+        *
+        */
+        StaticStateMachine(DwfState initial_state, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue);
+
+        /*!
+        * @brief Destructor of StaticStateMachine class
+        *
+        * Stop event processing before deleting events
+        *
+        */
+        virtual ~StaticStateMachine();
+
+        /*!
+        * @brief Start event processing
+        *
+        * Transition table being defined at compile time, there is nothing to setup.
+        * Provided for interface compatibility with AbstractStateMachine.
+        * Virtual method.
+        *
+        */
+        virtual void setupAndStart();
+
+    protected:
+        /*!
+        * @brief Process received event
+        * @param event : latest event extracted from event queue
+        *
+        * Moves to the target state of the transition matching current state and event type then calls transition action.
+        * Final virtual method.
+        *
+        */
+        virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event) final;
+
+        /*!
+        * @brief Dead end state reaching handler
+        * @param reason : reason why current state is a dead end state
+        *
+        * When reaching a state from which no transition starts, you cannot get out of this state.
+        * We call this a "dead end state". This may be a desired behavior or a design flaw in your state machine.
+        * This method is used to handle such a situation, in your daughter class..
+        * Purely Virtual method
+        *
+        */
+        virtual void onDeadEndState(DeadEndReason reason) = 0;
+
+        DwfState m_current_state; /*!< Current state.*/
+    };
+}
+
+#include "staticstatemachine.tpp"
+
+#endif // STATIC_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,262 @@
+/*!
+ * @file valueeventqueue.h
+ * @brief Definition of an event queue storing value events inline
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef VALUE_EVENT_QUEUE_H
+#define VALUE_EVENT_QUEUE_H
+
+#include "abstracteventqueue.h"
+#include "dwfqueue.h"
+#include "eventslot.h"
+
+/*!
+* @namespace EventSystem
+* @brief A namespace used to regroup all elements related to envent processing systems
+*/
+namespace EventSystem
+{
+    /*! @class ValueEventQueue
+    * @brief Event queue storing DwfValueEvent inline, alongside std::unique_ptr<DwfEvent>
+    *
+    * Inherits from AbstractEventQueue.
+    * Events of both kinds are stored as EventSlot in a DwfQueue and keep their push order.
+    * Value events are popped by popSlotsUpTo without any allocation. pop and popUpTo box them in a BoxedValueEvent.
+    * Usage : AbstractEventProcessor(std::unique_ptr<AbstractEventQueue>(new ValueEventQueue())) then pushValueEvent(DwfValueEvent(id, payload)).
+    *
+    */
+    class ValueEventQueue : public AbstractEventQueue
+    {
+    public:
+        /*!
+        * @brief Constructor of ValueEventQueue class
+        * @param max_element_nb : Max number of events that can be stored in queue. Default indicates no size limitation.
+        * @param overflow_policy : Behavior of push methods when queue is full. Default throws an exception.
+        * @param wait_strategy : Way pop methods wait for events. Default parks consumer immediately.
+        *
+        * OverflowPolicy::COALESCE_BY_ID replaces the latest queued event with the same EventID, whatever its kind.
+        *
+        */
+        ValueEventQueue(size_t max_element_nb = DwfContainers::DwfQueue<EventSlot>::C_NO_SIZE_LIMIT, DwfContainers::OverflowPolicy overflow_policy = DwfContainers::OverflowPolicy::THROW, DwfContainers::WaitStrategy wait_strategy = DwfContainers::WaitStrategy());
+
+        /*!
+        * @brief Destructor of ValueEventQueue class
+        *
+        */
+        virtual ~ValueEventQueue();
+
+        /*!
+        * @brief Push an event using move semantics
+        * @param event : event to push to queue
+        *
+        * If queue is full, applies queue overflow policy. Event is not moved if an exception is thrown or if it is dropped.
+        *
+        */
+        virtual void push(std::unique_ptr<DwfEvent>&& event);
+
+        /*!
+        * @brief Try to push an event using move semantics
+        * @param event : event to push to queue
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::FULL if queue is full. And event is not moved.
+        *
+        */
+        virtual DwfContainers::PushStatus tryPush(std::unique_ptr<DwfEvent>&& event);
+
+        /*!
+        * @brief Push an event using move semantics, waiting at most timeout for queue to have room
+        * @param event : event to push to queue
+        * @param timeout : Maximum duration to wait for room
+        * @return PushStatus::PUSHED if event was pushed, PushStatus::TIMEOUT if queue stayed full or wait was disabled. And event is not moved.
+        *
+        */
+        virtual DwfContainers::PushStatus pushFor(std::unique_ptr<DwfEvent>&& event, std::chrono::nanoseconds timeout);
+
+        /*!
+        * @brief Push several events at once using move semantics
+        * @param events : events to push to queue, in order. Cleared once events are moved to queue.
+        *
+        * If queue cannot store all events, throws an exception or waits for room depending on overflow policy. No event is moved if an exception is thrown.
+        *
+        */
+        virtual void pushBatch(std::vector< std::unique_ptr<DwfEvent> >& events);
+
+        /*!
+        * @brief Wait for an event and pop it
+        * @param event : Reference to the event to move queue head to. Value events are boxed in a BoxedValueEvent. Left untouched if wait is disabled.
+        *
+        */
+        virtual void pop(std::unique_ptr<DwfEvent>& event);
+
+        /*!
+        * @brief Wait for events and pop several of them at once
+        * @param max_event_nb : Maximum number of events to pop. 0 indicates all available events.
+        * @param events : Vector popped events are appended to, in queue order. Value events are boxed in a BoxedValueEvent.
+        * @return Number of popped events. 0 if wait is disabled.
+        *
+        */
+        virtual size_t popUpTo(size_t max_event_nb, std::vector< std::unique_ptr<DwfEvent> >& events);
+
+        /*!
+        * @brief Disable wait of events in queue, unlocking waiting thread
+        *
+        */
+        virtual void disableWait();
+
+        /*!
+        * @brief Enable wait for events in queue
+        *
+        */
+        virtual void enableWait();
+
+        /*!
+        * @brief Delete all events in queue
+        *
+        */
+        virtual void clear();
+
+        /*!
+        * @brief Indicates number of events dropped by queue overflow policy
+        * @return Number of dropped events
+        *
+        * Const method
+        *
+        */
+        virtual uint64_t droppedEventNb() const;
+
+        /*!
+        * @brief Indicates number of events coalesced by queue overflow policy
+        * @return Number of queued events replaced by a pushed event
+        *
+        * Const method
+        *
+        */
+        virtual uint64_t coalescedEventNb() const;
+
+        /*!
+        * @brief Indicates whether queue stores value events inline
+        * @return true
+        *
+        * Const method
+        *
+        */
+        virtual bool storesValues() const;
+
+        /*!
+        * @brief Push a value event by copy
+        * @param event : event to push to queue
+        *
+        * If queue is full, applies queue overflow policy.
+        *
+        */
+        virtual void pushValue(const DwfValueEvent& event);
+
+        /*!
+        * @brief Wait for events and pop several of them at once, whether they are value or polymorphic events
+        * @param max_event_nb : Maximum number of events to pop. 0 indicates all available events.
+        * @param slots : Vector popped events are appended to, in queue order
+        * @return Number of popped events. 0 if wait is disabled.
+        *
+        */
+        virtual size_t popSlotsUpTo(size_t max_event_nb, std::vector<EventSlot>& slots);
+
+    private:
+        DwfContainers::DwfQueue<EventSlot> m_queue; /*!< Adapted queue.*/
+
+        /*!
+        * @brief Move popped slots to events, boxing value events
+        * @param slots : Popped slots
+        * @param events : Vector events are appended to
+        *
+        */
+        static void unboxSlots(std::vector<EventSlot>& slots, std::vector< std::unique_ptr<DwfEvent> >& events);
+    };
+}
+
+#endif //VALUE_EVENT_QUEUE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,235 @@
+/*!
+ * @file waitstrategy.h
+ * @brief Definition of the way consumers wait for elements in queues.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Definition of the polling phases consumers go through before parking on a condition variable.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef WAIT_STRATEGY_H
+#define WAIT_STRATEGY_H
+
+#include <cstdint>
+#include <thread>
+
+/*!
+* @namespace DwfContainers
+* @brief A namespace used to regroup all elements related to data containers
+*/
+namespace DwfContainers
+{
+    /*!
+    * @brief Hint processor that current thread is busy waiting
+    *
+    * Uses pause instruction on x86 and yield instruction on ARM, reducing power and memory order violation costs of spinning.
+    * Does nothing on other architectures.
+    *
+    */
+    inline void cpuRelax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+    /*! @class WaitStrategy
+    * @brief Class defining how a consumer waits for elements before parking
+    *
+    * Consumer first checks queue spin_nb times separated by a pause instruction, then yield_nb times separated by a processor yield.
+    * If queue is still empty, consumer parks on a condition variable, paying a futex wake-up and a context switch when an element arrives.
+    * Spinning trades processor time for wake-up latency after idle gaps. Default strategy parks immediately.
+    *
+    */
+    class WaitStrategy
+    {
+    public:
+        static const uint32_t C_ADAPTIVE_SPIN_NB = 2048u; /*!< Number of spins of adaptive strategy. A few microseconds on recent processors.*/
+
+        static const uint32_t C_ADAPTIVE_YIELD_NB = 64u; /*!< Number of yields of adaptive strategy.*/
+
+        /*!
+        * @brief Constructor of WaitStrategy class
+        * @param spin_nb : Number of checks separated by a pause instruction. Default indicates no spinning.
+        * @param yield_nb : Number of checks separated by a processor yield, once spinning is over. Default indicates no yielding.
+        *
+        */
+        WaitStrategy(uint32_t spin_nb = 0u, uint32_t yield_nb = 0u) : m_spin_nb(spin_nb), m_yield_nb(yield_nb)
+        {
+        }
+
+        /*!
+        * @brief Strategy parking consumer as soon as queue is empty
+        * @return Strategy without spinning nor yielding
+        *
+        * Static method
+        *
+        */
+        static WaitStrategy park()
+        {
+            return WaitStrategy();
+        }
+
+        /*!
+        * @brief Strategy spinning then yielding before parking consumer
+        * @return Strategy with C_ADAPTIVE_SPIN_NB spins and C_ADAPTIVE_YIELD_NB yields. Strategy parking immediately on single core machines.
+        *
+        * Static method
+        * On a single core, spinning consumer would only delay the producer it waits for.
+        *
+        */
+        static WaitStrategy adaptive()
+        {
+            return std::thread::hardware_concurrency() > 1u ? WaitStrategy(C_ADAPTIVE_SPIN_NB, C_ADAPTIVE_YIELD_NB) : park();
+        }
+
+        /*!
+        * @brief Get number of spins
+        * @return Number of checks separated by a pause instruction
+        *
+        * Const method
+        *
+        */
+        uint32_t spinNb() const
+        {
+            return m_spin_nb;
+        }
+
+        /*!
+        * @brief Get number of yields
+        * @return Number of checks separated by a processor yield
+        *
+        * Const method
+        *
+        */
+        uint32_t yieldNb() const
+        {
+            return m_yield_nb;
+        }
+
+        /*!
+        * @brief Poll a condition through spinning and yielding phases
+        * @tparam Predicate : type of the polled condition, callable without argument and returning bool
+        * @param ready : polled condition
+        * @return true if condition became true, false if both phases are over and caller must park
+        *
+        * Const method
+        *
+        */
+        template<class Predicate>
+        bool poll(Predicate ready) const
+        {
+            for(uint32_t i = 0u; i < m_spin_nb; ++i)
+            {
+                if(ready())
+                {
+                    return true;
+                }
+                cpuRelax();
+            }
+            for(uint32_t i = 0u; i < m_yield_nb; ++i)
+            {
+                if(ready())
+                {
+                    return true;
+                }
+                std::this_thread::yield();
+            }
+            return ready();
+        }
+
+    private:
+        uint32_t m_spin_nb; /*!< Number of checks separated by a pause instruction.*/
+
+        uint32_t m_yield_nb; /*!< Number of checks separated by a processor yield.*/
+    };
+}
+
+#endif //WAIT_STRATEGY_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -71,11 +71,35 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 */
 
 #include "abstracteventprocessor.h"
+#include "eventqueue.h"
+#include <stdexcept>
 
 namespace EventSystem
 {
-    AbstractEventProcessor::AbstractEventProcessor(size_t max_element_nb): m_event_queue(max_element_nb), m_start_event_processing(false), m_event_processing_thread()
+    /*!
+    * @brief Indicates whether two queued events have the same EventID
+    * @param lhs : first event
+    * @param rhs : second event
+    * @return true if events have the same EventID, false otherwise
+    *
+    * Key comparison of event queues coalescing events.
+    *
+    */
+    static bool sameEventId(const std::unique_ptr<DwfEvent>& lhs, const std::unique_ptr<DwfEvent>& rhs)
     {
+        return *lhs == *rhs;
+    }
+
+    AbstractEventProcessor::AbstractEventProcessor(size_t max_element_nb, DwfContainers::OverflowPolicy overflow_policy, DwfContainers::WaitStrategy wait_strategy): m_event_queue(new EventQueue< DwfContainers::DwfQueue< std::unique_ptr<DwfEvent> > >(max_element_nb, overflow_policy, sameEventId, wait_strategy)), m_start_event_processing(false), m_max_batch_size(1u), m_event_processing_thread(), m_value_event_box()
+    {
+    }
+
+    AbstractEventProcessor::AbstractEventProcessor(std::unique_ptr<AbstractEventQueue>&& event_queue): m_event_queue(std::move(event_queue)), m_start_event_processing(false), m_max_batch_size(1u), m_event_processing_thread(), m_value_event_box()
+    {
+        if(!m_event_queue)
+        {
+            throw std::invalid_argument("Event processor needs an event queue");
+        }
     }
 
     AbstractEventProcessor::~AbstractEventProcessor()
@@ -87,7 +111,49 @@ namespace EventSystem
     {
         if(m_start_event_processing) // Drop received events while  processing is not started
         {
-            m_event_queue.push(std::move(event));
+            m_event_queue->push(std::move(event));
+        }
+    }
+
+    void AbstractEventProcessor::pushEvent(std::unique_ptr<DwfEvent>&& event, DwfContainers::Priority priority)
+    {
+        if(m_start_event_processing) // Drop received events while  processing is not started
+        {
+            m_event_queue->pushWithPriority(std::move(event), priority);
+        }
+    }
+
+    DwfContainers::PushStatus AbstractEventProcessor::tryPushEvent(std::unique_ptr<DwfEvent>&& event)
+    {
+        if(m_start_event_processing) // Drop received events while  processing is not started
+        {
+            return m_event_queue->tryPush(std::move(event));
+        }
+        return DwfContainers::PushStatus::NOT_STARTED;
+    }
+
+    DwfContainers::PushStatus AbstractEventProcessor::pushEventFor(std::unique_ptr<DwfEvent>&& event, std::chrono::nanoseconds timeout)
+    {
+        if(m_start_event_processing) // Drop received events while  processing is not started
+        {
+            return m_event_queue->pushFor(std::move(event), timeout);
+        }
+        return DwfContainers::PushStatus::NOT_STARTED;
+    }
+
+    void AbstractEventProcessor::pushEvents(std::vector< std::unique_ptr<DwfEvent> >& events)
+    {
+        if(m_start_event_processing) // Drop received events while  processing is not started
+        {
+            m_event_queue->pushBatch(events);
+        }
+    }
+
+    void AbstractEventProcessor::pushValueEvent(const DwfValueEvent& event)
+    {
+        if(m_start_event_processing) // Drop received events while  processing is not started
+        {
+            m_event_queue->pushValue(event);
         }
     }
 
@@ -96,6 +162,7 @@ namespace EventSystem
         if(!m_start_event_processing)
         {
             m_start_event_processing = true; // Activate event procesing flag
+            m_event_queue->enableWait(); // Wait may have been disabled by a previous stop
             m_event_processing_thread = std::thread([this]{waitEvents();});
         }
     }
@@ -105,27 +172,118 @@ namespace EventSystem
         if(m_start_event_processing)
         {
             m_start_event_processing = false;
-            m_event_queue.clear(); // Clear event queue
-            m_event_queue.disableWait(); // Force exit of queue waiting thread to unlock waiter thread
+            m_event_queue->disableWait(); // Force exit of queue waiting thread to unlock waiter thread
 
             if(m_event_processing_thread.joinable())
             {
                 m_event_processing_thread.join(); // Wait for thread to complete execution
             }
+
+            m_event_queue->clear(); // Clear event queue once consumer has exited, as lock-free queues only allow their consumer to remove elements
         }
     }
 
+    void AbstractEventProcessor::setMaxBatchSize(size_t max_batch_size)
+    {
+        m_max_batch_size = max_batch_size;
+    }
+
+    uint64_t AbstractEventProcessor::droppedEventNb() const
+    {
+        return m_event_queue->droppedEventNb();
+    }
+
+    uint64_t AbstractEventProcessor::coalescedEventNb() const
+    {
+        return m_event_queue->coalescedEventNb();
+    }
+
+    bool AbstractEventProcessor::hasSingleProducerQueue() const
+    {
+        return m_event_queue->isSingleProducer();
+    }
+
+    void AbstractEventProcessor::processEvents(std::vector< std::unique_ptr<DwfEvent> >& events)
+    {
+        for(std::unique_ptr<DwfEvent>& event : events)
+        {
+            if(!m_start_event_processing) // Remaining events are dropped as if they were still in queue
+            {
+                break;
+            }
+            processEvent(std::move(event));
+        }
+    }
+
+    void AbstractEventProcessor::processValueEvent(const DwfValueEvent& event)
+    {
+        if(m_value_event_box) // Reuse box unless previous processEvent took it over
+        {
+            *static_cast<BoxedValueEvent*>(m_value_event_box.get()) = BoxedValueEvent(event);
+        }
+        else
+        {
+            m_value_event_box.reset(new BoxedValueEvent(event));
+        }
+        processEvent(std::move(m_value_event_box));
+    }
+
     void AbstractEventProcessor::waitEvents()
     {
+        if(m_event_queue->storesValues())
+        {
+            waitSlots();
+            return;
+        }
+        std::vector< std::unique_ptr<DwfEvent> > batch; // Reused between batches to avoid reallocations
         while(m_start_event_processing) // Do wait until exit has been requested
         {
-            std::unique_ptr<DwfEvent> element; // Init to nullptr
-            m_event_queue.pop(element); // Wait for events
+            const size_t max_batch_size = m_max_batch_size;
+            if(max_batch_size == 1u)
+            {
+                std::unique_ptr<DwfEvent> element; // Init to nullptr
+                m_event_queue->pop(element); // Wait for events
 
-            if(element) // If we have content in element. We can have empty element if we forced exit
+                if(element) // If we have content in element. We can have empty element if we forced exit
+                {
+                    processEvent(std::move(element));
+                }
+            }
+            else
+            {
+                if(m_event_queue->popUpTo(max_batch_size, batch) > 0u) // Wait for events. We can have no event if we forced exit
+                {
+                    processEvents(batch);
+                }
+                batch.clear();
+            }
+        }
+    }
+
+    void AbstractEventProcessor::waitSlots()
+    {
+        std::vector<EventSlot> slots; // Reused between batches to avoid reallocations
+        while(m_start_event_processing) // Do wait until exit has been requested
+        {
+            if(m_event_queue->popSlotsUpTo(m_max_batch_size, slots) > 0u) // Wait for events. We can have no event if we forced exit
             {
-                processEvent(std::move(element));
+                for(EventSlot& slot : slots)
+                {
+                    if(!m_start_event_processing) // Remaining events are dropped as if they were still in queue
+                    {
+                        break;
+                    }
+                    if(slot.byValue())
+                    {
+                        processValueEvent(slot.value());
+                    }
+                    else if(slot.event())
+                    {
+                        processEvent(std::move(slot.event()));
+                    }
+                }
             }
+            slots.clear();
         }
     }
 }
@@ -74,6 +74,8 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 */
 
 #include "abstractperiodicstatemachine.h"
+#include <algorithm>
+#include <typeinfo>
 
 namespace DwfStateMachine
 {
@@ -87,16 +89,50 @@ namespace DwfStateMachine
     {
         // Setup state function map
         setupStateFunctionMap();
+        sortPeriodicTasks();
 
         // Setup transition map
         setupTransitionMap();
+        checkStateTimeoutQueue();
+
+        // Arm timeout of initial state before event processing thread may change state
+        restartStateTimeout();
 
         // Start event processing
         start();
     }
 
+    bool AbstractPeriodicStateMachine::processInternalEvent(std::unique_ptr<EventSystem::DwfEvent>& event)
+    {
+        if(m_state_function_thread != StateFunctionThread::EVENT_THREAD || typeid(*event) != typeid(TickEvent))
+        {
+            return false;
+        }
+        m_tick_pending = false;
+        if(m_periodic_timer.isStarted()) // Ticks queued before timer was stopped are dropped
+        {
+            callStateFunction();
+        }
+        return true;
+    }
+
+    void AbstractPeriodicStateMachine::setStateFunctionThread(StateFunctionThread state_function_thread)
+    {
+        if(state_function_thread == StateFunctionThread::EVENT_THREAD && hasSingleProducerQueue()) // Ticks would race with events pushed by application thread
+        {
+            throw std::logic_error("Calling state functions from event processing thread requires an event queue supporting several producer threads");
+        }
+        if(!m_periodic_timer.isStarted()) // We do not alter object if timer is running
+        {
+            m_state_function_thread = state_function_thread;
+        }
+    }
+
     void AbstractPeriodicStateMachine::startTimer()
     {
+        m_tick_pending = false; // Tick may have been dropped with event queue content when event processing was stopped
+        m_tick_nb = 0u; // Periodic tasks run from first tick
+        m_called_tick_nb = 0u;
         m_periodic_timer.start();
     }
 
@@ -105,21 +141,62 @@ namespace DwfStateMachine
         m_periodic_timer.stop();
     }
 
+    void AbstractPeriodicStateMachine::onTimerTick()
+    {
+        ++m_tick_nb; // Counted even if tick is dropped, so that periodic tasks keep their rate
+        if(m_state_function_thread == StateFunctionThread::TIMER_THREAD)
+        {
+            callStateFunction();
+            return;
+        }
+        if(!m_tick_pending.exchange(true)) // A single tick is queued at once, so that ticks do not pile up behind long transitions
+        {
+            if(tryPushEvent(std::unique_ptr<EventSystem::DwfEvent>(new TickEvent())) != DwfContainers::PushStatus::PUSHED)
+            {
+                m_tick_pending = false;
+            }
+        }
+    }
+
     void AbstractPeriodicStateMachine::callStateFunction()
     {
-        PeriodicFunction per_function;
-        try
+        PeriodicFunctionMap::const_iterator per_function = m_periodic_function_maps.find(m_current_state);
+        // If there is no function associated with current state we do nothing.
+        // Indeed in some states, it is perfectly legit to do nothing on a periodic basis even if timer is started.
+        if(per_function != m_periodic_function_maps.cend() && per_function->second)
+        {
+            per_function->second();
+        }
+
+        const uint64_t tick_nb = m_tick_nb;
+        const uint64_t called_tick_nb = m_called_tick_nb.exchange(tick_nb); // Updated in every state, so that tasks keep their phase from one state to the other
+        PeriodicTaskMap::const_iterator tasks = m_periodic_task_map.find(m_current_state);
+        if(tasks == m_periodic_task_map.cend())
         {
-            per_function=m_periodic_function_maps.at(m_current_state);
+            return;
         }
-        catch (const std::exception&)
+        for(const PeriodicTask& task : tasks->second) // Sorted by increasing tick divider, so highest rates run first
         {
-            // If there is no function associated with current state we do nothing.
-            // Indeed in some states, it is perfectly legit to do nothing on a periodic basis even if timer is started.
+            // Task runs on ticks 1, 1 + tick_divider, 1 + 2 * tick_divider... i.e. when ceil(tick_nb / tick_divider) changes
+            if((tick_nb + task.tick_divider - 1u) / task.tick_divider != (called_tick_nb + task.tick_divider - 1u) / task.tick_divider && task.function)
+            {
+                task.function();
+            }
         }
-        if(per_function)
+    }
+
+    void AbstractPeriodicStateMachine::sortPeriodicTasks()
+    {
+        for(std::pair<const DwfState, std::vector<PeriodicTask> >& tasks : m_periodic_task_map)
         {
-            per_function();
+            for(const PeriodicTask& task : tasks.second)
+            {
+                if(task.tick_divider == 0u)
+                {
+                    throw std::invalid_argument("Periodic task " + task.name + " has a tick divider of 0");
+                }
+            }
+            std::stable_sort(tasks.second.begin(), tasks.second.end(), [](const PeriodicTask& lhs, const PeriodicTask& rhs){return lhs.tick_divider < rhs.tick_divider;});
         }
     }
 }
@@ -72,22 +72,37 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 */
 
 #include "abstractstatemachine.h"
+#include "dwfpayloadevent.h"
 
 namespace DwfStateMachine
 {
-    AbstractStateMachine::AbstractStateMachine(DwfState initial_state, size_t max_element_nb) : EventSystem::AbstractEventProcessor(max_element_nb), m_current_state(initial_state)
+    AbstractStateMachine::AbstractStateMachine(DwfState initial_state, size_t max_element_nb) : EventSystem::AbstractEventProcessor(max_element_nb), m_current_state(initial_state), m_transition_map(), m_state_timeout_map(),
+        m_timer_service(nullptr), m_timeout_task(DwfTime::DwfTimerService::C_NO_TASK), m_timeout_armed(false), m_timeout_event_id(0u), m_state_entry_nb(0u)
+    {
+    }
+
+    AbstractStateMachine::AbstractStateMachine(DwfState initial_state, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : EventSystem::AbstractEventProcessor(std::move(event_queue)), m_current_state(initial_state), m_transition_map(), m_state_timeout_map(),
+        m_timer_service(nullptr), m_timeout_task(DwfTime::DwfTimerService::C_NO_TASK), m_timeout_armed(false), m_timeout_event_id(0u), m_state_entry_nb(0u)
     {
     }
 
     AbstractStateMachine::~AbstractStateMachine()
     {
         stop();
+        if(m_timeout_task != DwfTime::DwfTimerService::C_NO_TASK)
+        {
+            m_timer_service->cancel(m_timeout_task); // Waits for running timeout function
+        }
     }
 
     void AbstractStateMachine::setupAndStart()
     {
         // Setup transition map
         setupTransitionMap();
+        checkStateTimeoutQueue();
+
+        // Arm timeout of initial state before event processing thread may change state
+        restartStateTimeout();
 
         // Start event processing
         start();
@@ -95,37 +110,98 @@ namespace DwfStateMachine
 
     void AbstractStateMachine::processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event)
     {
-        EventTransitionMap ev_tr_map;
-        TransitionFunction tr_function;
-        bool has_transition_map=true;
+        if(processInternalEvent(event))
+        {
+            return;
+        }
+
+        const bool has_state_timeouts = !m_state_timeout_map.empty();
+        if(has_state_timeouts)
+        {
+            const StateEntryStamp* stamp = EventSystem::DwfPayloadEvent::payloadOf<StateEntryStamp>(*event);
+            if(stamp != nullptr && stamp->entry_nb != m_state_entry_nb) // Timeout of a state left since it was pushed
+            {
+                return;
+            }
+        }
 
-        try
+        // Transition map and function are accessed in place so that dispatching an event never copies them
+        TransitionMap::const_iterator ev_tr_map = m_transition_map.find(m_current_state);
+        if(ev_tr_map == m_transition_map.cend())
         {
-            ev_tr_map=m_transition_map.at(m_current_state);
+            onDeadEndState(DeadEndReason::NO_TRANSITION_MAP);
+            return;
         }
-        catch (const std::exception& e)
+
+        EventTransitionMap::const_iterator tr_function = ev_tr_map->second.find(*event);
+        if(tr_function == ev_tr_map->second.cend())
         {
-            onDeadEndState(e);
-            has_transition_map=false;
+            // If there is no transition associated with event for current state, we do nothing.
+            // Indeed in some states, it is perfectly legit to choose to ignore events.
+            return;
         }
 
-        if(has_transition_map)
+        if(tr_function->second)
         {
-            try
+            const StateID previous_state = m_current_state.getId();
+            tr_function->second(std::move(event));
+            if(has_state_timeouts && m_current_state.getId() != previous_state)
             {
-                tr_function=ev_tr_map.at(*event);
-            }
-            catch (const std::exception&)
-            {
-                // If there is no transition associated with event for current state, we do nothing.
-                // Indeed in some states, it is perfectly legit to choose to ignore events.
-            }
-            if(tr_function)
-            {
-                tr_function(std::move(event));
+                restartStateTimeout();
             }
         }
     }
+
+    void AbstractStateMachine::restartStateTimeout()
+    {
+        if(m_timeout_armed)
+        {
+            m_timer_service->disarm(m_timeout_task); // Waits for running timeout function, so that it does not read members changed below
+            m_timeout_armed = false;
+        }
+        ++m_state_entry_nb; // Timeout events already pushed are discarded
+
+        StateTimeoutMap::const_iterator timeout = m_state_timeout_map.find(m_current_state);
+        if(timeout == m_state_timeout_map.cend())
+        {
+            return;
+        }
+        if(m_timeout_task == DwfTime::DwfTimerService::C_NO_TASK)
+        {
+            m_timer_service = &DwfTime::DwfTimerService::instance();
+            m_timeout_task = m_timer_service->createTask([this]{onStateTimeout();});
+        }
+        m_timeout_event_id = timeout->second.event_id;
+        m_timer_service->arm(m_timeout_task, std::chrono::steady_clock::now() + timeout->second.duration);
+        m_timeout_armed = true;
+    }
+
+    void AbstractStateMachine::checkStateTimeoutQueue() const
+    {
+        if(!m_state_timeout_map.empty() && hasSingleProducerQueue()) // Timeout events would race with events pushed by application thread
+        {
+            throw std::logic_error("State timeouts require an event queue supporting several producer threads");
+        }
+    }
+
+    void AbstractStateMachine::onStateTimeout()
+    {
+        // Never blocks, so that disarming task from event processing thread cannot wait for a full queue
+        tryPushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfPayloadEvent(m_timeout_event_id, StateEntryStamp{m_state_entry_nb})));
+    }
+
+    bool AbstractStateMachine::processInternalEvent(std::unique_ptr<EventSystem::DwfEvent>& /*event*/)
+    {
+        return false;
+    }
+
+    void AbstractStateMachine::onDeadEndState(DeadEndReason /*reason*/)
+    {
+        // Exception is built once and never thrown so that handling dead end states does not slow down event processing
+        static const std::out_of_range no_transition_map("No transition map associated with current state");
+
+        onDeadEndState(no_transition_map);
+    }
 }
 
 //  ______________________________
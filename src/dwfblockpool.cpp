@@ -0,0 +1,349 @@
+/*!
+ * @file dwfblockpool.cpp
+ * @brief Implementation of the pool recycling storage of small objects.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Implementation of a thread safe pool of fixed size blocks used by DwfEvent and DwfMpscQueue node allocation functions.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfblockpool.h"
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace DwfContainers
+{
+    const size_t DwfBlockPool::C_BLOCK_SIZE = 128u; // Two cache lines, so that objects of producers and consumer do not share lines and DwfPayloadEvent fits in a block
+    const size_t DwfBlockPool::C_BATCH_SIZE = 64u;
+
+    /*! @struct FreeBlock
+    *  @brief Free block of the pool, linked to the next free block
+    */
+    struct FreeBlock
+    {
+        FreeBlock* next; /*!< Next free block. nullptr ends the list.*/
+    };
+
+    /*! @struct BlockList
+    *  @brief List of free blocks with its length
+    */
+    struct BlockList
+    {
+        FreeBlock* head; /*!< First block of the list.*/
+        size_t block_nb; /*!< Number of blocks in the list.*/
+    };
+
+    /*! @struct SharedBlocks
+    *  @brief Free blocks shared by all threads
+    */
+    struct SharedBlocks
+    {
+        std::mutex mutex; /*!< Mutex controlling access to the shared blocks.*/
+        std::vector<BlockList> batches; /*!< Full batches of free blocks given back by threads.*/
+        BlockList partial; /*!< Blocks of partial lists given back by threads, gathered until they make a full batch.*/
+        size_t chunk_nb; /*!< Number of chunks obtained from the system.*/
+
+        SharedBlocks() : mutex(), batches(), partial({nullptr, 0u}), chunk_nb(0u)
+        {
+        }
+    };
+
+    /*! @enum CacheState
+    *  @brief State of the cache of a thread
+    */
+    enum class CacheState : uint8_t
+    {
+        UNREGISTERED, /*!< Cache is not flushed at thread exit yet.*/
+        ACTIVE, /*!< Cache is used and will be flushed at thread exit.*/
+        FLUSHED /*!< Thread is exiting. Blocks go directly to shared blocks.*/
+    };
+
+    /*! @struct ThreadCache
+    *  @brief Free blocks of a thread. Trivially destructible so that it can be used until the very end of the thread.
+    */
+    struct ThreadCache
+    {
+        BlockList current; /*!< Blocks allocations are served from and deallocations go to.*/
+        FreeBlock* spare; /*!< Full batch kept to avoid exchanging batches back and forth at the edge of a batch. nullptr if none.*/
+        CacheState state; /*!< State of the cache.*/
+    };
+
+    static thread_local ThreadCache t_cache = {{nullptr, 0u}, nullptr, CacheState::UNREGISTERED}; /*!< Cache of current thread.*/
+
+    /*!
+    * @brief Get blocks shared by all threads
+    * @return Shared blocks
+    *
+    * Shared blocks are never deleted so that events freed during static destruction can still be given back.
+    *
+    */
+    static SharedBlocks& sharedBlocks()
+    {
+        static SharedBlocks* shared = new SharedBlocks();
+        return *shared;
+    }
+
+    /*!
+    * @brief Give a list of free blocks to other threads
+    * @param blocks : Blocks to give. List must end with nullptr.
+    *
+    * Partial lists are gathered into full batches, so that blocks freed one by one at thread exit do not fragment the shared blocks.
+    *
+    */
+    static void giveBlocks(const BlockList& blocks)
+    {
+        if(blocks.block_nb == 0u)
+        {
+            return;
+        }
+        SharedBlocks& shared = sharedBlocks();
+        std::lock_guard<std::mutex> sharedlock(shared.mutex);
+        if(blocks.block_nb >= DwfBlockPool::C_BATCH_SIZE)
+        {
+            shared.batches.push_back(blocks);
+            return;
+        }
+        FreeBlock* block = blocks.head;
+        while(block != nullptr)
+        {
+            FreeBlock* next = block->next;
+            block->next = shared.partial.head;
+            shared.partial.head = block;
+            if(++shared.partial.block_nb == DwfBlockPool::C_BATCH_SIZE)
+            {
+                shared.batches.push_back(shared.partial);
+                shared.partial = {nullptr, 0u};
+            }
+            block = next;
+        }
+    }
+
+    /*!
+    * @brief Take a list of free blocks given by other threads, or obtain a new chunk from the system
+    * @return Non empty list of free blocks
+    *
+    */
+    static BlockList takeBlocks()
+    {
+        SharedBlocks& shared = sharedBlocks();
+        {
+            std::lock_guard<std::mutex> sharedlock(shared.mutex);
+            if(!shared.batches.empty())
+            {
+                BlockList blocks = shared.batches.back();
+                shared.batches.pop_back();
+                return blocks;
+            }
+            if(shared.partial.block_nb > 0u)
+            {
+                BlockList blocks = shared.partial;
+                shared.partial = {nullptr, 0u};
+                return blocks;
+            }
+            ++shared.chunk_nb;
+        }
+        char* chunk = static_cast<char*>(::operator new(DwfBlockPool::C_BATCH_SIZE * DwfBlockPool::C_BLOCK_SIZE));
+        BlockList blocks = {nullptr, DwfBlockPool::C_BATCH_SIZE};
+        for(size_t i = DwfBlockPool::C_BATCH_SIZE; i > 0u; --i) // Chained from the end so that blocks are handed out in address order
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1u) * DwfBlockPool::C_BLOCK_SIZE);
+            block->next = blocks.head;
+            blocks.head = block;
+        }
+        return blocks;
+    }
+
+    /*! @struct CacheFlusher
+    *  @brief Gives free blocks of a thread cache to other threads when the thread exits
+    */
+    struct CacheFlusher
+    {
+        ~CacheFlusher()
+        {
+            giveBlocks(t_cache.current);
+            giveBlocks({t_cache.spare, t_cache.spare != nullptr ? DwfBlockPool::C_BATCH_SIZE : 0u});
+            t_cache = {{nullptr, 0u}, nullptr, CacheState::FLUSHED};
+        }
+    };
+
+    /*!
+    * @brief Prepare cache of current thread for use
+    * @return true if cache can be used, false if thread is exiting
+    *
+    */
+    static bool registerCache()
+    {
+        if(t_cache.state == CacheState::UNREGISTERED)
+        {
+            static thread_local CacheFlusher flusher; // Constructed once per thread, destroyed at thread exit
+            (void)flusher;
+            t_cache.state = CacheState::ACTIVE;
+        }
+        return t_cache.state == CacheState::ACTIVE;
+    }
+
+    void* DwfBlockPool::allocate(size_t size)
+    {
+        if(size > C_BLOCK_SIZE)
+        {
+            return ::operator new(size);
+        }
+        ThreadCache& cache = t_cache;
+        if(cache.current.head == nullptr)
+        {
+            if(!registerCache()) // Thread is exiting, take a block and give the others back
+            {
+                BlockList blocks = takeBlocks();
+                FreeBlock* block = blocks.head;
+                giveBlocks({block->next, blocks.block_nb - 1u});
+                return block;
+            }
+            if(cache.spare != nullptr)
+            {
+                cache.current = {cache.spare, C_BATCH_SIZE};
+                cache.spare = nullptr;
+            }
+            else
+            {
+                cache.current = takeBlocks();
+            }
+        }
+        FreeBlock* block = cache.current.head;
+        cache.current.head = block->next;
+        --cache.current.block_nb;
+        return block;
+    }
+
+    void DwfBlockPool::deallocate(void* object, size_t size)
+    {
+        if(object == nullptr)
+        {
+            return;
+        }
+        if(size > C_BLOCK_SIZE)
+        {
+            ::operator delete(object);
+            return;
+        }
+        FreeBlock* block = static_cast<FreeBlock*>(object);
+        ThreadCache& cache = t_cache;
+        if(cache.state != CacheState::ACTIVE && !registerCache()) // Thread is exiting
+        {
+            block->next = nullptr;
+            giveBlocks({block, 1u});
+            return;
+        }
+        block->next = cache.current.head;
+        cache.current.head = block;
+        if(++cache.current.block_nb == C_BATCH_SIZE) // Keep a full batch aside and give the previous one to other threads
+        {
+            if(cache.spare != nullptr)
+            {
+                giveBlocks({cache.spare, C_BATCH_SIZE});
+            }
+            cache.spare = cache.current.head;
+            cache.current = {nullptr, 0u};
+        }
+    }
+
+    size_t DwfBlockPool::chunkNb()
+    {
+        SharedBlocks& shared = sharedBlocks();
+        std::lock_guard<std::mutex> sharedlock(shared.mutex);
+        return shared.chunk_nb;
+    }
+
+    size_t DwfBlockPool::sharedBatchNb()
+    {
+        SharedBlocks& shared = sharedBlocks();
+        std::lock_guard<std::mutex> sharedlock(shared.mutex);
+        return shared.batches.size();
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -73,7 +73,7 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 namespace DwfTime
 {
-    DwfTimer::DwfTimer() : m_started(false), m_is_single_shot(true), m_timer_period(std::chrono::microseconds(0u))
+    DwfTimer::DwfTimer(TimerBackend backend) : m_service(DwfTimerService::instance(backend)), m_started(false), m_is_single_shot(true), m_timer_period(std::chrono::microseconds(0u)), m_overrun_policy(OverrunPolicy::FIRE_IMMEDIATELY), m_task(m_service.createTask([this]{onTimeout();}))
     {
 
     }
@@ -81,6 +81,7 @@ namespace DwfTime
     DwfTimer::~DwfTimer()
     {
         stop();
+        m_service.cancel(m_task);
     }
 
     void DwfTimer::callOnTimeout(TimeoutFunction called_on_timeout)
@@ -96,6 +97,24 @@ namespace DwfTime
         return m_started;
     }
 
+    std::chrono::microseconds DwfTimer::period() const
+    {
+        return m_timer_period;
+    }
+
+    uint64_t DwfTimer::missedDeadlineNb() const
+    {
+        return m_service.missedDeadlineNb(m_task);
+    }
+
+    void DwfTimer::setOverrunPolicy(OverrunPolicy overrun_policy)
+    {
+        if(!m_started) // We do not alter object if timer is running
+        {
+            m_overrun_policy = overrun_policy;
+        }
+    }
+
     void DwfTimer::setSingleShot(bool is_single_shot)
     {
         if(!m_started) // We do not alter object if timer is running
@@ -106,45 +125,35 @@ namespace DwfTime
 
     void DwfTimer::start()
     {
-        stop(); // Stop timer
-
-        // Restart it
+        // Arming task replaces its previous deadlines, once running timeout function returned
         m_started=true;
-        m_wait_thread=std::thread([this]{waitTimeout();});
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + m_timer_period;
+        if(m_is_single_shot)
+        {
+            m_service.arm(m_task, deadline);
+        }
+        else
+        {
+            m_service.armPeriodic(m_task, deadline, m_timer_period, m_overrun_policy);
+        }
     }
 
-    void DwfTimer::waitTimeout()
+    void DwfTimer::onTimeout()
     {
-        std::chrono::microseconds computation_time(0); // Duration of computation
-        std::chrono::microseconds timer_duration(0);
-        do
+        if(m_is_single_shot)
+        {
+            m_started=false; // Timer is stopped before call, so that function can restart it
+        }
+        if(m_called_on_timeout) // If we have something to do
         {
-            timer_duration=m_timer_period-computation_time; // Reduced timer period by computation duration to keep average execution
-            std::unique_lock<std::mutex> lock(m_cv_mutex);
-            if(m_timeout_wait.wait_for(lock,timer_duration) == std::cv_status::timeout) // If we didn't exit on timeout, we do nothing
-            {
-                std::chrono::steady_clock::time_point start_time=std::chrono::steady_clock::now();
-                if(m_called_on_timeout) // If we have something to do
-                {
-                    m_called_on_timeout();
-                }
-                computation_time=std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()-start_time); // Compute function execution duration to adjust loop time
-            }
-        }while(m_started && !m_is_single_shot); // Execute while started or not single shot timer
-        m_started=false; // Timer is stopped
+            m_called_on_timeout();
+        }
     }
 
     void DwfTimer::stop()
     {
         m_started = false;
-        {
-            std::unique_lock<std::mutex> lock(m_cv_mutex);
-            m_timeout_wait.notify_one();
-        }
-        if(m_wait_thread.joinable())
-        {
-            m_wait_thread.join();
-        }
+        m_service.disarm(m_task); // Waits for running timeout function
     }
 }
 
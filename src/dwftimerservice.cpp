@@ -0,0 +1,528 @@
+/*!
+ * @file dwftimerservice.cpp
+ * @brief Class scheduling timeouts of all timers on a small pool of threads.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class scheduling timeout functions on a fixed number of worker threads, whatever the number of timers.
+ * Used by DwfTimer so that each timer does not need a dedicated thread.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwftimerservice.h"
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+#ifdef __linux__
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/prctl.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace DwfTime
+{
+    const DwfTimerService::TaskID DwfTimerService::C_NO_TASK = 0u;
+    const size_t DwfTimerService::C_SHARED_WORKER_NB = 2u; // So that a long task function does not delay every other timer
+
+    DwfTimerService& DwfTimerService::instance(TimerBackend backend)
+    {
+        if(backend == TimerBackend::TIMERFD)
+        {
+            static DwfTimerService timerfd_service(C_SHARED_WORKER_NB, TimerBackend::TIMERFD);
+            return timerfd_service;
+        }
+        static DwfTimerService service(C_SHARED_WORKER_NB);
+        return service;
+    }
+
+    DwfTimerService::DwfTimerService(size_t worker_nb, TimerBackend backend) : m_mutex(), m_deadline_changed(), m_task_done(), m_tasks(), m_deadlines(), m_next_task(C_NO_TASK + 1u), m_running(true),
+        m_backend(backend), m_epoll_fd(-1), m_timer_fd(-1), m_wake_fd(-1), m_deadline_waited(false), m_workers()
+    {
+        if(m_backend == TimerBackend::TIMERFD)
+        {
+            openTimerFd();
+        }
+        worker_nb = std::max<size_t>(worker_nb, 1u);
+        for(size_t i = 0u; i < worker_nb; ++i)
+        {
+            m_workers.emplace_back([this]{runWorker();});
+        }
+    }
+
+    DwfTimerService::~DwfTimerService()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+        m_deadline_changed.notify_all();
+#ifdef __linux__
+        if(m_wake_fd >= 0)
+        {
+            const uint64_t wake_up = 1u;
+            if(write(m_wake_fd, &wake_up, sizeof(wake_up)) < 0) // Wakes worker waiting in epoll
+            {
+                // Cannot fail with a counter far from overflow
+            }
+        }
+#endif
+        for(std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+        closeTimerFd();
+    }
+
+    DwfTimerService::TaskID DwfTimerService::schedule(std::chrono::steady_clock::time_point deadline, TaskFunction task_function)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const TaskID id = addTask(std::move(task_function), false);
+        armTask(m_tasks.at(id), id, deadline, false, std::chrono::microseconds(0), OverrunPolicy::FIRE_IMMEDIATELY);
+        return id;
+    }
+
+    DwfTimerService::TaskID DwfTimerService::schedulePeriodic(std::chrono::steady_clock::time_point deadline, std::chrono::microseconds period, OverrunPolicy overrun_policy, TaskFunction task_function)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const TaskID id = addTask(std::move(task_function), false);
+        armTask(m_tasks.at(id), id, deadline, true, period, overrun_policy);
+        return id;
+    }
+
+    DwfTimerService::TaskID DwfTimerService::createTask(TaskFunction task_function)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return addTask(std::move(task_function), true);
+    }
+
+    bool DwfTimerService::arm(TaskID task, std::chrono::steady_clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unordered_map<TaskID, Task>::iterator registered_task = waitTaskFunction(lock, task);
+        if(registered_task == m_tasks.end())
+        {
+            return false;
+        }
+        armTask(registered_task->second, task, deadline, false, std::chrono::microseconds(0), OverrunPolicy::FIRE_IMMEDIATELY);
+        return true;
+    }
+
+    bool DwfTimerService::armPeriodic(TaskID task, std::chrono::steady_clock::time_point deadline, std::chrono::microseconds period, OverrunPolicy overrun_policy)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unordered_map<TaskID, Task>::iterator registered_task = waitTaskFunction(lock, task);
+        if(registered_task == m_tasks.end())
+        {
+            return false;
+        }
+        armTask(registered_task->second, task, deadline, true, period, overrun_policy);
+        return true;
+    }
+
+    bool DwfTimerService::disarm(TaskID task)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unordered_map<TaskID, Task>::iterator registered_task = waitTaskFunction(lock, task);
+        if(registered_task == m_tasks.end() || !registered_task->second.armed)
+        {
+            return false;
+        }
+        registered_task->second.armed = false; // Deadline left in heap is discarded when reached
+        ++registered_task->second.generation;
+        return true;
+    }
+
+    bool DwfTimerService::cancel(TaskID task)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unordered_map<TaskID, Task>::iterator registered_task = m_tasks.find(task);
+        if(registered_task == m_tasks.end() || registered_task->second.cancelled)
+        {
+            return false;
+        }
+        if(registered_task->second.running_thread == std::thread::id()) // Deadline is left in heap and discarded when reached
+        {
+            m_tasks.erase(registered_task);
+            return true;
+        }
+        registered_task->second.cancelled = true; // Worker removes task once function returns
+        if(registered_task->second.running_thread != std::this_thread::get_id()) // Waiting from task function would never end
+        {
+            registered_task->second.awaited = true;
+            m_task_done.wait(lock, [this, task]{return m_tasks.find(task) == m_tasks.end();});
+        }
+        return true;
+    }
+
+    size_t DwfTimerService::taskNb() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t task_nb = 0u;
+        for(const std::pair<const TaskID, Task>& task : m_tasks)
+        {
+            if(task.second.armed && !task.second.cancelled)
+            {
+                ++task_nb;
+            }
+        }
+        return task_nb;
+    }
+
+    uint64_t DwfTimerService::missedDeadlineNb(TaskID task) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unordered_map<TaskID, Task>::const_iterator registered_task = m_tasks.find(task);
+        return registered_task != m_tasks.end() ? registered_task->second.missed_deadline_nb : 0u;
+    }
+
+    bool DwfTimerService::isArmed(TaskID task) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unordered_map<TaskID, Task>::const_iterator registered_task = m_tasks.find(task);
+        return registered_task != m_tasks.end() && registered_task->second.armed && !registered_task->second.cancelled;
+    }
+
+    size_t DwfTimerService::workerNb() const
+    {
+        return m_workers.size();
+    }
+
+    TimerBackend DwfTimerService::backend() const
+    {
+        return m_backend;
+    }
+
+    DwfTimerService::TaskID DwfTimerService::addTask(TaskFunction&& task_function, bool persistent)
+    {
+        const TaskID id = m_next_task++;
+        m_tasks.emplace(id, Task{std::move(task_function), persistent, false, 0u, std::chrono::steady_clock::time_point(), false, std::chrono::steady_clock::time_point(), 0u, false, std::chrono::microseconds(0), OverrunPolicy::FIRE_IMMEDIATELY, 0u, std::chrono::steady_clock::time_point(), std::thread::id(), false, false});
+        return id;
+    }
+
+    std::unordered_map<DwfTimerService::TaskID, DwfTimerService::Task>::iterator DwfTimerService::waitTaskFunction(std::unique_lock<std::mutex>& lock, TaskID task)
+    {
+        std::unordered_map<TaskID, Task>::iterator registered_task = m_tasks.find(task);
+        while(registered_task != m_tasks.end() && registered_task->second.running_thread != std::thread::id() && registered_task->second.running_thread != std::this_thread::get_id())
+        {
+            registered_task->second.awaited = true; // Set again at each wait, as task may run again before this thread gets the lock back
+            m_task_done.wait(lock);
+            registered_task = m_tasks.find(task); // Tasks may have been added or removed meanwhile
+        }
+        return registered_task != m_tasks.end() && !registered_task->second.cancelled ? registered_task : m_tasks.end();
+    }
+
+    void DwfTimerService::armTask(Task& task, TaskID id, std::chrono::steady_clock::time_point deadline, bool periodic, std::chrono::microseconds period, OverrunPolicy overrun_policy)
+    {
+        task.armed = true;
+        ++task.generation;
+        task.armed_deadline = deadline;
+        task.periodic = periodic;
+        task.period = period;
+        task.overrun_policy = overrun_policy;
+        task.missed_deadline_nb = 0u;
+        task.counted_until = deadline;
+        if(task.running_thread == std::thread::id() && !(task.queued && task.queued_deadline <= deadline)) // Otherwise worker adds deadline once function returns or once it reaches queued deadline
+        {
+            pushDeadline(task, id, deadline);
+        }
+    }
+
+    std::chrono::steady_clock::time_point DwfTimerService::nextDeadline(Task& task, std::chrono::steady_clock::time_point deadline)
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        const std::chrono::steady_clock::time_point next_deadline = deadline + task.period;
+        if(next_deadline > now || task.period.count() <= 0) // On schedule
+        {
+            return next_deadline;
+        }
+
+        // Deadlines deadline + k * period with k in ]counted, passed] were missed since last count
+        const int64_t passed = (now - deadline) / task.period;
+        const int64_t counted = task.counted_until > deadline ? (task.counted_until - deadline) / task.period : 0;
+        if(passed > counted)
+        {
+            task.missed_deadline_nb += static_cast<uint64_t>(passed - counted);
+            task.counted_until = deadline + passed * task.period;
+        }
+
+        switch(task.overrun_policy)
+        {
+            case OverrunPolicy::SKIP:
+                return deadline + (passed + 1) * task.period;
+            case OverrunPolicy::CATCH_UP:
+                return next_deadline;
+            case OverrunPolicy::FIRE_IMMEDIATELY:
+            default:
+                return now;
+        }
+    }
+
+    void DwfTimerService::pushDeadline(Task& task, TaskID id, std::chrono::steady_clock::time_point deadline)
+    {
+        task.queued = true;
+        task.queued_deadline = deadline;
+        m_deadlines.push_back({deadline, id, ++task.queue_generation});
+        std::push_heap(m_deadlines.begin(), m_deadlines.end(), std::greater<Deadline>());
+        if(m_deadlines.front().time == deadline) // Workers wait for a later deadline
+        {
+            if(m_deadline_waited)
+            {
+                setTimerFd(deadline); // Worker waiting in epoll wakes up on new deadline
+            }
+            else
+            {
+                m_deadline_changed.notify_one();
+            }
+        }
+    }
+
+    void DwfTimerService::runWorker()
+    {
+#ifdef __linux__
+        if(m_backend == TimerBackend::TIMERFD)
+        {
+            prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL); // Default 50 us slack would delay every wake-up
+        }
+#endif
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(m_running)
+        {
+            if(m_deadlines.empty())
+            {
+                m_deadline_changed.wait(lock);
+                continue;
+            }
+            const Deadline next = m_deadlines.front();
+            if(std::chrono::steady_clock::now() < next.time)
+            {
+                waitDeadline(lock, next.time);
+                continue; // Earliest deadline may have changed meanwhile
+            }
+            std::pop_heap(m_deadlines.begin(), m_deadlines.end(), std::greater<Deadline>());
+            m_deadlines.pop_back();
+
+            std::unordered_map<TaskID, Task>::iterator registered_task = m_tasks.find(next.task);
+            if(registered_task == m_tasks.end() || registered_task->second.queue_generation != next.generation) // Task was cancelled or re-armed earlier
+            {
+                continue;
+            }
+            Task& task = registered_task->second; // References to map elements stay valid when other tasks are added
+            task.queued = false;
+            if(!task.armed) // Task was disarmed
+            {
+                continue;
+            }
+            if(next.time < task.armed_deadline) // Task was re-armed later
+            {
+                pushDeadline(task, next.task, task.armed_deadline);
+                continue;
+            }
+            if(!task.periodic) // Kept to be armed again, from task function or once it returned
+            {
+                task.armed = false;
+            }
+            const uint64_t generation = task.generation;
+            task.running_thread = std::this_thread::get_id();
+            if(!m_deadlines.empty()) // Another worker takes over wait for next deadline, as it may wait for an empty heap or for timerfd waiter
+            {
+                m_deadline_changed.notify_one();
+            }
+            lock.unlock();
+            if(task.task_function)
+            {
+                task.task_function();
+            }
+            lock.lock();
+            task.running_thread = std::thread::id();
+            if(task.awaited)
+            {
+                task.awaited = false;
+                m_task_done.notify_all();
+            }
+
+            if(task.cancelled || (!task.persistent && !task.periodic && task.generation == generation))
+            {
+                m_tasks.erase(next.task);
+            }
+            else if(task.generation != generation) // Task was armed or disarmed while its function was running
+            {
+                if(task.armed)
+                {
+                    pushDeadline(task, next.task, task.armed_deadline);
+                }
+            }
+            else if(task.periodic)
+            {
+                task.armed_deadline = nextDeadline(task, next.time);
+                pushDeadline(task, next.task, task.armed_deadline);
+            }
+        }
+    }
+
+    void DwfTimerService::waitDeadline(std::unique_lock<std::mutex>& lock, std::chrono::steady_clock::time_point deadline)
+    {
+        if(m_backend == TimerBackend::CONDITION_VARIABLE)
+        {
+            m_deadline_changed.wait_until(lock, deadline);
+            return;
+        }
+        if(m_deadline_waited) // Another worker waits in epoll
+        {
+            m_deadline_changed.wait(lock);
+            return;
+        }
+#ifdef __linux__
+        m_deadline_waited = true;
+        setTimerFd(deadline);
+        lock.unlock();
+        epoll_event events[2];
+        epoll_wait(m_epoll_fd, events, 2, -1); // Interrupted waits are retried by caller
+        uint64_t expiration_nb = 0u;
+        if(read(m_timer_fd, &expiration_nb, sizeof(expiration_nb)) < 0) // Level triggered epoll would return at once if fd were left readable
+        {
+            // Not expired yet, woken by service stop
+        }
+        lock.lock();
+        m_deadline_waited = false;
+#endif
+    }
+
+    void DwfTimerService::openTimerFd()
+    {
+#ifdef __linux__
+        m_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        m_wake_fd = eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+        m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        bool opened = m_timer_fd >= 0 && m_wake_fd >= 0 && m_epoll_fd >= 0;
+        for(int fd : {m_timer_fd, m_wake_fd})
+        {
+            epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            opened = opened && epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0;
+        }
+        if(!opened)
+        {
+            const int error = errno;
+            closeTimerFd();
+            throw std::system_error(error, std::system_category(), "Could not create timerfd backend");
+        }
+#else
+        throw std::invalid_argument("timerfd backend is only available on Linux");
+#endif
+    }
+
+    void DwfTimerService::closeTimerFd()
+    {
+#ifdef __linux__
+        for(int* fd : {&m_epoll_fd, &m_timer_fd, &m_wake_fd})
+        {
+            if(*fd >= 0)
+            {
+                close(*fd);
+                *fd = -1;
+            }
+        }
+#endif
+    }
+
+    void DwfTimerService::setTimerFd(std::chrono::steady_clock::time_point deadline)
+    {
+#ifdef __linux__
+        const int64_t deadline_ns = std::max<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count(), 1); // 0 would disarm timer
+        itimerspec timer_spec = {};
+        timer_spec.it_value.tv_sec = static_cast<time_t>(deadline_ns / 1000000000);
+        timer_spec.it_value.tv_nsec = static_cast<long>(deadline_ns % 1000000000);
+        timerfd_settime(m_timer_fd, TFD_TIMER_ABSTIME, &timer_spec, nullptr);
+#else
+        static_cast<void>(deadline);
+#endif
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,206 @@
+/*!
+ * @file flatstatemachine.cpp
+ * @brief Class representing event based state machine dispatching events through a flat transition table.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class representing an event based state machine.
+ * Transition map is compiled into a contiguous table indexed by state and event IDs when machine is started.
+ * Inherits from AbstractEventProcessor.
+ * Abstract class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "flatstatemachine.h"
+#include <algorithm>
+
+namespace DwfStateMachine
+{
+    const size_t FlatStateMachine::C_MAX_TABLE_SIZE = 1u << 24u;
+
+    FlatStateMachine::FlatStateMachine(DwfState initial_state, size_t max_element_nb) : EventSystem::AbstractEventProcessor(max_element_nb), m_current_state(initial_state),
+        m_state_nb(0u), m_event_nb(0u)
+    {
+    }
+
+    FlatStateMachine::FlatStateMachine(DwfState initial_state, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : EventSystem::AbstractEventProcessor(std::move(event_queue)), m_current_state(initial_state),
+        m_state_nb(0u), m_event_nb(0u)
+    {
+    }
+
+    FlatStateMachine::~FlatStateMachine()
+    {
+        stop();
+    }
+
+    void FlatStateMachine::setupAndStart()
+    {
+        // Setup transition map
+        setupTransitionMap();
+
+        // Build transition table from it
+        compileTransitionTable();
+
+        // Start event processing
+        start();
+    }
+
+    void FlatStateMachine::processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event)
+    {
+        const StateID state = m_current_state.getId();
+        if(state >= m_state_nb) // State absent from transition map
+        {
+            onDeadEndState(DeadEndReason::NO_TRANSITION_MAP);
+            return;
+        }
+        if(m_is_dead_end[state])
+        {
+            onDeadEndState(DeadEndReason::NO_TRANSITION_MAP);
+            return;
+        }
+
+        const EventSystem::EventID event_id = event->getId();
+        if(event_id < m_event_nb) // Events with greater IDs have no transition in any state
+        {
+            const TransitionIndex transition = m_transition_table[static_cast<size_t>(state) * m_event_nb + event_id];
+            if(transition != 0u)
+            {
+                m_transition_functions[transition](std::move(event));
+            }
+        }
+        // If there is no transition associated with event for current state, we do nothing.
+        // Indeed in some states, it is perfectly legit to choose to ignore events.
+    }
+
+    void FlatStateMachine::compileTransitionTable()
+    {
+        // Table dimensions are given by greatest IDs
+        size_t state_nb = 0u;
+        size_t event_nb = 0u;
+        size_t transition_nb = 0u;
+        for(const TransitionMap::value_type& state : m_transition_map)
+        {
+            state_nb = std::max(state_nb, static_cast<size_t>(state.first.getId()) + 1u);
+            for(const EventTransitionMap::value_type& transition : state.second)
+            {
+                event_nb = std::max(event_nb, static_cast<size_t>(transition.first.getId()) + 1u);
+                ++transition_nb;
+            }
+        }
+        if(state_nb > C_MAX_TABLE_SIZE / std::max(event_nb, static_cast<size_t>(1u)))
+        {
+            throw std::length_error("Transition table would exceed maximum size. State and event IDs are too sparse");
+        }
+
+        // Fill table
+        std::vector<TransitionFunction> transition_functions;
+        transition_functions.reserve(transition_nb + 1u);
+        transition_functions.emplace_back(); // Index 0 means no transition
+        std::vector<TransitionIndex> transition_table(state_nb * event_nb, 0u);
+        std::vector<bool> is_dead_end(state_nb, true);
+
+        for(const TransitionMap::value_type& state : m_transition_map)
+        {
+            const size_t row = static_cast<size_t>(state.first.getId()) * event_nb;
+            is_dead_end[state.first.getId()] = false; // Events of a state with an empty map are ignored, as AbstractStateMachine does
+            for(const EventTransitionMap::value_type& transition : state.second)
+            {
+                if(transition.second) // Empty functions are kept as no transition
+                {
+                    transition_table[row + transition.first.getId()] = static_cast<TransitionIndex>(transition_functions.size());
+                    transition_functions.push_back(transition.second);
+                }
+            }
+        }
+
+        m_transition_functions.swap(transition_functions);
+        m_transition_table.swap(transition_table);
+        m_is_dead_end.swap(is_dead_end);
+        m_state_nb = static_cast<StateID>(state_nb);
+        m_event_nb = static_cast<EventSystem::EventID>(event_nb);
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
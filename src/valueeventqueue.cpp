@@ -0,0 +1,256 @@
+/*!
+ * @file valueeventqueue.cpp
+ * @brief Implementation of an event queue storing value events inline
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "valueeventqueue.h"
+
+namespace EventSystem
+{
+    /*!
+    * @brief Indicates whether two queued events have the same EventID
+    * @param lhs : first event
+    * @param rhs : second event
+    * @return true if events have the same EventID, false otherwise
+    *
+    * Key comparison of value event queues coalescing events.
+    *
+    */
+    static bool sameSlotId(const EventSlot& lhs, const EventSlot& rhs)
+    {
+        return lhs.getId() == rhs.getId();
+    }
+
+    ValueEventQueue::ValueEventQueue(size_t max_element_nb, DwfContainers::OverflowPolicy overflow_policy, DwfContainers::WaitStrategy wait_strategy) :
+        m_queue(max_element_nb, overflow_policy, sameSlotId, wait_strategy)
+    {
+    }
+
+    ValueEventQueue::~ValueEventQueue()
+    {
+    }
+
+    void ValueEventQueue::push(std::unique_ptr<DwfEvent>&& event)
+    {
+        EventSlot slot(std::move(event));
+        try
+        {
+            m_queue.push(std::move(slot));
+        }
+        catch(...)
+        {
+            event = std::move(slot.event()); // Slot is not moved if an exception is thrown
+            throw;
+        }
+        if(slot.event()) // Slot is not moved if it is dropped
+        {
+            event = std::move(slot.event());
+        }
+    }
+
+    DwfContainers::PushStatus ValueEventQueue::tryPush(std::unique_ptr<DwfEvent>&& event)
+    {
+        EventSlot slot(std::move(event));
+        const DwfContainers::PushStatus status = m_queue.tryPush(std::move(slot));
+        if(status != DwfContainers::PushStatus::PUSHED)
+        {
+            event = std::move(slot.event());
+        }
+        return status;
+    }
+
+    DwfContainers::PushStatus ValueEventQueue::pushFor(std::unique_ptr<DwfEvent>&& event, std::chrono::nanoseconds timeout)
+    {
+        EventSlot slot(std::move(event));
+        const DwfContainers::PushStatus status = m_queue.pushFor(std::move(slot), timeout);
+        if(status != DwfContainers::PushStatus::PUSHED)
+        {
+            event = std::move(slot.event());
+        }
+        return status;
+    }
+
+    void ValueEventQueue::pushBatch(std::vector< std::unique_ptr<DwfEvent> >& events)
+    {
+        std::vector<EventSlot> slots;
+        slots.reserve(events.size());
+        for(std::unique_ptr<DwfEvent>& event : events)
+        {
+            slots.emplace_back(std::move(event));
+        }
+        try
+        {
+            m_queue.pushBatch(slots);
+        }
+        catch(...)
+        {
+            for(size_t i = 0u; i < slots.size(); ++i) // No slot is moved if an exception is thrown
+            {
+                events[i] = std::move(slots[i].event());
+            }
+            throw;
+        }
+        events.clear();
+    }
+
+    void ValueEventQueue::pop(std::unique_ptr<DwfEvent>& event)
+    {
+        std::vector<EventSlot> slots;
+        std::vector< std::unique_ptr<DwfEvent> > events;
+        if(m_queue.popUpTo(1u, slots) > 0u)
+        {
+            unboxSlots(slots, events);
+            event = std::move(events.front());
+        }
+    }
+
+    size_t ValueEventQueue::popUpTo(size_t max_event_nb, std::vector< std::unique_ptr<DwfEvent> >& events)
+    {
+        std::vector<EventSlot> slots;
+        const size_t popped_nb = m_queue.popUpTo(max_event_nb, slots);
+        unboxSlots(slots, events);
+        return popped_nb;
+    }
+
+    void ValueEventQueue::disableWait()
+    {
+        m_queue.disableWait();
+    }
+
+    void ValueEventQueue::enableWait()
+    {
+        m_queue.enableWait();
+    }
+
+    void ValueEventQueue::clear()
+    {
+        m_queue.clear();
+    }
+
+    uint64_t ValueEventQueue::droppedEventNb() const
+    {
+        return m_queue.droppedElementNb();
+    }
+
+    uint64_t ValueEventQueue::coalescedEventNb() const
+    {
+        return m_queue.coalescedElementNb();
+    }
+
+    bool ValueEventQueue::storesValues() const
+    {
+        return true;
+    }
+
+    void ValueEventQueue::pushValue(const DwfValueEvent& event)
+    {
+        m_queue.push(EventSlot(event));
+    }
+
+    size_t ValueEventQueue::popSlotsUpTo(size_t max_event_nb, std::vector<EventSlot>& slots)
+    {
+        return m_queue.popUpTo(max_event_nb, slots);
+    }
+
+    void ValueEventQueue::unboxSlots(std::vector<EventSlot>& slots, std::vector< std::unique_ptr<DwfEvent> >& events)
+    {
+        for(EventSlot& slot : slots)
+        {
+            if(slot.byValue())
+            {
+                events.emplace_back(new BoxedValueEvent(slot.value()));
+            }
+            else
+            {
+                events.push_back(std::move(slot.event()));
+            }
+        }
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -91,6 +91,17 @@ public:
         CPPUNIT_TEST(testSizeLimit);
         CPPUNIT_TEST(testInheritance);
         CPPUNIT_TEST(testStop);
+        CPPUNIT_TEST(testSpscQueue);
+        CPPUNIT_TEST(testMpscQueue);
+        CPPUNIT_TEST(testNullQueue);
+        CPPUNIT_TEST(testBatchProcessing);
+        CPPUNIT_TEST(testPushEvents);
+        CPPUNIT_TEST(testTryPushEvent);
+        CPPUNIT_TEST(testBlockingPushEvent);
+        CPPUNIT_TEST(testCoalescingEvents);
+        CPPUNIT_TEST(testCoalescingQueue);
+        CPPUNIT_TEST(testPriorityQueue);
+        CPPUNIT_TEST(testValueEvents);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -186,6 +197,119 @@ public:
     */
     void testStop();
 
+    /*!
+    * @brief Check event processing with a lock-free single producer single consumer queue
+    *
+    * 0) Create TestEventProcessor using a DwfSpscQueue of size N and very long computation time for first event only.
+    * 1) Start event processing and push events. Check exception is raised when queue is full.
+    * 2) Check events were processed in order.
+    *
+    */
+    void testSpscQueue();
+
+    /*!
+    * @brief Check event processing with a lock-free multiple producers single consumer queue
+    *
+    * 0) Create TestEventProcessor using a DwfMpscQueue and start it.
+    * 1) Spawn producer threads pushing events concurrently.
+    * 2) Check all events were processed, in order for each producer.
+    *
+    */
+    void testMpscQueue();
+
+    /*!
+    * @brief Check construction with a null queue
+    *
+    * 0) Check TestEventProcessor construction throws std::invalid_argument.
+    *
+    */
+    void testNullQueue();
+
+    /*!
+    * @brief Check batch processing behavior
+    *
+    * 0) Create TestEventProcessor with long computation time, drain all available events at once and start it.
+    * 1) Push a few events while first one is processed.
+    * 2) Check all events were processed in order, in fewer batches than events.
+    * 3) Limit batch size, wake pending pop, push events and check batches are not greater than limit.
+    *
+    */
+    void testBatchProcessing();
+
+    /*!
+    * @brief Check pushing several events at once
+    *
+    * 0) Create TestEventProcessor with queue of size N and very long computation time.
+    * 1) Push a batch of events before start. Check they are dropped.
+    * 2) Start event processor and push a batch of N events. Check they are moved.
+    * 3) Push a batch on full queue and check exception is raised and nothing is moved.
+    * 4) Check order of processed events.
+    *
+    */
+    void testPushEvents();
+
+    /*!
+    * @brief Check non throwing push behavior
+    *
+    * 0) Create TestEventProcessor with queue of size N and very long computation time.
+    * 1) Push event before start. Check it is reported as dropped.
+    * 2) Start event processor and push events until queue is full. Check status.
+    * 3) Push event on full queue. Check status and that event is not moved.
+    *
+    */
+    void testTryPushEvent();
+
+    /*!
+    * @brief Check push behavior with blocking overflow policy
+    *
+    * 0) Create TestEventProcessor with a blocking queue of size N and long computation time. Start it.
+    * 1) Fill queue then spawn a pushing thread. Check it waits for processing to free room.
+    * 2) Push with a short timeout on full queue. Check it times out.
+    * 3) Spawn a pushing thread then stop event processor. Check push throws an exception.
+    *
+    */
+    void testBlockingPushEvent();
+
+    /*!
+    * @brief Check events coalescing when queue is full
+    *
+    * 0) Create TestEventProcessor with a coalescing queue of size 2 and long computation time. Start it.
+    * 1) Fill queue with an int and a string event. Push many int events and a string event.
+    * 2) Wait for processing. Check only latest int and string events are processed and counters.
+    *
+    */
+    void testCoalescingEvents();
+
+    /*!
+    * @brief Check event processing with a queue coalescing events by EventID
+    *
+    * 0) Create TestEventProcessor using a DwfCoalescingQueue and long computation time. Start it.
+    * 1) Push an event to be under processing. Then push many int and string events.
+    * 2) Wait for processing. Check only latest int and string events are processed, once each.
+    *
+    */
+    void testCoalescingQueue();
+
+    /*!
+    * @brief Check event processing with a priority queue
+    *
+    * 0) Create TestEventProcessor using a PriorityEventQueue with 2 lanes and long computation time. Start it.
+    * 1) Push an event to be under processing. Then push low priority events and a high priority event.
+    * 2) Wait for processing. Check high priority event is processed before low priority ones.
+    *
+    */
+    void testPriorityQueue();
+
+    /*!
+    * @brief Check processing of value events
+    *
+    * 0) Create and start TestEventProcessor with default queue. Check value events are rejected.
+    * 1) Create and start TestEventProcessor using a ValueEventQueue. Push value events and polymorphic events.
+    * 2) Wait for processing. Check all events are processed in push order and polymorphic events keep their type.
+    *
+    */
+    void testValueEvents();
+
 };
 
 #endif // ABSTRACT_EVENT_PROCESSOR_TEST_H
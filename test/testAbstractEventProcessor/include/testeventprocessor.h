@@ -135,9 +135,18 @@ public:
     * @brief Constructor of TestEventProcessor class
     * @param max_element_nb : Max number of elements that can be stored in event queue. Default indicates no size limitation.
     * @param process_duration : Duration of event processing. Default indicates processing takes no time.
+    * @param overflow_policy : Behavior of pushEvent when event queue is full. Default throws an exception.
     *
     */
-    TestEventProcessor(size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT, std::chrono::duration<int,std::milli> process_duration=std::chrono::milliseconds(0));
+    TestEventProcessor(size_t max_element_nb = DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT, std::chrono::duration<int,std::milli> process_duration=std::chrono::milliseconds(0), DwfContainers::OverflowPolicy overflow_policy=DwfContainers::OverflowPolicy::THROW);
+
+    /*!
+    * @brief Constructor of TestEventProcessor class
+    * @param event_queue : Queue used to store events.
+    * @param process_duration : Duration of event processing. Default indicates processing takes no time.
+    *
+    */
+    TestEventProcessor(std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue, std::chrono::duration<int,std::milli> process_duration=std::chrono::milliseconds(0));
 
     /*!
     * @brief Get number of processed events
@@ -175,6 +184,15 @@ public:
     */
     std::vector<std::string> getStrEventsVal() const;
 
+    /*!
+    * @brief Get number of processed batches
+    * @return Get counter of processEvents calls
+    *
+    * Constant method.
+    *
+    */
+    uint32_t getProcessedBatchesNumber() const;
+
 protected:
     /*!
     * @brief Process received event
@@ -185,9 +203,20 @@ protected:
     */
     virtual void processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event);
 
+    /*!
+    * @brief Process a batch of received events
+    * @param events : latest events extracted from event queue
+    *
+    * Count batches then process each event.
+    *
+    */
+    virtual void processEvents(std::vector< std::unique_ptr<EventSystem::DwfEvent> >& events);
+
 private:
     std::atomic<uint32_t> m_processed_events_number; /*!< Counter of processed events.*/
 
+    std::atomic<uint32_t> m_processed_batches_number; /*!< Counter of processed batches.*/
+
     std::vector<EventSystem::EventID> m_received_ids; /*!< Events queue.*/
 
     std::chrono::duration<int,std::milli> m_process_duration; /*!< Duration of event processing to simulate long computations.*/
@@ -72,8 +72,16 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "abstracteventprocessortest.h"
 #include "testeventprocessor.h"
+#include "eventqueue.h"
+#include "dwfspscqueue.h"
+#include "dwfmpscqueue.h"
+#include "dwfcoalescingqueue.h"
+#include "priorityeventqueue.h"
+#include "valueeventqueue.h"
 
 #include <chrono>
+#include <stdexcept>
+#include <thread>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(AbstractEventProcessorTest);
 
@@ -344,6 +352,482 @@ void AbstractEventProcessorTest::testStop()
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Only first event pushed should have been stored", 1u, received_ids[0]);
 }
 
+void AbstractEventProcessorTest::testSpscQueue()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 5u;
+    std::unique_ptr<EventSystem::AbstractEventQueue> queue(new EventSystem::EventQueue< DwfContainers::DwfSpscQueue< std::unique_ptr<EventSystem::DwfEvent> > >(queue_size));
+    TestEventProcessor ev_processor(std::move(queue), std::chrono::milliseconds(200));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Start and Push                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.start();
+    std::unique_ptr<EventSystem::DwfEvent> first_ev(new EventSystem::DwfEvent(1));
+    ev_processor.pushEvent(std::move(first_ev));
+    std::this_thread::sleep_for (std::chrono::milliseconds(50)); // Wait a little bit for first event to be under processing
+
+    for(EventSystem::EventID i=2; i<=queue_size+1; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(i));
+        CPPUNIT_ASSERT_NO_THROW_MESSAGE("Pushing events when queue is not full should not trigger exception",ev_processor.pushEvent(std::move(ev)));
+    }
+    std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(42));
+    CPPUNIT_ASSERT_THROW_MESSAGE("Pushing events when queue is full should trigger exception",ev_processor.pushEvent(std::move(ev)), std::runtime_error);
+    CPPUNIT_ASSERT_MESSAGE("Event should not be moved when queue is full", ev != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        2 : Check event order                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for (std::chrono::milliseconds(1500)); // Wait for all events to be processed
+    ev_processor.stop();
+    std::vector<EventSystem::EventID> received_ids = ev_processor.getReceivedIds();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All pushed events should have been processed", queue_size+1, received_ids.size());
+    for(uint32_t i=1; i<=received_ids.size(); ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Events have not been received in order", i, received_ids[i-1]);
+    }
+}
+
+void AbstractEventProcessorTest::testMpscQueue()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::AbstractEventQueue> queue(new EventSystem::EventQueue< DwfContainers::DwfMpscQueue< std::unique_ptr<EventSystem::DwfEvent> > >());
+    TestEventProcessor ev_processor(std::move(queue));
+    ev_processor.start();
+    const uint32_t producer_nb = 4u;
+    const uint32_t event_nb = 1000u; // Per producer
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     1 : Spawn producer threads                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<std::thread> producers;
+    for(uint32_t producer=0u; producer<producer_nb; ++producer)
+    {
+        producers.emplace_back([&ev_processor, producer, event_nb]()
+        {
+            for(uint32_t i=0u; i<event_nb; ++i)
+            {
+                std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(producer*event_nb + i));
+                ev_processor.pushEvent(std::move(ev));
+            }
+        });
+    }
+    for(std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        2 : Check event order                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for (std::chrono::milliseconds(200)); // Wait for all events to be processed
+    ev_processor.stop();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All pushed events should have been processed", producer_nb*event_nb, ev_processor.getProcessedEventsNumber());
+    std::vector<EventSystem::EventID> received_ids = ev_processor.getReceivedIds();
+    std::vector<uint32_t> expected(producer_nb, 0u);
+    for(EventSystem::EventID id : received_ids)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Events of a producer have not been received in order", expected[id / event_nb], id % event_nb);
+        ++expected[id / event_nb];
+    }
+}
+
+void AbstractEventProcessorTest::testNullQueue()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             0 : Create                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_THROW_MESSAGE("Event processor cannot work without event queue", TestEventProcessor(std::unique_ptr<EventSystem::AbstractEventQueue>()), std::invalid_argument);
+}
+
+void AbstractEventProcessorTest::testBatchProcessing()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestEventProcessor ev_processor(DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> >::C_NO_SIZE_LIMIT, std::chrono::milliseconds(50));
+    ev_processor.setMaxBatchSize(0u);
+    ev_processor.start();
+    uint32_t event_nb=5u;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(EventSystem::EventID i=1; i<=event_nb; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(i));
+        ev_processor.pushEvent(std::move(ev));
+    }
+    std::this_thread::sleep_for (std::chrono::milliseconds(500)); // Wait for all events to be processed
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Check batches                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All events should have been processed", event_nb, ev_processor.getProcessedEventsNumber());
+    CPPUNIT_ASSERT_MESSAGE("Events pushed during processing should be drained together", ev_processor.getProcessedBatchesNumber() < event_nb);
+    std::vector<EventSystem::EventID> received_ids = ev_processor.getReceivedIds();
+    for(uint32_t i=1; i<=received_ids.size(); ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Events have not been received in order", i, received_ids[i-1]);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        3 : Limit batch size                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.setMaxBatchSize(2u);
+    std::unique_ptr<EventSystem::DwfEvent> wake_ev(new EventSystem::DwfEvent(42)); // Pending pop still uses previous batch size
+    ev_processor.pushEvent(std::move(wake_ev));
+    std::this_thread::sleep_for (std::chrono::milliseconds(100));
+    const uint32_t previous_batches_nb = ev_processor.getProcessedBatchesNumber();
+    for(EventSystem::EventID i=1; i<=event_nb; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(i));
+        ev_processor.pushEvent(std::move(ev));
+    }
+    std::this_thread::sleep_for (std::chrono::milliseconds(500)); // Wait for all events to be processed
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All events should have been processed", 2u*event_nb+1u, ev_processor.getProcessedEventsNumber());
+    CPPUNIT_ASSERT_MESSAGE("Batches should not contain more than 2 events", ev_processor.getProcessedBatchesNumber() - previous_batches_nb >= (event_nb+1u)/2u);
+}
+
+void AbstractEventProcessorTest::testPushEvents()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const uint32_t queue_size = 5u;
+    TestEventProcessor ev_processor(queue_size, std::chrono::milliseconds(50));
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > batch;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push before start                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    batch.emplace_back(new EventSystem::DwfEvent(42));
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("Pushing events when not started causes no exception because events are dropped", ev_processor.pushEvents(batch));
+    batch.clear();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Start and Push                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.start();
+    for(EventSystem::EventID i=1; i<=queue_size; ++i)
+    {
+        batch.emplace_back(new EventSystem::DwfEvent(i));
+    }
+    ev_processor.pushEvents(batch);
+    CPPUNIT_ASSERT_MESSAGE("Batch should be cleared once pushed", batch.empty());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        3 : Push on full queue                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(EventSystem::EventID i=1; i<=queue_size; ++i)
+    {
+        batch.emplace_back(new EventSystem::DwfEvent(100+i));
+    }
+    CPPUNIT_ASSERT_THROW_MESSAGE("Pushing a batch which does not fit in queue should trigger exception", ev_processor.pushEvents(batch), std::runtime_error);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Batch should not be moved if queue is full", static_cast<size_t>(queue_size), batch.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        4 : Check event order                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for (std::chrono::milliseconds(500)); // Wait for all events to be processed
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All events of pushed batch should have been processed", queue_size, ev_processor.getProcessedEventsNumber());
+    std::vector<EventSystem::EventID> received_ids = ev_processor.getReceivedIds();
+    for(uint32_t i=1; i<=received_ids.size(); ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Events have not been received in order", i, received_ids[i-1]);
+    }
+}
+
+void AbstractEventProcessorTest::testTryPushEvent()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const uint32_t queue_size = 5u;
+    TestEventProcessor ev_processor(queue_size, std::chrono::milliseconds(1000));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push before start                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> dropped_ev(new EventSystem::DwfEvent(42));
+    CPPUNIT_ASSERT_MESSAGE("Events pushed before start should be dropped", DwfContainers::PushStatus::NOT_STARTED == ev_processor.tryPushEvent(std::move(dropped_ev)));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Start and Push                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.start();
+    std::unique_ptr<EventSystem::DwfEvent> first_ev(new EventSystem::DwfEvent(0));
+    CPPUNIT_ASSERT_MESSAGE("Push on not full queue should succeed", DwfContainers::PushStatus::PUSHED == ev_processor.tryPushEvent(std::move(first_ev)));
+    std::this_thread::sleep_for (std::chrono::milliseconds(100)); // Wait a little bit for first event to be under processing
+    for(EventSystem::EventID i=1; i<=queue_size; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(i));
+        CPPUNIT_ASSERT_MESSAGE("Push on not full queue should succeed", DwfContainers::PushStatus::PUSHED == ev_processor.tryPushEvent(std::move(ev)));
+        CPPUNIT_ASSERT_MESSAGE("Pushed event should be moved", ev == nullptr);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        3 : Push on full queue                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(12));
+    CPPUNIT_ASSERT_MESSAGE("Push on full queue should report it", DwfContainers::PushStatus::FULL == ev_processor.tryPushEvent(std::move(ev)));
+    CPPUNIT_ASSERT_MESSAGE("Event should not be moved when queue is full", ev != nullptr);
+}
+
+void AbstractEventProcessorTest::testBlockingPushEvent()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const uint32_t queue_size = 2u;
+    TestEventProcessor ev_processor(std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> > >(queue_size, DwfContainers::OverflowPolicy::BLOCK)), std::chrono::milliseconds(200));
+    ev_processor.start();
+    std::atomic<bool> pushed(false);
+    std::atomic<bool> thrown(false);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        1 : Wait for free room                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(0)));
+    std::this_thread::sleep_for (std::chrono::milliseconds(50)); // Wait a little bit for first event to be under processing
+    for(EventSystem::EventID i=1; i<=queue_size; ++i)
+    {
+        ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(i)));
+    }
+    std::thread pusher([&ev_processor, &pushed]()
+    {
+        ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(42)));
+        pushed = true;
+    });
+    std::this_thread::sleep_for (std::chrono::milliseconds(50));
+    CPPUNIT_ASSERT_MESSAGE("Push should wait while queue is full", !pushed);
+    pusher.join();
+    CPPUNIT_ASSERT_MESSAGE("Push should complete once an event has been processed", pushed);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        2 : Push with timeout                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(12));
+    CPPUNIT_ASSERT_MESSAGE("Push on queue staying full should time out", DwfContainers::PushStatus::TIMEOUT == ev_processor.pushEventFor(std::move(ev), std::chrono::milliseconds(10)));
+    CPPUNIT_ASSERT_MESSAGE("Event should not be moved if push timed out", ev != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        3 : Stop while waiting                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread blocked_pusher([&ev_processor, &thrown]()
+    {
+        try
+        {
+            ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(13)));
+        }
+        catch(const std::runtime_error&)
+        {
+            thrown = true;
+        }
+    });
+    std::this_thread::sleep_for (std::chrono::milliseconds(50)); // Wait a little bit for pushing thread to wait for room
+    ev_processor.stop();
+    blocked_pusher.join();
+    CPPUNIT_ASSERT_MESSAGE("Waiting push should throw when event processing is stopped", thrown);
+}
+
+void AbstractEventProcessorTest::testCoalescingEvents()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const uint32_t coalesced_nb = 100u;
+    TestEventProcessor ev_processor(2u, std::chrono::milliseconds(100), DwfContainers::OverflowPolicy::COALESCE_BY_ID);
+    ev_processor.start();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             1 : Push                               ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(0)));
+    std::this_thread::sleep_for (std::chrono::milliseconds(50)); // Wait a little bit for first event to be under processing
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new IntEvent(0)));
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new StrEvent("first")));
+    for(uint32_t i=1; i<=coalesced_nb; ++i)
+    {
+        ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new IntEvent(static_cast<int>(i))));
+    }
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new StrEvent("latest")));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             2 : Check                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for (std::chrono::milliseconds(500));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Coalesced events should be processed once", static_cast<uint32_t>(3u), ev_processor.getProcessedEventsNumber());
+    CPPUNIT_ASSERT_MESSAGE("Latest int event should be processed", std::vector<int>({static_cast<int>(coalesced_nb)}) == ev_processor.getIntEventsVal());
+    CPPUNIT_ASSERT_MESSAGE("Latest string event should be processed", std::vector<std::string>({"latest"}) == ev_processor.getStrEventsVal());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of coalesced events is not correct", static_cast<uint64_t>(coalesced_nb + 1u), ev_processor.coalescedEventNb());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("No event should be dropped", static_cast<uint64_t>(0u), ev_processor.droppedEventNb());
+}
+
+void AbstractEventProcessorTest::testCoalescingQueue()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const int update_nb = 1000;
+    std::unique_ptr<EventSystem::AbstractEventQueue> queue(new EventSystem::EventQueue< DwfContainers::DwfCoalescingQueue< std::unique_ptr<EventSystem::DwfEvent>, EventSystem::EventID, EventSystem::EventIdOf > >());
+    TestEventProcessor ev_processor(std::move(queue), std::chrono::milliseconds(100));
+    ev_processor.start();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             1 : Push                               ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(0)));
+    std::this_thread::sleep_for (std::chrono::milliseconds(50)); // Wait a little bit for first event to be under processing
+    for(int i=1; i<=update_nb; ++i)
+    {
+        ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new IntEvent(i)));
+        ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new StrEvent(std::to_string(i))));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             2 : Check                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for (std::chrono::milliseconds(500));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Coalesced events should be processed once", static_cast<uint32_t>(3u), ev_processor.getProcessedEventsNumber());
+    CPPUNIT_ASSERT_MESSAGE("Latest int event should be processed", std::vector<int>({update_nb}) == ev_processor.getIntEventsVal());
+    CPPUNIT_ASSERT_MESSAGE("Latest string event should be processed", std::vector<std::string>({std::to_string(update_nb)}) == ev_processor.getStrEventsVal());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of coalesced events is not correct", static_cast<uint64_t>(2*update_nb - 2), ev_processor.coalescedEventNb());
+}
+
+void AbstractEventProcessorTest::testPriorityQueue()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::AbstractEventQueue> queue(new EventSystem::PriorityEventQueue(2u));
+    TestEventProcessor ev_processor(std::move(queue), std::chrono::milliseconds(50));
+    ev_processor.start();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             1 : Push                               ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(0)));
+    std::this_thread::sleep_for (std::chrono::milliseconds(20)); // Wait a little bit for first event to be under processing
+    for(EventSystem::EventID i=1; i<=3; ++i)
+    {
+        ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(i)));
+    }
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(42)), 1u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             2 : Check                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for (std::chrono::milliseconds(500));
+    CPPUNIT_ASSERT_MESSAGE("High priority event should be processed before low priority ones", std::vector<EventSystem::EventID>({0, 42, 1, 2, 3}) == ev_processor.getReceivedIds());
+}
+
+void AbstractEventProcessorTest::testValueEvents()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Default queue                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestEventProcessor default_processor;
+    default_processor.start();
+    CPPUNIT_ASSERT_THROW_MESSAGE("Value events should be rejected by queues not storing them", default_processor.pushValueEvent(EventSystem::DwfValueEvent(1)), std::logic_error);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             1 : Push                               ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::AbstractEventQueue> queue(new EventSystem::ValueEventQueue());
+    TestEventProcessor ev_processor(std::move(queue));
+    ev_processor.start();
+    ev_processor.pushValueEvent(EventSystem::DwfValueEvent(1));
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(2)));
+    ev_processor.pushValueEvent(EventSystem::DwfValueEvent(3, 3.5));
+    ev_processor.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new IntEvent(5)));
+    ev_processor.pushValueEvent(EventSystem::DwfValueEvent(4));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             2 : Check                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for (std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_MESSAGE("Value and polymorphic events should be processed in push order", std::vector<EventSystem::EventID>({1, 2, 3, 27, 4}) == ev_processor.getReceivedIds());
+    CPPUNIT_ASSERT_MESSAGE("Polymorphic events should keep their type", std::vector<int>({5}) == ev_processor.getIntEventsVal());
+}
+
 //  ______________________________
 // |                              |
 // |    ______________________    |
@@ -73,8 +73,13 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #include "testeventprocessor.h"
 #include <iostream>
 
-TestEventProcessor::TestEventProcessor(size_t max_element_nb, std::chrono::duration<int,std::milli> process_duration) : EventSystem::AbstractEventProcessor(max_element_nb),
-    m_processed_events_number(0), m_process_duration(process_duration)
+TestEventProcessor::TestEventProcessor(size_t max_element_nb, std::chrono::duration<int,std::milli> process_duration, DwfContainers::OverflowPolicy overflow_policy) : EventSystem::AbstractEventProcessor(max_element_nb, overflow_policy),
+    m_processed_events_number(0), m_processed_batches_number(0), m_process_duration(process_duration)
+{
+}
+
+TestEventProcessor::TestEventProcessor(std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue, std::chrono::duration<int,std::milli> process_duration) : EventSystem::AbstractEventProcessor(std::move(event_queue)),
+    m_processed_events_number(0), m_processed_batches_number(0), m_process_duration(process_duration)
 {
 }
 
@@ -99,6 +104,10 @@ std::vector<std::string> TestEventProcessor::getStrEventsVal() const
     return m_str_event_vals;
 }
 
+uint32_t TestEventProcessor::getProcessedBatchesNumber() const
+{
+    return m_processed_batches_number;
+}
 
 void TestEventProcessor::processEvent(std::unique_ptr<EventSystem::DwfEvent>&& event)
 {
@@ -125,6 +134,12 @@ void TestEventProcessor::processEvent(std::unique_ptr<EventSystem::DwfEvent>&& e
     }
 }
 
+void TestEventProcessor::processEvents(std::vector< std::unique_ptr<EventSystem::DwfEvent> >& events)
+{
+    ++m_processed_batches_number;
+    EventSystem::AbstractEventProcessor::processEvents(events);
+}
+
 //  ______________________________
 // |                              |
 // |    ______________________    |
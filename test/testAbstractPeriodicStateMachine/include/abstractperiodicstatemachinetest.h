@@ -92,6 +92,8 @@ public:
         CPPUNIT_TEST(testTimerStartStop);
         CPPUNIT_TEST(testTimerChangePeriod);
         CPPUNIT_TEST(testTimerChangePeriodStop);
+        CPPUNIT_TEST(testEventThreadStateFunctions);
+        CPPUNIT_TEST(testPeriodicTasks);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -202,6 +204,30 @@ public:
     */
     void testTimerChangePeriodStop();
 
+    /*!
+    * @brief Check state functions called by event processing thread
+    *
+    * 0) Create EventThreadStateMachine and start it.
+    * 1) Transition to start timer. Wait and check period is respected and state functions are only called by event processing thread, between transitions.
+    * 2) Push several long transitions at once. Check no state function is called meanwhile and ticks do not pile up.
+    * 3) Push long transition followed by transition stopping timer. Check tick queued meanwhile is dropped.
+    * 4) Transition to restart timer. Check state functions are called again.
+    * 5) Create EventThreadStateMachine with a single producer event queue. Check constructor throws std::logic_error.
+    *
+    */
+    void testEventThreadStateFunctions();
+
+    /*!
+    * @brief Check periodic tasks run at several rates
+    *
+    * For state functions called by timer thread then event processing thread :
+    * 0) Create MultiRateStateMachine. Check tasks with a period which is not a multiple of state machine period are rejected. Start it.
+    * 1) Transition to start timer. Wait and check each task respects its period and tasks run highest rate first.
+    * 2) Transition to another state. Wait and check only tasks of new state run.
+    *
+    */
+    void testPeriodicTasks();
+
 };
 
 #endif // ABSTRACT_PERIODIC_STATE_MACHINE_TEST_H
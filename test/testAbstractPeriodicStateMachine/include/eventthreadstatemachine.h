@@ -0,0 +1,234 @@
+/*!
+ * @file eventthreadstatemachine.h
+ * @brief Class used to test AbstractPeriodicStateMachine state functions called by event processing thread
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Definition of class instrumenting AbstractPeriodicStateMachine in StateFunctionThread::EVENT_THREAD mode for behavior test purport. <br>
+ * Inherits from AbstractPeriodicStateMachine
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef EVENT_THREAD_STATE_MACHINE_H
+#define EVENT_THREAD_STATE_MACHINE_H
+
+#include "abstractperiodicstatemachine.h"
+#include <atomic>
+#include <thread>
+
+/*! @class EventThreadStateMachine
+* @brief Class used to test AbstractPeriodicStateMachine state functions called by event processing thread
+*
+* Inherits from AbstractPeriodicStateMachine
+* The machine has 2 states : IDLE(0), RUNNING(1) and following transitions :
+* IDLE -> RUNNING (Ev1, starting timer)
+* RUNNING -> IDLE (Ev2, stopping timer)
+* RUNNING -> RUNNING (Ev3, sleeping 30 ms)
+* RUNNING state function counts its calls, and the ones overlapping a transition or not run by event processing thread.
+*
+*/
+class EventThreadStateMachine : public DwfStateMachine::AbstractPeriodicStateMachine
+{
+public:
+    enum StatesId
+    {
+        IDLE=0,
+        RUNNING=1
+    };
+
+    /*!
+    * @brief Constructor of EventThreadStateMachine class
+    * @param period : Period of state functions
+    *
+    */
+    EventThreadStateMachine(std::chrono::milliseconds period);
+
+    /*!
+    * @brief Constructor of EventThreadStateMachine class
+    * @param period : Period of state functions
+    * @param event_queue : Queue used to store events
+    *
+    */
+    EventThreadStateMachine(std::chrono::milliseconds period, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue);
+
+    /*!
+    * @brief Get state function counter
+    * @return Number of RUNNING state function calls
+    *
+    */
+    uint32_t periodicCalledNb() const;
+
+    /*!
+    * @brief Get state function counter when timer was last stopped
+    * @return Number of RUNNING state function calls when RUNNING -> IDLE transition last ran
+    *
+    */
+    uint32_t periodicCalledNbAtStop() const;
+
+    /*!
+    * @brief Get state function counter when long transition last started
+    * @return Number of RUNNING state function calls when RUNNING -> RUNNING transition last started
+    *
+    */
+    uint32_t periodicCalledNbAtLongTransition() const;
+
+    /*!
+    * @brief Get faulty state function call counter
+    * @return Number of RUNNING state function calls overlapping a transition or not run by event processing thread
+    *
+    */
+    uint32_t faultyPeriodicCallNb() const;
+
+protected:
+    /*!
+    * @brief Fill the transition map
+    *
+    * Virtual method
+    *
+    */
+    virtual void setupTransitionMap();
+
+    /*!
+    * @brief Fill the state function map
+    *
+    * Virtual method
+    *
+    */
+    virtual void setupStateFunctionMap();
+
+    /*!
+    * @brief Dead end state reaching handler
+    * @param e : exception generated when trying to find transition function associated to current state
+    *
+    * Does nothing, machine has no dead end state.
+    *
+    */
+    virtual void onDeadEndState(const std::exception& e);
+
+private:
+    /*!
+    * @brief Transition from IDLE to RUNNING state, starting timer
+    *
+    */
+    void transitionToRunning();
+
+    /*!
+    * @brief Transition from RUNNING to IDLE state, stopping timer
+    *
+    */
+    void transitionToIdle();
+
+    /*!
+    * @brief Transition from RUNNING to RUNNING state
+    *
+    * Has a sleep to simulate long computation time.
+    *
+    */
+    void longTransition();
+
+    /*!
+    * @brief Start a transition
+    *
+    * Flags transition as running and records event processing thread.
+    *
+    */
+    void enterTransition();
+
+    /*!
+    * @brief Periodic operation when in RUNNING state
+    *
+    */
+    void periodicRunning();
+
+    std::atomic<uint32_t> m_periodic_called_nb; /*!< Counter of periodicRunning calls.*/
+    std::atomic<uint32_t> m_periodic_called_nb_at_stop; /*!< Counter of periodicRunning calls when timer was last stopped.*/
+    std::atomic<uint32_t> m_periodic_called_nb_at_long_transition; /*!< Counter of periodicRunning calls when long transition last started.*/
+    std::atomic<uint32_t> m_faulty_periodic_call_nb; /*!< Counter of periodicRunning calls overlapping a transition or not run by event processing thread.*/
+    std::atomic<bool> m_in_transition; /*!< Flag indicating a transition is running.*/
+    std::atomic<std::thread::id> m_transition_thread; /*!< Thread which ran the latest transition.*/
+};
+
+#endif // EVENT_THREAD_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
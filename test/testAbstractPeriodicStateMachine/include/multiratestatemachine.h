@@ -0,0 +1,227 @@
+/*!
+ * @file multiratestatemachine.h
+ * @brief Class used to test AbstractPeriodicStateMachine periodic tasks
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Definition of class instrumenting AbstractPeriodicStateMachine periodic tasks run at several rates for behavior test purport. <br>
+ * Inherits from AbstractPeriodicStateMachine
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#ifndef MULTI_RATE_STATE_MACHINE_H
+#define MULTI_RATE_STATE_MACHINE_H
+
+#include "abstractperiodicstatemachine.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+
+/*! @class MultiRateStateMachine
+* @brief Class used to test AbstractPeriodicStateMachine periodic tasks
+*
+* Inherits from AbstractPeriodicStateMachine
+* The machine has a 10 ms period and 3 states : IDLE(0), CONTROL(1), STANDBY(2) and following transitions :
+* IDLE -> CONTROL (Ev1, starting timer)
+* CONTROL -> STANDBY (Ev2)
+* CONTROL has a state function and tasks watchdog (100 ms), monitor (50 ms) and control (10 ms), added in this order.
+* STANDBY has task heartbeat (30 ms).
+*
+*/
+class MultiRateStateMachine : public DwfStateMachine::AbstractPeriodicStateMachine
+{
+public:
+    enum StatesId
+    {
+        IDLE=0,
+        CONTROL=1,
+        STANDBY=2
+    };
+
+    /*!
+    * @brief Constructor of MultiRateStateMachine class
+    * @param state_function_thread : Thread calling periodic functions
+    *
+    */
+    MultiRateStateMachine(DwfStateMachine::StateFunctionThread state_function_thread);
+
+    /*!
+    * @brief Add a task doing nothing to IDLE state
+    * @param period : Period of the task
+    *
+    * Throws std::invalid_argument if period is not a multiple of state machine period.
+    *
+    */
+    void addIdleTask(std::chrono::milliseconds period);
+
+    /*!
+    * @brief Get CONTROL state function counter
+    * @return Number of CONTROL state function calls
+    *
+    */
+    uint32_t stateFunctionNb() const;
+
+    /*!
+    * @brief Get control task counter
+    * @return Number of control task calls
+    *
+    */
+    uint32_t controlNb() const;
+
+    /*!
+    * @brief Get monitor task counter
+    * @return Number of monitor task calls
+    *
+    */
+    uint32_t monitorNb() const;
+
+    /*!
+    * @brief Get watchdog task counter
+    * @return Number of watchdog task calls
+    *
+    */
+    uint32_t watchdogNb() const;
+
+    /*!
+    * @brief Get heartbeat task counter
+    * @return Number of heartbeat task calls
+    *
+    */
+    uint32_t heartbeatNb() const;
+
+    /*!
+    * @brief Get order of first calls
+    * @return Letters of the first 4 functions called : S for state function, C for control, M for monitor, W for watchdog
+    *
+    */
+    std::string firstCalls() const;
+
+protected:
+    /*!
+    * @brief Fill the transition map
+    *
+    * Virtual method
+    *
+    */
+    virtual void setupTransitionMap();
+
+    /*!
+    * @brief Fill the state function map and periodic task map
+    *
+    * Virtual method
+    *
+    */
+    virtual void setupStateFunctionMap();
+
+    /*!
+    * @brief Dead end state reaching handler
+    * @param e : exception generated when trying to find transition function associated to current state
+    *
+    * Does nothing, machine has no dead end state.
+    *
+    */
+    virtual void onDeadEndState(const std::exception& e);
+
+private:
+    /*!
+    * @brief Count a call
+    * @param counter : counter of called function
+    * @param letter : letter identifying called function
+    *
+    */
+    void called(std::atomic<uint32_t>& counter, char letter);
+
+    std::atomic<uint32_t> m_state_function_nb; /*!< Counter of CONTROL state function calls.*/
+    std::atomic<uint32_t> m_control_nb; /*!< Counter of control task calls.*/
+    std::atomic<uint32_t> m_monitor_nb; /*!< Counter of monitor task calls.*/
+    std::atomic<uint32_t> m_watchdog_nb; /*!< Counter of watchdog task calls.*/
+    std::atomic<uint32_t> m_heartbeat_nb; /*!< Counter of heartbeat task calls.*/
+
+    mutable std::mutex m_first_calls_mutex; /*!< Mutex protecting order of first calls.*/
+    std::string m_first_calls; /*!< Letters of the first functions called.*/
+};
+
+#endif // MULTI_RATE_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -72,8 +72,13 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "abstractperiodicstatemachinetest.h"
 #include "teststatemachine.h"
+#include "eventthreadstatemachine.h"
+#include "multiratestatemachine.h"
+#include "eventqueue.h"
+#include "dwfspscqueue.h"
 
 #include <chrono>
+#include <stdexcept>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(AbstractPeriodicStateMachineTest);
 
@@ -403,6 +408,116 @@ void AbstractPeriodicStateMachineTest::testTimerChangePeriodStop()
     CPPUNIT_ASSERT_MESSAGE("Period should be updated", (timeouts + 5u <= timeouts_update) && (timeouts_update <= timeouts + 7u)); // interval so that timing issues are not relevant
 }
 
+void AbstractPeriodicStateMachineTest::testEventThreadStateFunctions()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    EventThreadStateMachine st_mach(std::chrono::milliseconds(10u));
+    st_mach.setupAndStart();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Start timer                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(1)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(205u)); // Wait a little bit for timer to run (should be 20 executions)
+    uint32_t calls = st_mach.periodicCalledNb();
+    CPPUNIT_ASSERT_MESSAGE("Execution should respect desired period", (15u <= calls) && (calls <= 21u)); // interval so that timing issues are not relevant
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("State functions should be called by event processing thread, between transitions", 0u, st_mach.faultyPeriodicCallNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        2 : Long transitions                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    calls = st_mach.periodicCalledNb();
+    for(uint8_t i = 0u; i < 3u; ++i)
+    {
+        st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(3)));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(120u)); // Wait for the 3 transitions of 30 ms to complete
+    CPPUNIT_ASSERT_MESSAGE("No state function should be called between queued transitions", st_mach.periodicCalledNbAtLongTransition() <= calls + 1u); // A tick may have been queued before transitions
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("State functions should be called by event processing thread, between transitions", 0u, st_mach.faultyPeriodicCallNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Stop timer                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(3)));
+    st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(2)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100u)); // Wait a little bit to check timer is stopped
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Tick queued before timer stop should be dropped", st_mach.periodicCalledNbAtStop(), st_mach.periodicCalledNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         4 : Restart timer                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    calls = st_mach.periodicCalledNb();
+    st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(1)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(105u)); // Wait a little bit for timer to run (should be 10 executions)
+    CPPUNIT_ASSERT_MESSAGE("Execution should restart with timer", (calls + 7u <= st_mach.periodicCalledNb()) && (st_mach.periodicCalledNb() <= calls + 11u)); // interval so that timing issues are not relevant
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("State functions should be called by event processing thread, between transitions", 0u, st_mach.faultyPeriodicCallNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                  5 : Single producer event queue                   ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_THROW_MESSAGE("Ticks should not be pushed to a single producer event queue",
+                                 EventThreadStateMachine(std::chrono::milliseconds(10u), std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfSpscQueue< std::unique_ptr<EventSystem::DwfEvent> > >(16u))),
+                                 std::logic_error);
+}
+
+void AbstractPeriodicStateMachineTest::testPeriodicTasks()
+{
+    for(DwfStateMachine::StateFunctionThread state_function_thread : {DwfStateMachine::StateFunctionThread::TIMER_THREAD, DwfStateMachine::StateFunctionThread::EVENT_THREAD})
+    {
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+        MultiRateStateMachine st_mach(state_function_thread);
+        CPPUNIT_ASSERT_THROW_MESSAGE("Period should be a multiple of state machine period", st_mach.addIdleTask(std::chrono::milliseconds(15)), std::invalid_argument);
+        CPPUNIT_ASSERT_THROW_MESSAGE("Period should be positive", st_mach.addIdleTask(std::chrono::milliseconds(0)), std::invalid_argument);
+        st_mach.setupAndStart();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Multiple rates                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+        st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(1)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(505u)); // Wait a little bit for timer to run (should be 50 ticks)
+        const uint32_t state_function_nb = st_mach.stateFunctionNb();
+        CPPUNIT_ASSERT_MESSAGE("State function should run on every tick", (40u <= state_function_nb) && (state_function_nb <= 51u)); // interval so that timing issues are not relevant
+        CPPUNIT_ASSERT_MESSAGE("Control should run on every tick", (40u <= st_mach.controlNb()) && (st_mach.controlNb() <= 51u));
+        CPPUNIT_ASSERT_MESSAGE("Monitor should run every 5 ticks", (8u <= st_mach.monitorNb()) && (st_mach.monitorNb() <= 11u));
+        CPPUNIT_ASSERT_MESSAGE("Watchdog should run every 10 ticks", (4u <= st_mach.watchdogNb()) && (st_mach.watchdogNb() <= 6u));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("All tasks should run on first tick, highest rate first", std::string("SCMW"), st_mach.firstCalls());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          2 : Change state                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+        st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(2)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20u)); // Let tick running during transition complete
+        const uint32_t control_nb = st_mach.controlNb();
+        const uint32_t watchdog_nb = st_mach.watchdogNb();
+        std::this_thread::sleep_for(std::chrono::milliseconds(300u)); // Wait a little bit for timer to run (should be 30 ticks)
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Tasks of previous state should not run", control_nb, st_mach.controlNb());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Tasks of previous state should not run", watchdog_nb, st_mach.watchdogNb());
+        CPPUNIT_ASSERT_MESSAGE("Heartbeat should run every 3 ticks", (8u <= st_mach.heartbeatNb()) && (st_mach.heartbeatNb() <= 12u));
+    }
+}
+
 //  ______________________________
 // |                              |
 // |    ______________________    |
@@ -0,0 +1,186 @@
+/*!
+ * @file eventthreadstatemachine.cpp
+ * @brief Class used to test AbstractPeriodicStateMachine state functions called by event processing thread
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Implementation of class instrumenting AbstractPeriodicStateMachine in StateFunctionThread::EVENT_THREAD mode for behavior test purport. <br>
+ * Inherits from AbstractPeriodicStateMachine
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "eventthreadstatemachine.h"
+#include <chrono>
+
+EventThreadStateMachine::EventThreadStateMachine(std::chrono::milliseconds period) : DwfStateMachine::AbstractPeriodicStateMachine(DwfStateMachine::DwfState(IDLE), period), m_periodic_called_nb(0u),
+    m_periodic_called_nb_at_stop(0u), m_periodic_called_nb_at_long_transition(0u), m_faulty_periodic_call_nb(0u), m_in_transition(false), m_transition_thread()
+{
+    setStateFunctionThread(DwfStateMachine::StateFunctionThread::EVENT_THREAD);
+}
+
+EventThreadStateMachine::EventThreadStateMachine(std::chrono::milliseconds period, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : DwfStateMachine::AbstractPeriodicStateMachine(DwfStateMachine::DwfState(IDLE), period, std::move(event_queue)),
+    m_periodic_called_nb(0u), m_periodic_called_nb_at_stop(0u), m_periodic_called_nb_at_long_transition(0u), m_faulty_periodic_call_nb(0u), m_in_transition(false), m_transition_thread()
+{
+    setStateFunctionThread(DwfStateMachine::StateFunctionThread::EVENT_THREAD);
+}
+
+uint32_t EventThreadStateMachine::periodicCalledNb() const
+{
+    return m_periodic_called_nb;
+}
+
+uint32_t EventThreadStateMachine::periodicCalledNbAtStop() const
+{
+    return m_periodic_called_nb_at_stop;
+}
+
+uint32_t EventThreadStateMachine::periodicCalledNbAtLongTransition() const
+{
+    return m_periodic_called_nb_at_long_transition;
+}
+
+uint32_t EventThreadStateMachine::faultyPeriodicCallNb() const
+{
+    return m_faulty_periodic_call_nb;
+}
+
+void EventThreadStateMachine::setupTransitionMap()
+{
+    EventTransitionMap transitionsIdle({{EventSystem::DwfEvent(1), [this](std::unique_ptr<EventSystem::DwfEvent>&&){transitionToRunning();}}});
+    EventTransitionMap transitionsRunning({{EventSystem::DwfEvent(2), [this](std::unique_ptr<EventSystem::DwfEvent>&&){transitionToIdle();}},
+                                           {EventSystem::DwfEvent(3), [this](std::unique_ptr<EventSystem::DwfEvent>&&){longTransition();}}});
+    m_transition_map.insert({DwfStateMachine::DwfState(IDLE), transitionsIdle});
+    m_transition_map.insert({DwfStateMachine::DwfState(RUNNING), transitionsRunning});
+}
+
+void EventThreadStateMachine::setupStateFunctionMap()
+{
+    m_periodic_function_maps.insert({DwfStateMachine::DwfState(RUNNING), [this](){periodicRunning();}});
+}
+
+void EventThreadStateMachine::onDeadEndState(const std::exception&)
+{
+}
+
+void EventThreadStateMachine::transitionToRunning()
+{
+    enterTransition();
+    startTimer();
+    m_current_state = DwfStateMachine::DwfState(RUNNING);
+    m_in_transition = false;
+}
+
+void EventThreadStateMachine::transitionToIdle()
+{
+    enterTransition();
+    stopTimer();
+    m_periodic_called_nb_at_stop = m_periodic_called_nb.load();
+    m_current_state = DwfStateMachine::DwfState(IDLE);
+    m_in_transition = false;
+}
+
+void EventThreadStateMachine::longTransition()
+{
+    enterTransition();
+    m_periodic_called_nb_at_long_transition = m_periodic_called_nb.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30)); // Simulate long computation, during which several ticks are reached
+    m_in_transition = false;
+}
+
+void EventThreadStateMachine::enterTransition()
+{
+    m_in_transition = true;
+    m_transition_thread = std::this_thread::get_id();
+}
+
+void EventThreadStateMachine::periodicRunning()
+{
+    if(m_in_transition || std::this_thread::get_id() != m_transition_thread.load())
+    {
+        ++m_faulty_periodic_call_nb;
+    }
+    ++m_periodic_called_nb;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
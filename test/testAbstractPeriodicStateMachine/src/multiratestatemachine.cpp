@@ -0,0 +1,169 @@
+/*!
+ * @file multiratestatemachine.cpp
+ * @brief Class used to test AbstractPeriodicStateMachine periodic tasks
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Implementation of class instrumenting AbstractPeriodicStateMachine periodic tasks run at several rates for behavior test purport. <br>
+ * Inherits from AbstractPeriodicStateMachine
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+#include "multiratestatemachine.h"
+#include <chrono>
+
+MultiRateStateMachine::MultiRateStateMachine(DwfStateMachine::StateFunctionThread state_function_thread) : DwfStateMachine::AbstractPeriodicStateMachine(DwfStateMachine::DwfState(IDLE), std::chrono::milliseconds(10)),
+    m_state_function_nb(0u), m_control_nb(0u), m_monitor_nb(0u), m_watchdog_nb(0u), m_heartbeat_nb(0u), m_first_calls_mutex(), m_first_calls()
+{
+    setStateFunctionThread(state_function_thread);
+}
+
+void MultiRateStateMachine::addIdleTask(std::chrono::milliseconds period)
+{
+    addPeriodicTask(DwfStateMachine::DwfState(IDLE), "idle", period, [](){});
+}
+
+uint32_t MultiRateStateMachine::stateFunctionNb() const
+{
+    return m_state_function_nb;
+}
+
+uint32_t MultiRateStateMachine::controlNb() const
+{
+    return m_control_nb;
+}
+
+uint32_t MultiRateStateMachine::monitorNb() const
+{
+    return m_monitor_nb;
+}
+
+uint32_t MultiRateStateMachine::watchdogNb() const
+{
+    return m_watchdog_nb;
+}
+
+uint32_t MultiRateStateMachine::heartbeatNb() const
+{
+    return m_heartbeat_nb;
+}
+
+std::string MultiRateStateMachine::firstCalls() const
+{
+    std::lock_guard<std::mutex> lock(m_first_calls_mutex);
+    return m_first_calls;
+}
+
+void MultiRateStateMachine::setupTransitionMap()
+{
+    EventTransitionMap transitionsIdle({{EventSystem::DwfEvent(1), [this](std::unique_ptr<EventSystem::DwfEvent>&&){startTimer(); m_current_state = DwfStateMachine::DwfState(CONTROL);}}});
+    EventTransitionMap transitionsControl({{EventSystem::DwfEvent(2), [this](std::unique_ptr<EventSystem::DwfEvent>&&){m_current_state = DwfStateMachine::DwfState(STANDBY);}}});
+    m_transition_map.insert({DwfStateMachine::DwfState(IDLE), transitionsIdle});
+    m_transition_map.insert({DwfStateMachine::DwfState(CONTROL), transitionsControl});
+}
+
+void MultiRateStateMachine::setupStateFunctionMap()
+{
+    m_periodic_function_maps.insert({DwfStateMachine::DwfState(CONTROL), [this](){called(m_state_function_nb, 'S');}});
+    addPeriodicTask(DwfStateMachine::DwfState(CONTROL), "watchdog", std::chrono::milliseconds(100), [this](){called(m_watchdog_nb, 'W');});
+    addPeriodicTask(DwfStateMachine::DwfState(CONTROL), "monitor", std::chrono::milliseconds(50), [this](){called(m_monitor_nb, 'M');});
+    addPeriodicTask(DwfStateMachine::DwfState(CONTROL), "control", std::chrono::milliseconds(10), [this](){called(m_control_nb, 'C');});
+    addPeriodicTask(DwfStateMachine::DwfState(STANDBY), "heartbeat", std::chrono::milliseconds(30), [this](){++m_heartbeat_nb;});
+}
+
+void MultiRateStateMachine::onDeadEndState(const std::exception&)
+{
+}
+
+void MultiRateStateMachine::called(std::atomic<uint32_t>& counter, char letter)
+{
+    ++counter;
+    std::lock_guard<std::mutex> lock(m_first_calls_mutex);
+    if(m_first_calls.size() < 4u)
+    {
+        m_first_calls.push_back(letter);
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
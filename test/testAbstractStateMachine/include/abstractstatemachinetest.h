@@ -89,7 +89,9 @@ public:
         CPPUNIT_TEST(testDeletion);
         CPPUNIT_TEST(testSizeLimit);
         CPPUNIT_TEST(testDeadEndState);
+        CPPUNIT_TEST(testEmptyTransitionMap);
         CPPUNIT_TEST(testTransitions);
+        CPPUNIT_TEST(testStateTimeouts);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -156,11 +158,22 @@ public:
     * 1) Start event processing.
     * 2) Push event to go to dead end state.
     * 3) Push events on dead en state.
-    * 4) Check onDeadEndState calls.
+    * 4) Check onDeadEndState calls and reported reason.
     *
     */
     void testDeadEndState();
 
+    /*!
+    * @brief Check behavior when reaching a state with an empty transition map
+    *
+    * 0) Create TestStateMachine and start it.
+    * 1) Push event to go to state with an empty transition map.
+    * 2) Push events on this state.
+    * 3) Check events were ignored without calling onDeadEndState.
+    *
+    */
+    void testEmptyTransitionMap();
+
 
 
     /*!
@@ -174,6 +187,18 @@ public:
     */
     void testTransitions();
 
+    /*!
+    * @brief Check state timeouts
+    *
+    * 0) Create TimeoutStateMachine in a state with a timeout. Start it and check timeout of initial state is triggered.
+    * 1) Leave state with timeout before timeout. Check timeout is cancelled.
+    * 2) Restart state timeout several times. Check timeout is only triggered once restarts stop.
+    * 3) Leave state with timeout while its timeout event is queued. Check stale timeout event is discarded.
+    * 4) Create TimeoutStateMachine with a single producer event queue. Check setupAndStart throws std::logic_error.
+    *
+    */
+    void testStateTimeouts();
+
 };
 
 #endif // ABSTRACT_STATE_MACHINE_TEST_H
@@ -81,13 +81,15 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 * @brief Class used to test AbstractStateMachine
 *
 * Inherits from AbstractStateMachine
-* The machine has 5 states : A(0), B(1), C(2), D(3), E(4) and following transitions :
+* The machine has 6 states : A(0), B(1), C(2), D(3), E(4), F(5) and following transitions :
 * A -> B (Ev1, transitionAtoB)
 * B -> A (Ev2, transitionToA)
 * A -> C (Ev3, transitionAtoC)
 * C -> A (Ev4, transitionToA)
 * A -> D (Ev5, transitionAtoD)
 * A -> E (Ev6, transitionAtoE)
+* A -> F (Ev7, transitionAtoF)
+* F has an empty transition map.
 *
 */
 class TestStateMachine : public DwfStateMachine::AbstractStateMachine
@@ -99,7 +101,8 @@ public:
         B=1,
         C=2,
         D=3,
-        E=4
+        E=4,
+        F=5
     };
 
     /*!
@@ -118,6 +121,13 @@ public:
     */
     uint32_t onDeadEndStateCalled() const;
 
+    /*!
+    * @brief Get counter of onDeadEndState calls with DeadEndReason::NO_TRANSITION_MAP reason
+    * @return Number of times onDeadEndState has been called with DeadEndReason::NO_TRANSITION_MAP reason
+    *
+    */
+    uint32_t noTransitionMapReasonCalled() const;
+
     /*!
     * @brief Get transitionAtoB counter
     * @return Number of times transitionAtoB has been called
@@ -176,6 +186,15 @@ protected:
     */
     virtual void onDeadEndState(const std::exception& e);
 
+    /*!
+    * @brief Dead end state reaching handler, exception free version
+    * @param reason : reason why current state is a dead end state
+    *
+    * Count reasons and call exception based handler.
+    *
+    */
+    virtual void onDeadEndState(DwfStateMachine::DeadEndReason reason);
+
 private:
     /*!
     * @brief Transition from A to B state
@@ -207,6 +226,13 @@ private:
     */
     void transitionAtoE(std::unique_ptr<EventSystem::DwfEvent>&& event);
 
+    /*!
+    * @brief Transition from A to F state
+    * @param event : Received event for transition
+    *
+    */
+    void transitionAtoF(std::unique_ptr<EventSystem::DwfEvent>&& event);
+
     /*!
     * @brief Transition ta A state
     * @param event : Received event for transition
@@ -217,6 +243,7 @@ private:
     void transitionToA(std::unique_ptr<EventSystem::DwfEvent>&& event);
 
     std::atomic<uint32_t> m_on_dead_en_state_called; /*!< Counter of onDeadEndState calls.*/
+    std::atomic<uint32_t> m_no_transition_map_reason_called; /*!< Counter of onDeadEndState calls with DeadEndReason::NO_TRANSITION_MAP reason.*/
     std::atomic<uint32_t> m_transition_a_to_b_called; /*!< Counter of transitionAtoB calls.*/
     std::atomic<uint32_t> m_transition_a_to_c_called; /*!< Counter of transitionAtoC calls.*/
     std::atomic<uint32_t> m_transition_b_to_a_called; /*!< Counter of transitionToA with Ev2 calls.*/
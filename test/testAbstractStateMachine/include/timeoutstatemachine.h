@@ -0,0 +1,187 @@
+/*!
+ * @file timeoutstatemachine.h
+ * @brief Class used to test AbstractStateMachine state timeouts
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Definition of class instrumenting AbstractStateMachine state timeouts for behavior test purport. <br>
+ * Inherits from AbstractStateMachine
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef TIMEOUT_STATE_MACHINE_H
+#define TIMEOUT_STATE_MACHINE_H
+
+#include "abstractstatemachine.h"
+#include <atomic>
+
+/*! @class TimeoutStateMachine
+* @brief Class used to test AbstractStateMachine state timeouts
+*
+* Inherits from AbstractStateMachine
+* The machine has 4 states : IDLE(0), WAITING(1), TIMED_OUT(2), DONE(3) and following transitions :
+* IDLE -> WAITING (Ev1)
+* WAITING -> DONE (Ev2)
+* WAITING -> WAITING (Ev3, restarting state timeout)
+* WAITING -> WAITING (Ev7, sleeping 200 ms without restarting state timeout)
+* WAITING -> TIMED_OUT (Ev10, timeout of WAITING after 100 ms)
+* TIMED_OUT -> IDLE (Ev4)
+* DONE -> IDLE (Ev4)
+* DONE -> TIMED_OUT (Ev10, only reached by a stale timeout event)
+*
+*/
+class TimeoutStateMachine : public DwfStateMachine::AbstractStateMachine
+{
+public:
+    enum StatesId
+    {
+        IDLE=0,
+        WAITING=1,
+        TIMED_OUT=2,
+        DONE=3
+    };
+
+    /*!
+    * @brief Constructor of TimeoutStateMachine class
+    * @param initial_state : Initial state of the machine
+    *
+    */
+    TimeoutStateMachine(StatesId initial_state);
+
+    /*!
+    * @brief Constructor of TimeoutStateMachine class
+    * @param initial_state : Initial state of the machine
+    * @param event_queue : Queue used to store events
+    *
+    */
+    TimeoutStateMachine(StatesId initial_state, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue);
+
+    /*!
+    * @brief Get current state
+    * @return ID of current state
+    *
+    */
+    DwfStateMachine::StateID getCurrentState() const;
+
+    /*!
+    * @brief Get timeout counter
+    * @return Number of transitions to TIMED_OUT state
+    *
+    */
+    uint32_t timeoutNb() const;
+
+protected:
+    /*!
+    * @brief Fill the transition map and state timeout map
+    *
+    * Virtual method
+    *
+    */
+    virtual void setupTransitionMap();
+
+    /*!
+    * @brief Dead end state reaching handler
+    * @param e : exception generated when trying to find transition function associated to current state
+    *
+    * Does nothing, machine has no dead end state.
+    *
+    */
+    virtual void onDeadEndState(const std::exception& e);
+
+private:
+    /*!
+    * @brief Go to a state
+    * @param state : ID of the state to go to
+    *
+    */
+    void goTo(StatesId state);
+
+    std::atomic<DwfStateMachine::StateID> m_state_id; /*!< Copy of current state ID readable from test thread.*/
+    std::atomic<uint32_t> m_timeout_nb; /*!< Counter of transitions to TIMED_OUT state.*/
+};
+
+#endif // TIMEOUT_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
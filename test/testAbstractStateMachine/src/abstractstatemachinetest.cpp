@@ -72,8 +72,12 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "abstractstatemachinetest.h"
 #include "teststatemachine.h"
+#include "timeoutstatemachine.h"
+#include "eventqueue.h"
+#include "dwfspscqueue.h"
 
 #include <chrono>
+#include <thread>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(AbstractStateMachineTest);
 
@@ -214,6 +218,48 @@ void AbstractStateMachineTest::testDeadEndState()
     ///                                                                    ///
     //////////////////////////////////////////////////////////////////////////
     CPPUNIT_ASSERT_EQUAL_MESSAGE("onDeadEndState should have been called for every event", nb_events, st_mach.onDeadEndStateCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Dead end reason should be the absence of transition map", nb_events, st_mach.noTransitionMapReasonCalled());
+}
+
+void AbstractStateMachineTest::testEmptyTransitionMap()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestStateMachine st_mach;
+    st_mach.setupAndStart();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(7));
+    st_mach.pushEvent(std::move(ev));
+    st_mach.waitForTransition();
+    CPPUNIT_ASSERT_MESSAGE("Go to state F", DwfStateMachine::DwfState(TestStateMachine::F) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(uint32_t i=1; i<=10u; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> evIgnored(new EventSystem::DwfEvent(i));
+        st_mach.pushEvent(std::move(evIgnored));
+    }
+    std::this_thread::sleep_for (std::chrono::milliseconds(100)); // Wait a little bit for events to be processed
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                    3 : Check events are ignored                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_MESSAGE("Stay in state F", DwfStateMachine::DwfState(TestStateMachine::F) == st_mach.getCurrentState());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("onDeadEndState should not be called for a state with an empty transition map", 0u, st_mach.onDeadEndStateCalled());
 }
 
 void AbstractStateMachineTest::testTransitions()
@@ -292,6 +338,83 @@ void AbstractStateMachineTest::testTransitions()
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions C to A", nb_loops, st_mach.transitionCtoACalled());
 }
 
+/*!
+* @brief Push an event without payload to a state machine
+* @param st_mach : state machine to push event to
+* @param id : ID of the event
+*
+*/
+static void pushEventId(DwfStateMachine::AbstractStateMachine& st_mach, EventSystem::EventID id)
+{
+    st_mach.pushEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(id)));
+}
+
+void AbstractStateMachineTest::testStateTimeouts()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     0 : Initial state timeout                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TimeoutStateMachine st_mach(TimeoutStateMachine::WAITING);
+    st_mach.setupAndStart();
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Initial state should time out", static_cast<DwfStateMachine::StateID>(TimeoutStateMachine::TIMED_OUT), st_mach.getCurrentState());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timeout should be triggered once", 1u, st_mach.timeoutNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                   1 : Leave state before timeout                   ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    pushEventId(st_mach, 4u);
+    pushEventId(st_mach, 1u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    pushEventId(st_mach, 2u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Machine should stay in state reached before timeout", static_cast<DwfStateMachine::StateID>(TimeoutStateMachine::DONE), st_mach.getCurrentState());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timeout should be cancelled when leaving state", 1u, st_mach.timeoutNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     2 : Restart state timeout                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    pushEventId(st_mach, 4u);
+    pushEventId(st_mach, 1u);
+    for(uint32_t i = 0u; i < 6u; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        pushEventId(st_mach, 3u);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Restarted timeout should not be triggered", static_cast<DwfStateMachine::StateID>(TimeoutStateMachine::WAITING), st_mach.getCurrentState());
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timeout should be triggered once restarts stop", static_cast<DwfStateMachine::StateID>(TimeoutStateMachine::TIMED_OUT), st_mach.getCurrentState());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timeout should be triggered once more", 2u, st_mach.timeoutNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                      3 : Stale timeout event                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    pushEventId(st_mach, 4u);
+    pushEventId(st_mach, 1u);
+    pushEventId(st_mach, 7u); // Timeout event is queued after next event while transition sleeps
+    pushEventId(st_mach, 2u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Stale timeout event should be discarded", static_cast<DwfStateMachine::StateID>(TimeoutStateMachine::DONE), st_mach.getCurrentState());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Stale timeout event should not trigger transition", 2u, st_mach.timeoutNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                  4 : Single producer event queue                   ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TimeoutStateMachine spsc_st_mach(TimeoutStateMachine::WAITING, std::unique_ptr<EventSystem::AbstractEventQueue>(new EventSystem::EventQueue< DwfContainers::DwfSpscQueue< std::unique_ptr<EventSystem::DwfEvent> > >(16u)));
+    CPPUNIT_ASSERT_THROW_MESSAGE("State timeouts should not be pushed to a single producer event queue", spsc_st_mach.setupAndStart(), std::logic_error);
+}
+
 //  ______________________________
 // |                              |
 // |    ______________________    |
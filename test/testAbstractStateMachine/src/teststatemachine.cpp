@@ -74,7 +74,7 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #include <chrono>
 #include <iostream>
 
-TestStateMachine::TestStateMachine(size_t max_element_nb) : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(A), max_element_nb), m_on_dead_en_state_called(0),
+TestStateMachine::TestStateMachine(size_t max_element_nb) : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(A), max_element_nb), m_on_dead_en_state_called(0), m_no_transition_map_reason_called(0),
     m_transition_a_to_b_called(0), m_transition_a_to_c_called(0), m_transition_b_to_a_called(0), m_transition_c_to_a_called(0), m_transition_triggered(false)
 {
 }
@@ -89,6 +89,11 @@ uint32_t TestStateMachine::onDeadEndStateCalled() const
     return m_on_dead_en_state_called;
 }
 
+uint32_t TestStateMachine::noTransitionMapReasonCalled() const
+{
+    return m_no_transition_map_reason_called;
+}
+
 uint32_t TestStateMachine::transitionAtoBCalled() const
 {
     return m_transition_a_to_b_called;
@@ -123,12 +128,14 @@ void TestStateMachine::setupTransitionMap()
     std::pair<EventSystem::DwfEvent, TransitionFunction> transAtoC(EventSystem::DwfEvent(3), [this](std::unique_ptr<EventSystem::DwfEvent>&& event){transitionAtoC(std::move(event));});
     std::pair<EventSystem::DwfEvent, TransitionFunction> transAtoD(EventSystem::DwfEvent(5), [this](std::unique_ptr<EventSystem::DwfEvent>&& event){transitionAtoD(std::move(event));});
     std::pair<EventSystem::DwfEvent, TransitionFunction> transAtoE(EventSystem::DwfEvent(6), [this](std::unique_ptr<EventSystem::DwfEvent>&& event){transitionAtoE(std::move(event));});
-    EventTransitionMap transitionsA({transAtoB, transAtoC, transAtoD, transAtoE});
+    std::pair<EventSystem::DwfEvent, TransitionFunction> transAtoF(EventSystem::DwfEvent(7), [this](std::unique_ptr<EventSystem::DwfEvent>&& event){transitionAtoF(std::move(event));});
+    EventTransitionMap transitionsA({transAtoB, transAtoC, transAtoD, transAtoE, transAtoF});
     EventTransitionMap transitionsB({{EventSystem::DwfEvent(2), [this](std::unique_ptr<EventSystem::DwfEvent>&& event){transitionToA(std::move(event));}}});
     EventTransitionMap transitionsC({{EventSystem::DwfEvent(4), [this](std::unique_ptr<EventSystem::DwfEvent>&& event){transitionToA(std::move(event));}}});
     m_transition_map.insert({DwfStateMachine::DwfState(A), transitionsA});
     m_transition_map.insert({DwfStateMachine::DwfState(B), transitionsB});
     m_transition_map.insert({DwfStateMachine::DwfState(C), transitionsC});
+    m_transition_map.insert({DwfStateMachine::DwfState(F), EventTransitionMap()});
 }
 
 void TestStateMachine::onDeadEndState(const std::exception& e)
@@ -136,6 +143,15 @@ void TestStateMachine::onDeadEndState(const std::exception& e)
     ++m_on_dead_en_state_called;
 }
 
+void TestStateMachine::onDeadEndState(DwfStateMachine::DeadEndReason reason)
+{
+    if(reason == DwfStateMachine::DeadEndReason::NO_TRANSITION_MAP)
+    {
+        ++m_no_transition_map_reason_called;
+    }
+    DwfStateMachine::AbstractStateMachine::onDeadEndState(reason);
+}
+
 void TestStateMachine::transitionAtoB(std::unique_ptr<EventSystem::DwfEvent>&& event)
 {
     ++m_transition_a_to_b_called;
@@ -167,6 +183,13 @@ void TestStateMachine::transitionAtoE(std::unique_ptr<EventSystem::DwfEvent>&& e
     m_current_state = DwfStateMachine::DwfState(E);
 }
 
+void TestStateMachine::transitionAtoF(std::unique_ptr<EventSystem::DwfEvent>&& /*event*/)
+{
+    m_current_state = DwfStateMachine::DwfState(F);
+    m_transition_triggered=true;
+    m_transition_semaphore.notify_one();
+}
+
 void TestStateMachine::transitionToA(std::unique_ptr<EventSystem::DwfEvent>&& event)
 {
     if(*event == EventSystem::DwfEvent(2))
@@ -0,0 +1,149 @@
+/*!
+ * @file timeoutstatemachine.cpp
+ * @brief Class used to test AbstractStateMachine state timeouts
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Implementation of class instrumenting AbstractStateMachine state timeouts for behavior test purport. <br>
+ * Inherits from AbstractStateMachine
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "timeoutstatemachine.h"
+#include <chrono>
+#include <thread>
+
+TimeoutStateMachine::TimeoutStateMachine(StatesId initial_state) : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(initial_state)), m_state_id(initial_state), m_timeout_nb(0u)
+{
+}
+
+TimeoutStateMachine::TimeoutStateMachine(StatesId initial_state, std::unique_ptr<EventSystem::AbstractEventQueue>&& event_queue) : DwfStateMachine::AbstractStateMachine(DwfStateMachine::DwfState(initial_state), std::move(event_queue)),
+    m_state_id(initial_state), m_timeout_nb(0u)
+{
+}
+
+DwfStateMachine::StateID TimeoutStateMachine::getCurrentState() const
+{
+    return m_state_id;
+}
+
+uint32_t TimeoutStateMachine::timeoutNb() const
+{
+    return m_timeout_nb;
+}
+
+void TimeoutStateMachine::setupTransitionMap()
+{
+    EventTransitionMap transitionsIdle({{EventSystem::DwfEvent(1), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(WAITING);}}});
+    EventTransitionMap transitionsWaiting({{EventSystem::DwfEvent(2), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(DONE);}},
+                                           {EventSystem::DwfEvent(3), [this](std::unique_ptr<EventSystem::DwfEvent>&&){restartStateTimeout();}},
+                                           {EventSystem::DwfEvent(7), [](std::unique_ptr<EventSystem::DwfEvent>&&){std::this_thread::sleep_for(std::chrono::milliseconds(200));}},
+                                           {EventSystem::DwfEvent(10), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(TIMED_OUT);}}});
+    EventTransitionMap transitionsTimedOut({{EventSystem::DwfEvent(4), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(IDLE);}}});
+    EventTransitionMap transitionsDone({{EventSystem::DwfEvent(4), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(IDLE);}},
+                                        {EventSystem::DwfEvent(10), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(TIMED_OUT);}}});
+    m_transition_map.insert({DwfStateMachine::DwfState(IDLE), transitionsIdle});
+    m_transition_map.insert({DwfStateMachine::DwfState(WAITING), transitionsWaiting});
+    m_transition_map.insert({DwfStateMachine::DwfState(TIMED_OUT), transitionsTimedOut});
+    m_transition_map.insert({DwfStateMachine::DwfState(DONE), transitionsDone});
+
+    m_state_timeout_map.insert({DwfStateMachine::DwfState(WAITING), DwfStateMachine::StateTimeout{std::chrono::milliseconds(100), 10u}});
+}
+
+void TimeoutStateMachine::onDeadEndState(const std::exception&)
+{
+}
+
+void TimeoutStateMachine::goTo(StatesId state)
+{
+    if(state == TIMED_OUT)
+    {
+        ++m_timeout_nb;
+    }
+    m_current_state = DwfStateMachine::DwfState(state);
+    m_state_id = state;
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,225 @@
+/*!
+ * @file dwfcoalescingqueuetest.h
+ * @brief Unit tests of DwfCoalescingQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfCoalescingQueue class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_COALESCING_QUEUE_TEST_H
+#define DWF_COALESCING_QUEUE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class DwfCoalescingQueueTest
+* @brief Unit tests of DwfCoalescingQueue class
+*
+* Inherits from TestFixture
+*
+*/
+class DwfCoalescingQueueTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(DwfCoalescingQueueTest);
+        CPPUNIT_TEST(testPushPop);
+        CPPUNIT_TEST(testCoalesce);
+        CPPUNIT_TEST(testFull);
+        CPPUNIT_TEST(testPushBatch);
+        CPPUNIT_TEST(testPushFor);
+        CPPUNIT_TEST(testWaitManagement);
+        CPPUNIT_TEST(testEvents);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the DwfCoalescingQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    DwfCoalescingQueueTest();
+
+    /*!
+    * @brief Desctructor of the DwfCoalescingQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~DwfCoalescingQueueTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check push and pop of elements with distinct keys
+    *
+    * 0) Create a queue of key value pairs.
+    * 1) Push elements with distinct keys. Check size getters.
+    * 2) Pop elements and check they are popped in push order.
+    *
+    */
+    void testPushPop();
+
+    /*!
+    * @brief Check elements with a queued key are coalesced
+    *
+    * 0) Create a queue of key value pairs.
+    * 1) Push elements with some identical keys. Check size and coalesced counter.
+    * 2) Pop elements up to the first one and check latest values are kept at the position of the first occurrence of their key.
+    * 3) Push element with key of popped element. Check it is appended.
+    *
+    */
+    void testCoalesce();
+
+    /*!
+    * @brief Check behavior of a full queue
+    *
+    * 0) Create a queue of key value pairs of size N and fill it.
+    * 1) Push element with a queued key. Check it is coalesced.
+    * 2) Push element with a new key. Check an exception is thrown and that non throwing push reports queue is full.
+    *
+    */
+    void testFull();
+
+    /*!
+    * @brief Check push of several elements at once
+    *
+    * 0) Create a queue of key value pairs of size N and push an element.
+    * 1) Push a batch with more new keys than room. Check an exception is thrown and nothing is pushed.
+    * 2) Push a batch of queued keys and of new keys fitting in queue, some of them twice. Check queue content.
+    *
+    */
+    void testPushBatch();
+
+    /*!
+    * @brief Check push with timeout behavior
+    *
+    * 0) Create a queue of key value pairs of size 1 and fill it.
+    * 1) Push element with a new key with a timeout. Check it expires.
+    * 2) Pop from another thread while pushing with a long timeout. Check element is pushed.
+    *
+    */
+    void testPushFor();
+
+    /*!
+    * @brief Check wait management behavior
+    *
+    * 0) Create a queue of key value pairs.
+    * 1) Spawn a thread waiting for elements.
+    * 2) Disable wait and check thread exits without any element being pushed.
+    *
+    */
+    void testWaitManagement();
+
+    /*!
+    * @brief Check coalescing of events by EventID
+    *
+    * 0) Create a queue of events keyed by EventID.
+    * 1) Push many events with a few EventIDs.
+    * 2) Check only one event per EventID is popped.
+    *
+    */
+    void testEvents();
+};
+
+#endif // DWF_COALESCING_QUEUE_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
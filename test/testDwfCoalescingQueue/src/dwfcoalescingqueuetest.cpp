@@ -0,0 +1,396 @@
+/*!
+ * @file dwfcoalescingqueuetest.cpp
+ * @brief Unit tests of DwfCoalescingQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfCoalescingQueue class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfcoalescingqueuetest.h"
+#include "dwfcoalescingqueue.h"
+#include "dwfevent.h"
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <utility>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(DwfCoalescingQueueTest);
+
+/*! @typedef KeyValue
+*  @brief Element type of tested queues. First member is the key.
+*/
+typedef std::pair<int, int> KeyValue;
+
+/*! @struct KeyOfPair
+*  @brief Functor returning key of a KeyValue
+*/
+struct KeyOfPair
+{
+    int operator()(const KeyValue& element) const
+    {
+        return element.first;
+    }
+};
+
+/*! @typedef TestQueue
+*  @brief Type of tested queues
+*/
+typedef DwfContainers::DwfCoalescingQueue<KeyValue, int, KeyOfPair> TestQueue;
+
+DwfCoalescingQueueTest::DwfCoalescingQueueTest()
+{
+}
+
+DwfCoalescingQueueTest::~DwfCoalescingQueueTest()
+{
+}
+
+void DwfCoalescingQueueTest::setUp()
+{
+}
+
+void DwfCoalescingQueueTest::tearDown()
+{
+}
+
+void DwfCoalescingQueueTest::testPushPop()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestQueue testQueue;
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty at creation", testQueue.empty());
+    CPPUNIT_ASSERT_MESSAGE("Queue without size limit should never be full", !testQueue.full());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<10; ++i)
+    {
+        testQueue.push(KeyValue(i, 10*i));
+    }
+    CPPUNIT_ASSERT_MESSAGE("Queue should not be empty after push", !testQueue.empty());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All elements with distinct keys should be stored", static_cast<size_t>(10u), testQueue.size());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("No element should be coalesced", static_cast<uint64_t>(0u), testQueue.coalescedElementNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               2 : Pop                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<10; ++i)
+    {
+        KeyValue popped;
+        testQueue.pop(popped);
+        CPPUNIT_ASSERT_MESSAGE("Elements should be popped in push order", KeyValue(i, 10*i) == popped);
+    }
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty once all elements are popped", testQueue.empty());
+}
+
+void DwfCoalescingQueueTest::testCoalesce()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestQueue testQueue;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(KeyValue(1, 0));
+    testQueue.push(KeyValue(2, 1));
+    testQueue.push(KeyValue(1, 2));
+    testQueue.push(KeyValue(3, 3));
+    testQueue.push(KeyValue(1, 4));
+    testQueue.push(KeyValue(2, 5));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should store one element per key", static_cast<size_t>(3u), testQueue.size());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of coalesced elements is not correct", static_cast<uint64_t>(3u), testQueue.coalescedElementNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               2 : Pop                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<KeyValue> popped;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Only one element should be popped", static_cast<size_t>(1u), testQueue.popUpTo(1u, popped));
+    CPPUNIT_ASSERT_MESSAGE("Latest value should be at first occurrence of its key", KeyValue(1, 4) == popped.back());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          3 : Push popped key                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(KeyValue(1, 6));
+    popped.clear();
+    testQueue.popAll(popped);
+    CPPUNIT_ASSERT_MESSAGE("Popped key should be appended again", std::vector<KeyValue>({KeyValue(2, 5), KeyValue(3, 3), KeyValue(1, 6)}) == popped);
+}
+
+void DwfCoalescingQueueTest::testFull()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 3u;
+    TestQueue testQueue(queue_size);
+    for(int i=0; i<static_cast<int>(queue_size); ++i)
+    {
+        testQueue.push(KeyValue(i, i));
+    }
+    CPPUNIT_ASSERT_MESSAGE("Queue should be full", testQueue.full());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push queued key                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("Element with a queued key should be coalesced in a full queue", testQueue.push(KeyValue(1, 42)));
+    CPPUNIT_ASSERT_MESSAGE("Element with a queued key should be coalesced in a full queue", DwfContainers::PushStatus::PUSHED == testQueue.tryPush(KeyValue(2, 43)));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          2 : Push new key                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_THROW_MESSAGE("Element with a new key should not be pushed in a full queue", testQueue.push(KeyValue(3, 3)), std::runtime_error);
+    CPPUNIT_ASSERT_MESSAGE("Full queue should be reported", DwfContainers::PushStatus::FULL == testQueue.tryPush(KeyValue(3, 3)));
+
+    std::vector<KeyValue> popped;
+    testQueue.popAll(popped);
+    CPPUNIT_ASSERT_MESSAGE("Queue content is not correct", std::vector<KeyValue>({KeyValue(0, 0), KeyValue(1, 42), KeyValue(2, 43)}) == popped);
+}
+
+void DwfCoalescingQueueTest::testPushBatch()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 3u;
+    TestQueue testQueue(queue_size);
+    testQueue.push(KeyValue(0, 0));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push too many keys                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<KeyValue> batch = {KeyValue(1, 1), KeyValue(2, 2), KeyValue(3, 3)};
+    CPPUNIT_ASSERT_THROW_MESSAGE("Batch with too many new keys should not be pushed", testQueue.pushBatch(batch), std::runtime_error);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Nothing should be pushed if batch does not fit", static_cast<size_t>(1u), testQueue.size());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Batch should be left untouched if it does not fit", static_cast<size_t>(3u), batch.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Push batch                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    batch = {KeyValue(1, 1), KeyValue(0, 10), KeyValue(2, 2), KeyValue(1, 11), KeyValue(2, 12)};
+    testQueue.pushBatch(batch);
+    CPPUNIT_ASSERT_MESSAGE("Batch should be cleared once pushed", batch.empty());
+    std::vector<KeyValue> popped;
+    testQueue.popAll(popped);
+    CPPUNIT_ASSERT_MESSAGE("Queue content is not correct", std::vector<KeyValue>({KeyValue(0, 10), KeyValue(1, 11), KeyValue(2, 12)}) == popped);
+}
+
+void DwfCoalescingQueueTest::testPushFor()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestQueue testQueue(1u);
+    testQueue.push(KeyValue(0, 0));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push on full queue                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    CPPUNIT_ASSERT_MESSAGE("Push on queue staying full should time out", DwfContainers::PushStatus::TIMEOUT == testQueue.pushFor(KeyValue(1, 1), std::chrono::milliseconds(50)));
+    CPPUNIT_ASSERT_MESSAGE("Push should wait for timeout", std::chrono::steady_clock::now() - start_time >= std::chrono::milliseconds(50));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Room is freed                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread popper([&testQueue]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        KeyValue popped;
+        testQueue.pop(popped);
+    });
+    CPPUNIT_ASSERT_MESSAGE("Push should succeed once room is freed", DwfContainers::PushStatus::PUSHED == testQueue.pushFor(KeyValue(1, 1), std::chrono::seconds(5)));
+    popper.join();
+    KeyValue popped;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_MESSAGE("Pushed element should be popped", KeyValue(1, 1) == popped);
+}
+
+void DwfCoalescingQueueTest::testWaitManagement()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestQueue testQueue;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       1 : Spawn popper thread                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    KeyValue popped(21, 21);
+    std::thread popper([&testQueue, &popped]()
+    {
+        testQueue.pop(popped);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Disable Waiting                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.disableWait();
+    popper.join();
+    CPPUNIT_ASSERT_MESSAGE("Popped element should not be modified if no elements are received in queue", KeyValue(21, 21) == popped);
+}
+
+void DwfCoalescingQueueTest::testEvents()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfCoalescingQueue<std::unique_ptr<EventSystem::DwfEvent>, EventSystem::EventID, EventSystem::EventIdOf> testQueue(4u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(EventSystem::EventID i=0; i<1000; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfEvent(i%3));
+        testQueue.push(std::move(event));
+        CPPUNIT_ASSERT_MESSAGE("Event should be moved", event == nullptr);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               2 : Pop                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > popped;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("One event per EventID should be queued", static_cast<size_t>(3u), testQueue.popAll(popped));
+    for(EventSystem::EventID i=0; i<3; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Events should be popped in order of first occurrence", i, popped[i]->getId());
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of coalesced events is not correct", static_cast<uint64_t>(997u), testQueue.coalescedElementNb());
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,189 @@
+/*!
+ * @file dwfeventpooltest.h
+ * @brief Unit tests of DwfEventPool class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfEventPool class and of DwfEvent allocation.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_EVENT_POOL_TEST_H
+#define DWF_EVENT_POOL_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class DwfEventPoolTest
+* @brief Unit tests of DwfEventPool class
+*
+* Inherits from TestFixture
+*
+*/
+class DwfEventPoolTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(DwfEventPoolTest);
+        CPPUNIT_TEST(testRecycle);
+        CPPUNIT_TEST(testDerivedEvents);
+        CPPUNIT_TEST(testCrossThread);
+        CPPUNIT_TEST(testThreadExit);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the DwfEventPoolTest class
+    *
+    * Does nothing.
+    *
+    */
+    DwfEventPoolTest();
+
+    /*!
+    * @brief Desctructor of the DwfEventPoolTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~DwfEventPoolTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check storage of deleted events is reused
+    *
+    * 0) Create and delete an event. Check next event created reuses its storage.
+    * 1) Create and delete many events. Check no storage is obtained from the system.
+    *
+    */
+    void testRecycle();
+
+    /*!
+    * @brief Check derived events are correctly allocated and destroyed through a DwfEvent pointer
+    *
+    * 0) Create a derived event smaller than a pool block and delete it through std::unique_ptr<DwfEvent>. Check its destructor is called and its storage is reused.
+    * 1) Create a derived event larger than a pool block and delete it through std::unique_ptr<DwfEvent>. Check its destructor is called and its content was not corrupted.
+    *
+    */
+    void testDerivedEvents();
+
+    /*!
+    * @brief Check events created by a thread and deleted by another one are recycled
+    *
+    * 0) Spawn a thread creating events and pushing them to a bounded queue.
+    * 1) Pop and delete events from main thread.
+    * 2) Check storage obtained from the system is bounded by number of events in flight.
+    *
+    */
+    void testCrossThread();
+
+    /*!
+    * @brief Check storage cached by an exiting thread is given back to other threads
+    *
+    * 0) Spawn a thread creating and deleting events, then exiting.
+    * 1) Spawn a second thread doing the same. Check no storage is obtained from the system.
+    * 2) Spawn a thread deleting events one by one after its pool cache is flushed. Check freed blocks are gathered into full batches.
+    *
+    */
+    void testThreadExit();
+};
+
+#endif // DWF_EVENT_POOL_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,349 @@
+/*!
+ * @file dwfeventpooltest.cpp
+ * @brief Unit tests of DwfEventPool class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfEventPool class and of DwfEvent allocation.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfeventpooltest.h"
+#include "dwfevent.h"
+#include "dwfeventpool.h"
+#include "dwfqueue.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(DwfEventPoolTest);
+
+/*! @class CountedEvent
+* @brief Event counting destructor calls, smaller than a pool block
+*
+*/
+class CountedEvent : public EventSystem::DwfEvent
+{
+public:
+    CountedEvent(uint32_t& destruction_nb) : EventSystem::DwfEvent(12), m_destruction_nb(destruction_nb), m_name("a string long enough to be allocated")
+    {
+    }
+
+    virtual ~CountedEvent()
+    {
+        ++m_destruction_nb;
+    }
+
+private:
+    uint32_t& m_destruction_nb; /*!< Counter of destructor calls.*/
+
+    std::string m_name; /*!< Member owning memory, leaked if destructor is not called.*/
+};
+
+/*! @class LargeEvent
+* @brief Event counting destructor calls, larger than a pool block
+*
+*/
+class LargeEvent : public EventSystem::DwfEvent
+{
+public:
+    LargeEvent(uint32_t& destruction_nb) : EventSystem::DwfEvent(13), m_destruction_nb(destruction_nb), m_payload()
+    {
+        for(size_t i = 0u; i < sizeof(m_payload); ++i)
+        {
+            m_payload[i] = static_cast<uint8_t>(i);
+        }
+    }
+
+    virtual ~LargeEvent()
+    {
+        ++m_destruction_nb;
+    }
+
+    bool payloadValid() const
+    {
+        for(size_t i = 0u; i < sizeof(m_payload); ++i)
+        {
+            if(m_payload[i] != static_cast<uint8_t>(i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    uint32_t& m_destruction_nb; /*!< Counter of destructor calls.*/
+
+    uint8_t m_payload[128]; /*!< Data making event larger than a pool block.*/
+};
+
+/*! @struct LateEvents
+* @brief Events deleted one by one by a thread local destructor, after thread cache of the pool is flushed
+*
+*/
+struct LateEvents
+{
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > events; /*!< Events deleted at thread exit.*/
+};
+
+DwfEventPoolTest::DwfEventPoolTest()
+{
+}
+
+DwfEventPoolTest::~DwfEventPoolTest()
+{
+}
+
+void DwfEventPoolTest::setUp()
+{
+}
+
+void DwfEventPoolTest::tearDown()
+{
+}
+
+void DwfEventPoolTest::testRecycle()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Reuse storage                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfEvent(1));
+    const EventSystem::DwfEvent* address = event.get();
+    event.reset();
+    event.reset(new EventSystem::DwfEvent(2));
+    CPPUNIT_ASSERT_MESSAGE("Storage of deleted event should be reused", address == event.get());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Event should have its own id", static_cast<EventSystem::EventID>(2u), event->getId());
+    event.reset();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           1 : Many events                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > events;
+    for(EventSystem::EventID i = 0u; i < 1000u; ++i) // Warm up
+    {
+        events.emplace_back(new EventSystem::DwfEvent(i));
+    }
+    events.clear();
+    const size_t chunk_nb = EventSystem::DwfEventPool::chunkNb();
+    for(uint32_t round = 0u; round < 100u; ++round)
+    {
+        for(EventSystem::EventID i = 0u; i < 1000u; ++i)
+        {
+            events.emplace_back(new EventSystem::DwfEvent(i));
+        }
+        events.clear();
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Recycled storage should be enough", chunk_nb, EventSystem::DwfEventPool::chunkNb());
+}
+
+void DwfEventPoolTest::testDerivedEvents()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            0 : Small event                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_MESSAGE("Event should fit in a pool block", sizeof(CountedEvent) <= EventSystem::DwfEventPool::C_BLOCK_SIZE);
+    uint32_t destruction_nb = 0u;
+    std::unique_ptr<EventSystem::DwfEvent> event(new CountedEvent(destruction_nb));
+    const EventSystem::DwfEvent* address = event.get();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Derived event should keep its id", static_cast<EventSystem::EventID>(12u), event->getId());
+    event.reset();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Derived event destructor should be called through a DwfEvent pointer", 1u, destruction_nb);
+    event.reset(new EventSystem::DwfEvent(1));
+    CPPUNIT_ASSERT_MESSAGE("Storage of derived event should be reused", address == event.get());
+    event.reset();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            1 : Large event                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_MESSAGE("Event should not fit in a pool block", sizeof(LargeEvent) > EventSystem::DwfEventPool::C_BLOCK_SIZE);
+    destruction_nb = 0u;
+    std::unique_ptr<LargeEvent> large(new LargeEvent(destruction_nb));
+    std::unique_ptr<EventSystem::DwfEvent> small(new EventSystem::DwfEvent(1)); // Would overlap large event if it were stored in a pool block
+    CPPUNIT_ASSERT_MESSAGE("Large event content should not be corrupted", large->payloadValid());
+    event = std::move(large);
+    event.reset();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Large event destructor should be called through a DwfEvent pointer", 1u, destruction_nb);
+}
+
+void DwfEventPoolTest::testCrossThread()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t in_flight_nb = 1000u;
+    const EventSystem::EventID event_nb = 200000u;
+    DwfContainers::DwfQueue< std::unique_ptr<EventSystem::DwfEvent> > queue(in_flight_nb, DwfContainers::OverflowPolicy::BLOCK);
+    const size_t chunk_nb = EventSystem::DwfEventPool::chunkNb();
+    std::thread producer([&queue, event_nb]()
+    {
+        for(EventSystem::EventID i = 0u; i < event_nb; ++i)
+        {
+            queue.push(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(i)));
+        }
+    });
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Delete                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    bool ordered = true;
+    for(EventSystem::EventID i = 0u; i < event_nb; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> event;
+        queue.pop(event);
+        ordered = ordered && event->getId() == i;
+    }
+    producer.join();
+    CPPUNIT_ASSERT_MESSAGE("Events should be received intact", ordered);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Check                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t max_chunk_nb = (in_flight_nb + 4u * EventSystem::DwfEventPool::C_BATCH_SIZE) / EventSystem::DwfEventPool::C_BATCH_SIZE + 1u; // Events in queue and in both thread caches
+    CPPUNIT_ASSERT_MESSAGE("Storage should be recycled between threads", EventSystem::DwfEventPool::chunkNb() - chunk_nb <= max_chunk_nb);
+}
+
+void DwfEventPoolTest::testThreadExit()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           0 : First thread                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    auto create_events = []()
+    {
+        std::vector< std::unique_ptr<EventSystem::DwfEvent> > events;
+        for(EventSystem::EventID i = 0u; i < 500u; ++i)
+        {
+            events.emplace_back(new EventSystem::DwfEvent(i));
+        }
+    };
+    std::thread first(create_events);
+    first.join();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Second thread                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t chunk_nb = EventSystem::DwfEventPool::chunkNb();
+    std::thread second(create_events);
+    second.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Storage cached by exited thread should be reused", chunk_nb, EventSystem::DwfEventPool::chunkNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                  2 : Deletion during thread exit                   ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t batch_nb = EventSystem::DwfEventPool::sharedBatchNb();
+    std::thread third([]()
+    {
+        static thread_local LateEvents late_events; // Constructed before first allocation, so destroyed after pool cache is flushed
+        for(EventSystem::EventID i = 0u; i < 4u * EventSystem::DwfEventPool::C_BATCH_SIZE; ++i)
+        {
+            late_events.events.emplace_back(new EventSystem::DwfEvent(i));
+        }
+    });
+    third.join();
+    CPPUNIT_ASSERT_MESSAGE("Events deleted during thread exit should be gathered into full batches", EventSystem::DwfEventPool::sharedBatchNb() <= batch_nb + 6u); // Deleted events and flushed cache
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,299 @@
+/*!
+ * @file dwfmpscqueuetest.h
+ * @brief Unit tests of DwfMpscQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfMpscQueue class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_MPSC_QUEUE_TEST_H
+#define DWF_MPSC_QUEUE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class DwfMpscQueueTest
+* @brief Unit tests of DwfMpscQueue class
+*
+* Inherits from TestFixture
+*
+*/
+class DwfMpscQueueTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(DwfMpscQueueTest);
+        CPPUNIT_TEST(testFullNoLimit);
+        CPPUNIT_TEST(testSizeGetters);
+        CPPUNIT_TEST(testPushPopCopy);
+        CPPUNIT_TEST(testPushPopMoveFull);
+        CPPUNIT_TEST(testWaitManagement);
+        CPPUNIT_TEST(testClear);
+        CPPUNIT_TEST(testPopUpTo);
+        CPPUNIT_TEST(testPushBatch);
+        CPPUNIT_TEST(testTryPush);
+        CPPUNIT_TEST(testPushFor);
+        CPPUNIT_TEST(testMultipleProducers);
+        CPPUNIT_TEST(testNodeRecycling);
+        CPPUNIT_TEST(testPushException);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the DwfMpscQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    DwfMpscQueueTest();
+
+    /*!
+    * @brief Desctructor of the DwfMpscQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~DwfMpscQueueTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check full behavior when no size limit has been defined
+    *
+    * 0) Construct queue with default constructor (should have no size limit).
+    * 1) Push a lot of elements and check that it is never full.
+    *
+    */
+    void testFullNoLimit();
+
+    /*!
+    * @brief Check empty, size and full behavior
+    *
+    * 0) Create a size limited integer queue. Check it is empty.
+    * 1) Push elements up to size limit and check size, empty and full.
+    * 2) Pop elements and check size, empty and full.
+    *
+    */
+    void testSizeGetters();
+
+    /*!
+    * @brief Check push and pop behavior, copy version
+    *
+    * 0) Create an integer queue.
+    * 1) Push and pop more elements than queue size.
+    * 2) Check they are extracted in order.
+    *
+    */
+    void testPushPopCopy();
+
+    /*!
+    * @brief Check push and pop behavior, move version, when queue is full
+    *
+    * 0) Create an unique_ptr<int> queue.
+    * 1) Push elements until it is full. Check they are moved.
+    * 2) Check that next push triggers an exception and element is not moved
+    * 3) Pop element and try to push to check it is available again
+    *
+    */
+    void testPushPopMoveFull();
+
+    /*!
+    * @brief Check wait management behavior
+    *
+    * 0) Create an int queue.
+    * 1) Spawn a waiting thread and wait for elements.
+    * 2) Disable waiting and check thread exits without any element being pushed.
+    * 3) Enable waiting and check that an element must be pushed for wait to end.
+    *
+    */
+    void testWaitManagement();
+
+    /*!
+    * @brief Check clear behavior
+    *
+    * 0) Create an unique_ptr<int> queue.
+    * 1) Push a few elements.
+    * 2) Clear queue and check it is now empty and elements are deleted.
+    * 3) Push and pop an element to check queue is still usable.
+    *
+    */
+    void testClear();
+
+    /*!
+    * @brief Check popping several elements at once
+    *
+    * 0) Create an unique_ptr<int> queue.
+    * 1) Push a few elements.
+    * 2) Pop some of them and check the others stay in queue.
+    * 3) Pop all remaining elements and check they are extracted in order.
+    * 4) Spawn a thread popping all elements on empty queue and check it waits for a push.
+    * 5) Disable wait and check nothing is popped.
+    *
+    */
+    void testPopUpTo();
+
+    /*!
+    * @brief Check pushing several elements at once
+    *
+    * 0) Create an unique_ptr<int> queue of size N and push an element.
+    * 1) Push a batch of N-1 elements and check they are moved.
+    * 2) Push a batch on full queue and check exception is raised and nothing is moved.
+    * 3) Pop elements and check they are extracted in order.
+    *
+    */
+    void testPushBatch();
+
+    /*!
+    * @brief Check non throwing push behavior
+    *
+    * 0) Create an unique_ptr<int> queue and an int queue.
+    * 1) Push elements until queues are full. Check status and that elements are moved.
+    * 2) Push on full queues and check status and that element is not moved.
+    * 3) Pop element and check push is possible again.
+    *
+    */
+    void testTryPush();
+
+    /*!
+    * @brief Check push with timeout behavior
+    *
+    * 0) Create an unique_ptr<int> queue of size 1 and fill it.
+    * 1) Push with a timeout and check it expires without moving element.
+    * 2) Pop from another thread while pushing with a long timeout. Check element is pushed.
+    * 3) Disable wait and check push with timeout returns immediately.
+    *
+    */
+    void testPushFor();
+
+    /*!
+    * @brief Check several producer threads and a consumer thread running concurrently
+    *
+    * 0) Create a small integer queue.
+    * 1) Spawn consumer thread popping elements.
+    * 2) Spawn producer threads pushing a lot of increasing integers, retrying when queue is full.
+    * 3) Check consumer received all elements, in order for each producer.
+    *
+    */
+    void testMultipleProducers();
+
+    /*!
+    * @brief Check nodes are recycled instead of being allocated on every push
+    *
+    * 0) Create a small integer queue and warm pool up. Check nodes are allocated from pool.
+    * 1) Push and pop a lot of elements from a single thread. Check no storage was obtained from the system.
+    * 2) Push a lot of elements from a producer thread while popping them. Check storage obtained from the system stays bounded.
+    *
+    */
+    void testNodeRecycling();
+
+    /*!
+    * @brief Check queue room is given back when an element cannot be stored
+    *
+    * 0) Create a queue of size 1 of elements whose copy may throw.
+    * 1) Push an element whose copy throws. Check exception is forwarded and queue stays empty.
+    * 2) Push an element whose copy succeeds. Check it is pushed and popped.
+    *
+    */
+    void testPushException();
+};
+
+#endif // DWF_MPSC_QUEUE_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
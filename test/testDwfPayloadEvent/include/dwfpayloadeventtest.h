@@ -0,0 +1,180 @@
+/*!
+ * @file dwfpayloadeventtest.h
+ * @brief Unit tests of DwfPayloadEvent class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfPayloadEvent class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_PAYLOAD_EVENT_TEST_H
+#define DWF_PAYLOAD_EVENT_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class DwfPayloadEventTest
+* @brief Unit tests of DwfPayloadEvent class
+*
+* Inherits from TestFixture
+*
+*/
+class DwfPayloadEventTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(DwfPayloadEventTest);
+        CPPUNIT_TEST(testPayloadAccess);
+        CPPUNIT_TEST(testDestruction);
+        CPPUNIT_TEST(testPoolStorage);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the DwfPayloadEventTest class
+    *
+    * Does nothing.
+    *
+    */
+    DwfPayloadEventTest();
+
+    /*!
+    * @brief Desctructor of the DwfPayloadEventTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~DwfPayloadEventTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check payload is accessed with type checking
+    *
+    * 0) Create an event without payload. Check it holds no type and payload access throws.
+    * 1) Create events carrying an int and a structure. Check payloads are read with their type and access with another type throws.
+    * 2) Check payloadOf returns payload of a DwfPayloadEvent seen as a DwfEvent, and nullptr for other events or other types.
+    * 3) Move a std::string payload out of an event. Check it is moved.
+    *
+    */
+    void testPayloadAccess();
+
+    /*!
+    * @brief Check payload is destroyed with its event
+    *
+    * 0) Create an event carrying a payload counting destructor calls. Check payload is built once.
+    * 1) Delete it through std::unique_ptr<DwfEvent>. Check payload destructor is called once.
+    * 2) Create an event whose payload constructor throws. Check no payload destructor is called.
+    *
+    */
+    void testDestruction();
+
+    /*!
+    * @brief Check payload events are stored in DwfEventPool blocks
+    *
+    * 0) Check a DwfPayloadEvent fits in a pool block.
+    * 1) Create and delete many payload events. Check no storage is obtained from the system.
+    *
+    */
+    void testPoolStorage();
+};
+
+#endif // DWF_PAYLOAD_EVENT_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,317 @@
+/*!
+ * @file dwfpayloadeventtest.cpp
+ * @brief Unit tests of DwfPayloadEvent class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfPayloadEvent class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfpayloadeventtest.h"
+#include "dwfpayloadevent.h"
+#include "dwfeventpool.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(DwfPayloadEventTest);
+
+/*! @struct Position
+* @brief Payload made of several fields
+*
+*/
+struct Position
+{
+    double x; /*!< Abscissa.*/
+    double y; /*!< Ordinate.*/
+    uint32_t floor; /*!< Floor number.*/
+};
+
+/*! @class CountedPayload
+* @brief Payload counting constructor and destructor calls
+*
+*/
+class CountedPayload
+{
+public:
+    CountedPayload(uint32_t& construction_nb, uint32_t& destruction_nb, bool throw_on_construction = false) : m_destruction_nb(destruction_nb), m_name("a string long enough to be allocated")
+    {
+        if(throw_on_construction)
+        {
+            throw std::runtime_error("Payload construction failed");
+        }
+        ++construction_nb;
+    }
+
+    CountedPayload(const CountedPayload&) = delete;
+
+    CountedPayload(CountedPayload&& other) : m_destruction_nb(other.m_destruction_nb), m_name(std::move(other.m_name))
+    {
+    }
+
+    ~CountedPayload()
+    {
+        ++m_destruction_nb;
+    }
+
+private:
+    uint32_t& m_destruction_nb; /*!< Counter of destructor calls.*/
+
+    std::string m_name; /*!< Member owning memory, leaked if destructor is not called.*/
+};
+
+/*! @class ThrowingPayload
+* @brief Payload whose construction within an event throws
+*
+*/
+class ThrowingPayload
+{
+public:
+    ThrowingPayload(uint32_t& destruction_nb) : m_destruction_nb(destruction_nb)
+    {
+    }
+
+    ThrowingPayload(const ThrowingPayload& other) : m_destruction_nb(other.m_destruction_nb)
+    {
+        throw std::runtime_error("Payload copy failed");
+    }
+
+    ~ThrowingPayload()
+    {
+        ++m_destruction_nb;
+    }
+
+private:
+    uint32_t& m_destruction_nb; /*!< Counter of destructor calls.*/
+};
+
+DwfPayloadEventTest::DwfPayloadEventTest()
+{
+}
+
+DwfPayloadEventTest::~DwfPayloadEventTest()
+{
+}
+
+void DwfPayloadEventTest::setUp()
+{
+}
+
+void DwfPayloadEventTest::tearDown()
+{
+}
+
+void DwfPayloadEventTest::testPayloadAccess()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            0 : No payload                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    EventSystem::DwfPayloadEvent empty_event(1u);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Event should keep its id", static_cast<EventSystem::EventID>(1u), empty_event.getId());
+    CPPUNIT_ASSERT_MESSAGE("Event without payload should hold no type", !empty_event.holds<int>());
+    CPPUNIT_ASSERT_THROW_MESSAGE("Reading missing payload should throw", empty_event.payload<int>(), std::logic_error);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           1 : Typed access                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const EventSystem::DwfPayloadEvent int_event(2u, 42);
+    CPPUNIT_ASSERT_MESSAGE("Event should hold an int", int_event.holds<int>());
+    CPPUNIT_ASSERT_MESSAGE("Event should hold an int whatever its qualification", int_event.holds<const int>());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Int payload should be read", 42, int_event.payload<int>());
+    CPPUNIT_ASSERT_MESSAGE("Event should not hold an unsigned int", !int_event.holds<unsigned int>());
+    CPPUNIT_ASSERT_THROW_MESSAGE("Reading payload with another type should throw", int_event.payload<unsigned int>(), std::logic_error);
+
+    EventSystem::DwfPayloadEvent position_event(3u, Position{1.5, -2.0, 3u});
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Structure payload should be read", 1.5, position_event.payload<Position>().x);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Structure payload should be read", -2.0, position_event.payload<Position>().y);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Structure payload should be read", 3u, position_event.payload<Position>().floor);
+    position_event.payload<Position>().floor = 4u;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Structure payload should be modified", 4u, position_event.payload<Position>().floor);
+    CPPUNIT_ASSERT_THROW_MESSAGE("Reading payload with another type should throw", position_event.payload<int>(), std::logic_error);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       2 : Access from DwfEvent                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfPayloadEvent(4u, Position{0.5, 0.25, 1u}));
+    const Position* position = EventSystem::DwfPayloadEvent::payloadOf<Position>(*event);
+    CPPUNIT_ASSERT_MESSAGE("Payload should be found from a DwfEvent", position != nullptr);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be read from a DwfEvent", 0.25, position->y);
+    CPPUNIT_ASSERT_MESSAGE("Payload of another type should not be found", EventSystem::DwfPayloadEvent::payloadOf<int>(*event) == nullptr);
+    const EventSystem::DwfEvent plain_event(5u);
+    CPPUNIT_ASSERT_MESSAGE("Payload of an event without payload storage should not be found", EventSystem::DwfPayloadEvent::payloadOf<int>(plain_event) == nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            3 : Move out                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const std::string text("a string long enough to be allocated");
+    event.reset(new EventSystem::DwfPayloadEvent(6u, text));
+    std::string moved_text(std::move(*EventSystem::DwfPayloadEvent::payloadOf<std::string>(*event)));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be moved out of event", text, moved_text);
+    CPPUNIT_ASSERT_MESSAGE("Moved payload should be left empty", EventSystem::DwfPayloadEvent::payloadOf<std::string>(*event)->empty());
+}
+
+void DwfPayloadEventTest::testDestruction()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Build payload                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    uint32_t construction_nb = 0u;
+    uint32_t destruction_nb = 0u;
+    std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfPayloadEvent(1u, CountedPayload(construction_nb, destruction_nb)));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be built once", 1u, construction_nb);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Only temporary payload should be destroyed", 1u, destruction_nb);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        1 : Destroy payload                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    event.reset();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be destroyed with event", 2u, destruction_nb);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        2 : Failed construction                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    destruction_nb = 0u;
+    {
+        const ThrowingPayload payload(destruction_nb);
+        CPPUNIT_ASSERT_THROW_MESSAGE("Payload construction failure should be forwarded", event.reset(new EventSystem::DwfPayloadEvent(2u, payload)), std::runtime_error);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload which was not built should not be destroyed", 0u, destruction_nb);
+        CPPUNIT_ASSERT_MESSAGE("Event should not be created", !event);
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Only original payload should be destroyed", 1u, destruction_nb);
+}
+
+void DwfPayloadEventTest::testPoolStorage()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           0 : Event size                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_MESSAGE("Payload event should fit in a pool block", sizeof(EventSystem::DwfPayloadEvent) <= EventSystem::DwfEventPool::C_BLOCK_SIZE);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Many events                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector< std::unique_ptr<EventSystem::DwfEvent> > events;
+    for(EventSystem::EventID i = 0u; i < 1000u; ++i) // Warm up
+    {
+        events.emplace_back(new EventSystem::DwfPayloadEvent(i, Position{0.0, 0.0, i}));
+    }
+    events.clear();
+    const size_t chunk_nb = EventSystem::DwfEventPool::chunkNb();
+    for(uint32_t round = 0u; round < 100u; ++round)
+    {
+        for(EventSystem::EventID i = 0u; i < 1000u; ++i)
+        {
+            events.emplace_back(new EventSystem::DwfPayloadEvent(i, Position{0.0, 0.0, i}));
+        }
+        for(EventSystem::EventID i = 0u; i < 1000u; ++i)
+        {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should not be corrupted by other events", i, EventSystem::DwfPayloadEvent::payloadOf<Position>(*events[i])->floor);
+        }
+        events.clear();
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Recycled storage should be enough", chunk_nb, EventSystem::DwfEventPool::chunkNb());
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,212 @@
+/*!
+ * @file dwfpriorityqueuetest.h
+ * @brief Unit tests of DwfPriorityQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfPriorityQueue class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_PRIORITY_QUEUE_TEST_H
+#define DWF_PRIORITY_QUEUE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class DwfPriorityQueueTest
+* @brief Unit tests of DwfPriorityQueue class
+*
+* Inherits from TestFixture
+*
+*/
+class DwfPriorityQueueTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(DwfPriorityQueueTest);
+        CPPUNIT_TEST(testInvalidArguments);
+        CPPUNIT_TEST(testPriorityOrder);
+        CPPUNIT_TEST(testFull);
+        CPPUNIT_TEST(testPushBatch);
+        CPPUNIT_TEST(testPushFor);
+        CPPUNIT_TEST(testWaitManagement);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the DwfPriorityQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    DwfPriorityQueueTest();
+
+    /*!
+    * @brief Desctructor of the DwfPriorityQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~DwfPriorityQueueTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check invalid lane numbers and priorities are rejected
+    *
+    * 0) Check queues without lane or with too many lanes cannot be created.
+    * 1) Create a queue with N lanes. Check pushing with priority N throws an exception and nothing is pushed.
+    *
+    */
+    void testInvalidArguments();
+
+    /*!
+    * @brief Check elements are popped by decreasing priority then in push order
+    *
+    * 0) Create an int queue with 3 lanes.
+    * 1) Push elements of interleaved priorities, default priority included. Check size getters.
+    * 2) Pop some elements one by one then all remaining ones at once. Check order.
+    *
+    */
+    void testPriorityOrder();
+
+    /*!
+    * @brief Check behavior of a full queue
+    *
+    * 0) Create an unique_ptr<int> queue with 2 lanes and size N. Fill it with low priority elements.
+    * 1) Push high priority element. Check an exception is thrown, that element is not moved and that non throwing push reports queue is full.
+    * 2) Pop an element and check high priority element can be pushed.
+    *
+    */
+    void testFull();
+
+    /*!
+    * @brief Check push of several elements at once
+    *
+    * 0) Create an int queue with 2 lanes and size N. Push a low priority element.
+    * 1) Push a batch not fitting in queue. Check an exception is thrown and nothing is pushed.
+    * 2) Push a high priority batch. Check it is popped before low priority element.
+    *
+    */
+    void testPushBatch();
+
+    /*!
+    * @brief Check push with timeout behavior
+    *
+    * 0) Create an int queue with 2 lanes and size 1. Fill it.
+    * 1) Push with a timeout and check it expires.
+    * 2) Pop from another thread while pushing with a long timeout. Check element is pushed.
+    *
+    */
+    void testPushFor();
+
+    /*!
+    * @brief Check wait management behavior
+    *
+    * 0) Create an int queue with 2 lanes.
+    * 1) Spawn a thread waiting for elements.
+    * 2) Disable wait and check thread exits without any element being pushed.
+    *
+    */
+    void testWaitManagement();
+};
+
+#endif // DWF_PRIORITY_QUEUE_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
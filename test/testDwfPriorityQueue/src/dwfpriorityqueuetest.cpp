@@ -0,0 +1,324 @@
+/*!
+ * @file dwfpriorityqueuetest.cpp
+ * @brief Unit tests of DwfPriorityQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfPriorityQueue class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfpriorityqueuetest.h"
+#include "dwfpriorityqueue.h"
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(DwfPriorityQueueTest);
+
+DwfPriorityQueueTest::DwfPriorityQueueTest()
+{
+}
+
+DwfPriorityQueueTest::~DwfPriorityQueueTest()
+{
+}
+
+void DwfPriorityQueueTest::setUp()
+{
+}
+
+void DwfPriorityQueueTest::tearDown()
+{
+}
+
+void DwfPriorityQueueTest::testInvalidArguments()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Lanes number                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_THROW_MESSAGE("Queue without lane should not be created", DwfContainers::DwfPriorityQueue<int>(0u), std::invalid_argument);
+    CPPUNIT_ASSERT_THROW_MESSAGE("Queue with too many lanes should not be created", DwfContainers::DwfPriorityQueue<int>(DwfContainers::DwfPriorityQueue<int>::C_MAX_LANE_NB + 1u), std::invalid_argument);
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("Queue with maximum number of lanes should be created", DwfContainers::DwfPriorityQueue<int>(DwfContainers::DwfPriorityQueue<int>::C_MAX_LANE_NB));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            1 : Priority                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfPriorityQueue<int> testQueue(3u);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of lanes is not correct", static_cast<size_t>(3u), testQueue.laneNb());
+    CPPUNIT_ASSERT_THROW_MESSAGE("Priority without lane should be rejected", testQueue.push(1, 3u), std::invalid_argument);
+    CPPUNIT_ASSERT_THROW_MESSAGE("Priority without lane should be rejected", testQueue.tryPush(1, 3u), std::invalid_argument);
+    CPPUNIT_ASSERT_MESSAGE("Nothing should be pushed with invalid priority", testQueue.empty());
+}
+
+void DwfPriorityQueueTest::testPriorityOrder()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfPriorityQueue<int> testQueue(3u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(0);
+    testQueue.push(10, 1u);
+    testQueue.push(1);
+    testQueue.push(20, 2u);
+    testQueue.push(11, 1u);
+    testQueue.push(21, 2u);
+    testQueue.push(2, 0u);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All lanes should be counted in size", static_cast<size_t>(7u), testQueue.size());
+    CPPUNIT_ASSERT_MESSAGE("Queue without size limit should never be full", !testQueue.full());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               2 : Pop                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    int popped = -1;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Oldest highest priority element should be popped first", 20, popped);
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements of a lane should be popped in push order", 21, popped);
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Lower priority should be popped once higher lanes are empty", 10, popped);
+    testQueue.push(22, 2u);
+    std::vector<int> remaining;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All remaining elements should be popped", static_cast<size_t>(5u), testQueue.popAll(remaining));
+    CPPUNIT_ASSERT_MESSAGE("Elements should be popped by decreasing priority then in push order", std::vector<int>({22, 11, 0, 1, 2}) == remaining);
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty", testQueue.empty());
+}
+
+void DwfPriorityQueueTest::testFull()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 3u;
+    DwfContainers::DwfPriorityQueue< std::unique_ptr<int> > testQueue(2u, queue_size);
+    for(int i=0; i<static_cast<int>(queue_size); ++i)
+    {
+        testQueue.push(std::unique_ptr<int>(new int(i)));
+    }
+    CPPUNIT_ASSERT_MESSAGE("Queue should be full", testQueue.full());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push on full queue                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> element(new int(42));
+    CPPUNIT_ASSERT_THROW_MESSAGE("Push on full queue should throw whatever the priority", testQueue.push(std::move(element), 1u), std::runtime_error);
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if queue is full", element != nullptr);
+    CPPUNIT_ASSERT_MESSAGE("Full queue should be reported", DwfContainers::PushStatus::FULL == testQueue.tryPush(std::move(element), 1u));
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if queue is full", element != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Pop and Push                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> popped;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_MESSAGE("Push should succeed once room is freed", DwfContainers::PushStatus::PUSHED == testQueue.tryPush(std::move(element), 1u));
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("High priority element should be popped first", 42, *popped);
+}
+
+void DwfPriorityQueueTest::testPushBatch()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 3u;
+    DwfContainers::DwfPriorityQueue<int> testQueue(2u, queue_size);
+    testQueue.push(0);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push too many                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<int> batch = {10, 11, 12};
+    CPPUNIT_ASSERT_THROW_MESSAGE("Batch not fitting in queue should not be pushed", testQueue.pushBatch(batch, 1u), std::runtime_error);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Nothing should be pushed if batch does not fit", static_cast<size_t>(1u), testQueue.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Push batch                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    batch = {10, 11};
+    testQueue.pushBatch(batch, 1u);
+    CPPUNIT_ASSERT_MESSAGE("Batch should be cleared once pushed", batch.empty());
+    std::vector<int> popped;
+    testQueue.popAll(popped);
+    CPPUNIT_ASSERT_MESSAGE("High priority batch should be popped first", std::vector<int>({10, 11, 0}) == popped);
+}
+
+void DwfPriorityQueueTest::testPushFor()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfPriorityQueue<int> testQueue(2u, 1u);
+    testQueue.push(0);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push on full queue                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    CPPUNIT_ASSERT_MESSAGE("Push on queue staying full should time out", DwfContainers::PushStatus::TIMEOUT == testQueue.pushFor(1, std::chrono::milliseconds(50), 1u));
+    CPPUNIT_ASSERT_MESSAGE("Push should wait for timeout", std::chrono::steady_clock::now() - start_time >= std::chrono::milliseconds(50));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Room is freed                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread popper([&testQueue]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        int popped = -1;
+        testQueue.pop(popped);
+    });
+    CPPUNIT_ASSERT_MESSAGE("Push should succeed once room is freed", DwfContainers::PushStatus::PUSHED == testQueue.pushFor(1, std::chrono::seconds(5), 1u));
+    popper.join();
+    int popped = -1;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pushed element should be popped", 1, popped);
+}
+
+void DwfPriorityQueueTest::testWaitManagement()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfPriorityQueue<int> testQueue(2u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       1 : Spawn popper thread                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    int popped = 21;
+    std::thread popper([&testQueue, &popped]()
+    {
+        testQueue.pop(popped);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Disable Waiting                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.disableWait();
+    popper.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Popped element should not be modified if no elements are received in queue", 21, popped);
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
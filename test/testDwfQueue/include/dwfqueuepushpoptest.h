@@ -93,6 +93,13 @@ public:
         CPPUNIT_TEST(testPopBlockingCopy);
         CPPUNIT_TEST(testPopBlockingMove);
         CPPUNIT_TEST(testClear);
+        CPPUNIT_TEST(testPopUpTo);
+        CPPUNIT_TEST(testPushBatch);
+        CPPUNIT_TEST(testTryPush);
+        CPPUNIT_TEST(testSizeLimitContention);
+        CPPUNIT_TEST(testDropOldest);
+        CPPUNIT_TEST(testDropNewest);
+        CPPUNIT_TEST(testCoalesceById);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -201,6 +208,84 @@ public:
     *
     */
     void testClear();
+
+    /*!
+    * @brief Check popping several elements at once
+    *
+    * 0) Create an unique_ptr<int> queue.
+    * 1) Push a few elements.
+    * 2) Pop some of them and check the others stay in queue.
+    * 3) Pop all remaining elements and check they are extracted in order.
+    * 4) Spawn a thread popping all elements on empty queue and check it waits for a push.
+    * 5) Disable wait and check nothing is popped.
+    *
+    */
+    void testPopUpTo();
+
+    /*!
+    * @brief Check pushing several elements at once
+    *
+    * 0) Create an unique_ptr<int> queue of size N and push an element.
+    * 1) Push a batch of N-1 elements and check they are moved.
+    * 2) Push a batch on full queue and check exception is raised and nothing is moved.
+    * 3) Pop elements and check they are extracted in order.
+    *
+    */
+    void testPushBatch();
+
+    /*!
+    * @brief Check non throwing push behavior
+    *
+    * 0) Create an unique_ptr<int> queue and an int queue.
+    * 1) Push elements until queues are full. Check status and that elements are moved.
+    * 2) Push on full queues and check status and that element is not moved.
+    * 3) Pop element and check push is possible again.
+    *
+    */
+    void testTryPush();
+
+    /*!
+    * @brief Check size limitation cannot be exceeded by concurrent producers
+    *
+    * 0) Create a size limited int queue.
+    * 1) Spawn producer threads pushing many elements without any consumer.
+    * 2) Check exactly size limit elements were pushed.
+    *
+    */
+    void testSizeLimitContention();
+
+    /*!
+    * @brief Check drop oldest overflow policy
+    *
+    * 0) Create an int queue of size N dropping oldest elements.
+    * 1) Push 2N elements one by one then N/2 elements as a batch. Check no exception is thrown.
+    * 2) Check drop counter and that the N latest elements are popped in order.
+    *
+    */
+    void testDropOldest();
+
+    /*!
+    * @brief Check drop newest overflow policy
+    *
+    * 0) Create an unique_ptr<int> queue of size N dropping newest elements.
+    * 1) Push 2N elements one by one. Check no exception is thrown and that dropped elements are not moved.
+    * 2) Push N/2 elements as a batch. Check no exception is thrown.
+    * 3) Check drop counter and that the N first elements are popped in order.
+    *
+    */
+    void testDropNewest();
+
+    /*!
+    * @brief Check coalesce by id overflow policy
+    *
+    * 0) Create an int pair queue of size N coalescing elements with the same first member. Check a key comparison function is required.
+    * 1) Fill queue with elements of N/2 keys. Check no element is coalesced while queue is not full.
+    * 2) Push elements with existing keys. Check they replace the latest queued element with the same key.
+    * 3) Push element with a new key. Check oldest element is dropped.
+    * 4) Check counters and popped elements.
+    *
+    */
+    void testCoalesceById();
 };
 
 #endif // DWF_QUEUE_PUSH_POP_TEST_H
@@ -90,6 +90,9 @@ public:
         CPPUNIT_TEST(waitManagementCopy);
         CPPUNIT_TEST(waitManagementMove);
         CPPUNIT_TEST(waitManagementDeletion);
+        CPPUNIT_TEST(testPushFor);
+        CPPUNIT_TEST(testBlockingPush);
+        CPPUNIT_TEST(testAdaptiveWait);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -161,6 +164,38 @@ public:
     *
     */
     void waitManagementDeletion();
+
+    /*!
+    * @brief Check push with timeout behavior
+    *
+    * 0) Create an unique_ptr<int> queue of size 1 and fill it.
+    * 1) Push with a timeout and check it expires without moving element.
+    * 2) Pop from another thread while pushing with a long timeout. Check element is pushed.
+    * 3) Disable wait and check push with timeout returns immediately.
+    *
+    */
+    void testPushFor();
+
+    /*!
+    * @brief Check push behavior with blocking overflow policy
+    *
+    * 0) Create a blocking int queue of size N and fill it.
+    * 1) Spawn a pushing thread and check it waits while queue is full.
+    * 2) Pop an element and check pushing thread completes.
+    * 3) Spawn a pushing thread then disable wait. Check push throws an exception.
+    *
+    */
+    void testBlockingPush();
+
+    /*!
+    * @brief Check pop behavior with a spinning wait strategy
+    *
+    * 0) Create an int queue spinning and yielding a long time before parking.
+    * 1) Spawn a popping thread then push an element. Check element is popped.
+    * 2) Spawn a batch popping thread then disable wait. Check thread exits without popping anything.
+    *
+    */
+    void testAdaptiveWait();
 };
 
 #endif // DWF_QUEUE_WAIT_MANAGEMENT_TEST_H
@@ -76,6 +76,9 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #include <stdexcept>
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <vector>
+#include <utility>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(DwfQueuePushPopTest);
 
@@ -385,6 +388,351 @@ void DwfQueuePushPopTest::testClear()
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Only first element should have been processed", 1u, elements_popped.load()); // First element was processed. Due to long sleep, no other should be processed before clear.
 }
 
+void DwfQueuePushPopTest::testPopUpTo()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfQueue< std::unique_ptr<int> > testQueue(8u);
+    std::vector< std::unique_ptr<int> > popped;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<5; ++i)
+    {
+        testQueue.push(std::unique_ptr<int>(new int(i)));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            2 : Pop Up To                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Only requested number of elements should be popped", static_cast<size_t>(2u), testQueue.popUpTo(2u, popped));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Remaining elements should stay in queue", static_cast<size_t>(3u), testQueue.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              3 : Pop All                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All remaining elements should be popped", static_cast<size_t>(3u), testQueue.popAll(popped));
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty", testQueue.empty());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Popped elements should be appended", static_cast<size_t>(5u), popped.size());
+    for(int i=0; i<5; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", i, *popped[i]);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           4 : Blocking pop                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    popped.clear();
+    std::atomic<size_t> popped_nb(42u);
+    std::thread readingThread([&testQueue, &popped, &popped_nb]()
+    {
+        popped_nb = testQueue.popAll(popped);
+    });
+    std::this_thread::sleep_for (std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pop should block while queue is empty", static_cast<size_t>(42u), popped_nb.load());
+    testQueue.push(std::unique_ptr<int>(new int(47)));
+    readingThread.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pushed element should be popped", static_cast<size_t>(1u), popped_nb.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pushed element should be popped", 47, *popped[0]);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          5 : Disable wait                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(std::unique_ptr<int>(new int(12)));
+    testQueue.disableWait();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Nothing should be popped when wait is disabled", static_cast<size_t>(0u), testQueue.popUpTo(2u, popped));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Argument should not be modified when wait is disabled", static_cast<size_t>(1u), popped.size());
+}
+
+void DwfQueuePushPopTest::testPushBatch()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfQueue< std::unique_ptr<int> > testQueue(4u);
+    std::vector< std::unique_ptr<int> > batch;
+    testQueue.push(std::unique_ptr<int>(new int(0)));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           1 : Push batch                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=1; i<4; ++i)
+    {
+        batch.emplace_back(new int(i));
+    }
+    testQueue.pushBatch(batch);
+    CPPUNIT_ASSERT_MESSAGE("Batch should be cleared once pushed", batch.empty());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All elements should be in queue", static_cast<size_t>(4u), testQueue.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       2 : Push batch on full                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    batch.emplace_back(new int(42));
+    CPPUNIT_ASSERT_THROW_MESSAGE("Pushing batch on full queue should raise an exception", testQueue.pushBatch(batch), std::runtime_error);
+    CPPUNIT_ASSERT_MESSAGE("Batch should not be moved if queue is full", batch.size() == 1u && batch[0] != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Check order                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<4; ++i)
+    {
+        std::unique_ptr<int> popped;
+        testQueue.pop(popped);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", i, *popped);
+    }
+}
+
+void DwfQueuePushPopTest::testTryPush()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfQueue< std::unique_ptr<int> > testQueue(2u);
+    DwfContainers::DwfQueue<int> copyQueue(1u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<2; ++i)
+    {
+        std::unique_ptr<int> element(new int(i));
+        CPPUNIT_ASSERT_MESSAGE("Push on not full queue should succeed", DwfContainers::PushStatus::PUSHED == testQueue.tryPush(std::move(element)));
+        CPPUNIT_ASSERT_MESSAGE("Element should be moved", element == nullptr);
+    }
+    CPPUNIT_ASSERT_MESSAGE("Push on not full queue should succeed", DwfContainers::PushStatus::PUSHED == copyQueue.tryPush(12));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Push on full                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> element(new int(42));
+    CPPUNIT_ASSERT_MESSAGE("Push on full queue should report it", DwfContainers::PushStatus::FULL == testQueue.tryPush(std::move(element)));
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if queue is full", element != nullptr);
+    CPPUNIT_ASSERT_MESSAGE("Push on full queue should report it", DwfContainers::PushStatus::FULL == copyQueue.tryPush(13));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Pop and Push                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> popped;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_MESSAGE("Push after pop should succeed", DwfContainers::PushStatus::PUSHED == testQueue.tryPush(std::move(element)));
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", 1, *popped);
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", 42, *popped);
+}
+
+void DwfQueuePushPopTest::testSizeLimitContention()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 16u;
+    DwfContainers::DwfQueue<int> testQueue(queue_size);
+    std::atomic<size_t> pushed_nb(0u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     1 : Spawn producer threads                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<std::thread> producers;
+    for(int producer=0; producer<8; ++producer)
+    {
+        producers.emplace_back([&testQueue, &pushed_nb]()
+        {
+            for(int i=0; i<1000; ++i)
+            {
+                try
+                {
+                    testQueue.push(i);
+                    ++pushed_nb;
+                }
+                catch(const std::runtime_error&) // Queue is full
+                {
+                }
+            }
+        });
+    }
+    for(std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          2 : Check size                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Exactly size limit elements should be pushed", queue_size, pushed_nb.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue size should not exceed limit", queue_size, testQueue.size());
+}
+
+void DwfQueuePushPopTest::testDropOldest()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 4u;
+    DwfContainers::DwfQueue<int> testQueue(queue_size, DwfContainers::OverflowPolicy::DROP_OLDEST);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<static_cast<int>(2*queue_size); ++i)
+    {
+        CPPUNIT_ASSERT_NO_THROW_MESSAGE("Push on full queue should drop oldest element", testQueue.push(i));
+    }
+    std::vector<int> batch = {100, 101};
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("Batch push on full queue should drop oldest elements", testQueue.pushBatch(batch));
+    CPPUNIT_ASSERT_MESSAGE("Batch should be cleared once pushed", batch.empty());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Check                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should stay full", queue_size, testQueue.size());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of dropped elements is not correct", static_cast<uint64_t>(queue_size + 2u), testQueue.droppedElementNb());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("No element should be coalesced", static_cast<uint64_t>(0u), testQueue.coalescedElementNb());
+    std::vector<int> popped;
+    testQueue.popAll(popped);
+    CPPUNIT_ASSERT_MESSAGE("Latest elements should be kept in order", std::vector<int>({6, 7, 100, 101}) == popped);
+}
+
+void DwfQueuePushPopTest::testDropNewest()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 4u;
+    DwfContainers::DwfQueue< std::unique_ptr<int> > testQueue(queue_size, DwfContainers::OverflowPolicy::DROP_NEWEST);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<static_cast<int>(2*queue_size); ++i)
+    {
+        std::unique_ptr<int> element(new int(i));
+        CPPUNIT_ASSERT_NO_THROW_MESSAGE("Push on full queue should drop element", testQueue.push(std::move(element)));
+        CPPUNIT_ASSERT_MESSAGE("Element should only be moved if pushed", (element == nullptr) == (i < static_cast<int>(queue_size)));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Push batch                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector< std::unique_ptr<int> > batch;
+    batch.emplace_back(new int(100));
+    batch.emplace_back(new int(101));
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("Batch push on full queue should drop elements", testQueue.pushBatch(batch));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              3 : Check                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of dropped elements is not correct", static_cast<uint64_t>(queue_size + 2u), testQueue.droppedElementNb());
+    std::vector< std::unique_ptr<int> > popped;
+    testQueue.popAll(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should stay full", queue_size, popped.size());
+    for(size_t i=0; i<popped.size(); ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("First elements should be kept in order", static_cast<int>(i), *popped[i]);
+    }
+}
+
+void DwfQueuePushPopTest::testCoalesceById()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    typedef std::pair<int, int> KeyValue;
+    const size_t queue_size = 4u;
+    CPPUNIT_ASSERT_THROW_MESSAGE("Coalescing queue should need a key comparison function", DwfContainers::DwfQueue<KeyValue>(queue_size, DwfContainers::OverflowPolicy::COALESCE_BY_ID), std::invalid_argument);
+    DwfContainers::DwfQueue<KeyValue> testQueue(queue_size, DwfContainers::OverflowPolicy::COALESCE_BY_ID, [](const KeyValue& lhs, const KeyValue& rhs){return lhs.first == rhs.first;});
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Fill                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<static_cast<int>(queue_size); ++i)
+    {
+        testQueue.push(KeyValue(i%2, i));
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should not be coalesced while queue is not full", queue_size, testQueue.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            2 : Coalesce                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(KeyValue(0, 10));
+    testQueue.push(KeyValue(1, 11));
+    testQueue.push(KeyValue(1, 12));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            3 : New key                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(KeyValue(2, 20));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              4 : Check                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of coalesced elements is not correct", static_cast<uint64_t>(3u), testQueue.coalescedElementNb());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Number of dropped elements is not correct", static_cast<uint64_t>(1u), testQueue.droppedElementNb());
+    std::vector<KeyValue> popped;
+    testQueue.popAll(popped);
+    CPPUNIT_ASSERT_MESSAGE("Latest elements with the same key should be replaced", std::vector<KeyValue>({KeyValue(1, 1), KeyValue(0, 10), KeyValue(1, 12), KeyValue(2, 20)}) == popped);
+}
+
 //  ______________________________
 // |                              |
 // |    ______________________    |
@@ -76,6 +76,8 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 #include <stdexcept>
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <vector>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(DwfQueueWaitManagementTest);
 
@@ -291,6 +293,161 @@ void DwfQueueWaitManagementTest::waitManagementDeletion()
     readingThread.join();
 }
 
+void DwfQueueWaitManagementTest::testPushFor()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfQueue< std::unique_ptr<int> > testQueue(1u);
+    testQueue.push(std::unique_ptr<int>(new int(0)));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push on full queue                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> element(new int(42));
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    CPPUNIT_ASSERT_MESSAGE("Push on queue staying full should time out", DwfContainers::PushStatus::TIMEOUT == testQueue.pushFor(std::move(element), std::chrono::milliseconds(50)));
+    CPPUNIT_ASSERT_MESSAGE("Push should wait for timeout", std::chrono::steady_clock::now() - start_time >= std::chrono::milliseconds(50));
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if push timed out", element != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Room is freed                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread popper([&testQueue]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        std::unique_ptr<int> popped;
+        testQueue.pop(popped);
+    });
+    CPPUNIT_ASSERT_MESSAGE("Push should succeed once room is freed", DwfContainers::PushStatus::PUSHED == testQueue.pushFor(std::move(element), std::chrono::seconds(5)));
+    CPPUNIT_ASSERT_MESSAGE("Element should be moved", element == nullptr);
+    popper.join();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         3 : Wait is disabled                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.disableWait();
+    element.reset(new int(12));
+    start_time = std::chrono::steady_clock::now();
+    CPPUNIT_ASSERT_MESSAGE("Push should not wait when wait is disabled", DwfContainers::PushStatus::TIMEOUT == testQueue.pushFor(std::move(element), std::chrono::seconds(5)));
+    CPPUNIT_ASSERT_MESSAGE("Push should not wait when wait is disabled", std::chrono::steady_clock::now() - start_time < std::chrono::seconds(1));
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if push timed out", element != nullptr);
+}
+
+void DwfQueueWaitManagementTest::testBlockingPush()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 2u;
+    DwfContainers::DwfQueue<int> testQueue(queue_size, DwfContainers::OverflowPolicy::BLOCK);
+    for(size_t i=0; i<queue_size; ++i)
+    {
+        testQueue.push(static_cast<int>(i));
+    }
+    std::atomic<bool> pushed(false);
+    std::atomic<bool> thrown(false);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                      1 : Spawn pushing thread                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread pusher([&testQueue, &pushed]()
+    {
+        testQueue.push(42);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_MESSAGE("Push should wait while queue is full", !pushed);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            2 : Free room                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    int popped = -1;
+    testQueue.pop(popped);
+    pusher.join();
+    CPPUNIT_ASSERT_MESSAGE("Push should complete once room is freed", pushed);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should be full again", queue_size, testQueue.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          3 : Disable wait                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread blocked_pusher([&testQueue, &thrown]()
+    {
+        try
+        {
+            testQueue.push(12);
+        }
+        catch(const std::runtime_error&)
+        {
+            thrown = true;
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    testQueue.disableWait();
+    blocked_pusher.join();
+    CPPUNIT_ASSERT_MESSAGE("Waiting push should throw when wait is disabled", thrown);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Element should not be pushed when wait is disabled", queue_size, testQueue.size());
+}
+
+void DwfQueueWaitManagementTest::testAdaptiveWait()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfQueue<int> testQueue(DwfContainers::DwfQueue<int>::C_NO_SIZE_LIMIT, DwfContainers::OverflowPolicy::THROW, DwfContainers::DwfQueue<int>::KeyEqual(), DwfContainers::WaitStrategy(1000000u, 1000000u));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Pop                               ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    int popped = -1;
+    std::thread popper([&testQueue, &popped]()
+    {
+        testQueue.pop(popped);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    testQueue.push(42);
+    popper.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Element pushed while consumer polls should be popped", 42, popped);
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty", testQueue.empty());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          2 : Disable wait                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<int> popped_batch;
+    size_t popped_nb = 1u;
+    std::thread batch_popper([&testQueue, &popped_batch, &popped_nb]()
+    {
+        popped_nb = testQueue.popAll(popped_batch);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    testQueue.disableWait();
+    batch_popper.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Nothing should be popped when wait is disabled while polling", static_cast<size_t>(0u), popped_nb);
+    CPPUNIT_ASSERT_MESSAGE("Nothing should be popped when wait is disabled while polling", popped_batch.empty());
+}
+
 //  ______________________________
 // |                              |
 // |    ______________________    |
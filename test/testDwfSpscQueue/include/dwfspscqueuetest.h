@@ -0,0 +1,276 @@
+/*!
+ * @file dwfspscqueuetest.h
+ * @brief Unit tests of DwfSpscQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfSpscQueue class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_SPSC_QUEUE_TEST_H
+#define DWF_SPSC_QUEUE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class DwfSpscQueueTest
+* @brief Unit tests of DwfSpscQueue class
+*
+* Inherits from TestFixture
+*
+*/
+class DwfSpscQueueTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(DwfSpscQueueTest);
+        CPPUNIT_TEST(testInvalidSize);
+        CPPUNIT_TEST(testSizeGetters);
+        CPPUNIT_TEST(testPushPopCopy);
+        CPPUNIT_TEST(testPushPopMoveFull);
+        CPPUNIT_TEST(testWaitManagement);
+        CPPUNIT_TEST(testClear);
+        CPPUNIT_TEST(testPopUpTo);
+        CPPUNIT_TEST(testPushBatch);
+        CPPUNIT_TEST(testTryPush);
+        CPPUNIT_TEST(testPushFor);
+        CPPUNIT_TEST(testProducerConsumer);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the DwfSpscQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    DwfSpscQueueTest();
+
+    /*!
+    * @brief Desctructor of the DwfSpscQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~DwfSpscQueueTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check queue cannot be created without size limit
+    *
+    * 0) Check constructor with C_NO_SIZE_LIMIT size throws std::invalid_argument.
+    *
+    */
+    void testInvalidSize();
+
+    /*!
+    * @brief Check empty, size and full behavior
+    *
+    * 0) Create an integer queue with a size which is not a power of two. Check it is empty.
+    * 1) Push elements up to size limit and check size, empty and full.
+    * 2) Pop elements and check size, empty and full.
+    *
+    */
+    void testSizeGetters();
+
+    /*!
+    * @brief Check push and pop behavior, copy version
+    *
+    * 0) Create an integer queue.
+    * 1) Push and pop more elements than queue size so that ring buffer wraps around.
+    * 2) Check they are extracted in order.
+    *
+    */
+    void testPushPopCopy();
+
+    /*!
+    * @brief Check push and pop behavior, move version, when queue is full
+    *
+    * 0) Create an unique_ptr<int> queue.
+    * 1) Push elements until it is full. Check they are moved.
+    * 2) Check that next push triggers an exception and element is not moved
+    * 3) Pop element and try to push to check it is available again
+    *
+    */
+    void testPushPopMoveFull();
+
+    /*!
+    * @brief Check wait management behavior
+    *
+    * 0) Create an int queue.
+    * 1) Spawn a waiting thread and wait for elements.
+    * 2) Disable waiting and check thread exits without any element being pushed.
+    * 3) Enable waiting and check that an element must be pushed for wait to end.
+    *
+    */
+    void testWaitManagement();
+
+    /*!
+    * @brief Check clear behavior
+    *
+    * 0) Create an unique_ptr<int> queue.
+    * 1) Push a few elements.
+    * 2) Clear queue and check it is now empty and elements are deleted.
+    * 3) Push and pop an element to check queue is still usable.
+    *
+    */
+    void testClear();
+
+    /*!
+    * @brief Check popping several elements at once
+    *
+    * 0) Create an unique_ptr<int> queue.
+    * 1) Push a few elements.
+    * 2) Pop some of them and check the others stay in queue.
+    * 3) Pop all remaining elements and check they are extracted in order.
+    * 4) Spawn a thread popping all elements on empty queue and check it waits for a push.
+    * 5) Disable wait and check nothing is popped.
+    *
+    */
+    void testPopUpTo();
+
+    /*!
+    * @brief Check pushing several elements at once
+    *
+    * 0) Create an unique_ptr<int> queue of size N and push an element.
+    * 1) Push a batch of N-1 elements and check they are moved.
+    * 2) Push a batch on full queue and check exception is raised and nothing is moved.
+    * 3) Pop elements and check they are extracted in order.
+    *
+    */
+    void testPushBatch();
+
+    /*!
+    * @brief Check non throwing push behavior
+    *
+    * 0) Create an unique_ptr<int> queue and an int queue.
+    * 1) Push elements until queues are full. Check status and that elements are moved.
+    * 2) Push on full queues and check status and that element is not moved.
+    * 3) Pop element and check push is possible again.
+    *
+    */
+    void testTryPush();
+
+    /*!
+    * @brief Check push with timeout behavior
+    *
+    * 0) Create an unique_ptr<int> queue of size 1 and fill it.
+    * 1) Push with a timeout and check it expires without moving element.
+    * 2) Pop from another thread while pushing with a long timeout. Check element is pushed.
+    * 3) Disable wait and check push with timeout returns immediately.
+    *
+    */
+    void testPushFor();
+
+    /*!
+    * @brief Check a producer thread and a consumer thread running concurrently
+    *
+    * 0) Create a small integer queue.
+    * 1) Spawn consumer thread popping elements.
+    * 2) Push a lot of increasing integers, retrying when queue is full.
+    * 3) Check consumer received all elements in order.
+    *
+    */
+    void testProducerConsumer();
+};
+
+#endif // DWF_SPSC_QUEUE_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,622 @@
+/*!
+ * @file dwfspscqueuetest.cpp
+ * @brief Unit tests of DwfSpscQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfSpscQueue class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwfspscqueuetest.h"
+#include "dwfspscqueue.h"
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(DwfSpscQueueTest);
+
+DwfSpscQueueTest::DwfSpscQueueTest()
+{
+}
+
+DwfSpscQueueTest::~DwfSpscQueueTest()
+{
+}
+
+void DwfSpscQueueTest::setUp()
+{
+}
+
+void DwfSpscQueueTest::tearDown()
+{
+}
+
+void DwfSpscQueueTest::testInvalidSize()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_THROW_MESSAGE("Lock-free queue must be size limited", DwfContainers::DwfSpscQueue<int> testQueue(0u), std::invalid_argument);
+}
+
+void DwfSpscQueueTest::testSizeGetters()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 5u;
+    DwfContainers::DwfSpscQueue<int> testQueue(queue_size);
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty at init", testQueue.empty());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue size should be 0 at init", static_cast<size_t>(0u), testQueue.size());
+    CPPUNIT_ASSERT_MESSAGE("Queue should not be full at init", !testQueue.full());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(size_t i=1u; i<=queue_size; ++i)
+    {
+        testQueue.push(static_cast<int>(i));
+        CPPUNIT_ASSERT_MESSAGE("Queue should not be empty after push", !testQueue.empty());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue size should increase", i, testQueue.size());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should be full only when size limit is reached", i == queue_size, testQueue.full());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Pop                               ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(size_t i=queue_size; i>=1u; --i)
+    {
+        int popped = 0;
+        testQueue.pop(popped);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue size should decrease", i-1u, testQueue.size());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should be empty only when all elements are popped", i == 1u, testQueue.empty());
+        CPPUNIT_ASSERT_MESSAGE("Queue should not be full after pop", !testQueue.full());
+    }
+}
+
+void DwfSpscQueueTest::testPushPopCopy()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue<int> testQueue(3u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           1 : Push and Pop                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    int next_pushed = 0;
+    int next_popped = 0;
+    for(int loop=0; loop<10; ++loop)
+    {
+        for(int i=0; i<3; ++i)
+        {
+            testQueue.push(next_pushed);
+            ++next_pushed;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        ///                                                                    ///
+        ///                           2 : Check order                          ///
+        ///                                                                    ///
+        //////////////////////////////////////////////////////////////////////////
+        for(int i=0; i<3; ++i)
+        {
+            int popped = -1;
+            testQueue.pop(popped);
+            CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", next_popped, popped);
+            ++next_popped;
+        }
+    }
+}
+
+void DwfSpscQueueTest::testPushPopMoveFull()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const int queue_size = 4;
+    DwfContainers::DwfSpscQueue< std::unique_ptr<int> > testQueue(queue_size);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<queue_size; ++i)
+    {
+        std::unique_ptr<int> element(new int(i));
+        testQueue.push(std::move(element));
+        CPPUNIT_ASSERT_MESSAGE("Element should be moved", element == nullptr);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Push on full                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> element(new int(42));
+    CPPUNIT_ASSERT_THROW_MESSAGE("Pushing on full queue should raise an exception", testQueue.push(std::move(element)), std::runtime_error);
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if queue is full", element != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Pop and Push                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> popped;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("First element should be popped", 0, *popped);
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("Pushing after pop should be possible", testQueue.push(std::move(element)));
+    for(int i=1; i<queue_size; ++i)
+    {
+        testQueue.pop(popped);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", i, *popped);
+    }
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Last pushed element should be popped last", 42, *popped);
+}
+
+void DwfSpscQueueTest::testWaitManagement()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue<int> testQueue(8u);
+    std::atomic<bool> first_pop_done(false);
+    std::atomic<bool> second_pop_done(false);
+    std::atomic<bool> wait_enabled(false);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       1 : Spawn popper thread                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    int first_popped = 21;
+    int second_popped = 21;
+    std::thread readingThread([&]()
+    {
+        testQueue.pop(first_popped); // Blocking until wait is disabled
+        first_pop_done = true;
+        while(!wait_enabled)
+        {
+            std::this_thread::yield();
+        }
+        testQueue.pop(second_popped); // Blocking until an element is pushed
+        second_pop_done = true;
+    });
+    std::this_thread::sleep_for (std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_MESSAGE("Pop should block while queue is empty", !first_pop_done);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Disable Waiting                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.disableWait();
+    std::this_thread::sleep_for (std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_MESSAGE("Pop should exit when wait is disabled", first_pop_done);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Popped element should not be modified if no elements are received in queue", 21, first_popped);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          3 : Enable Waiting                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.enableWait();
+    wait_enabled = true;
+    std::this_thread::sleep_for (std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_MESSAGE("Pop should block again once wait is enabled", !second_pop_done);
+    testQueue.push(47);
+    readingThread.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Blocking pop should exit only if element was pushed", 47, second_popped);
+}
+
+void DwfSpscQueueTest::testClear()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue< std::shared_ptr<int> > testQueue(4u);
+    std::shared_ptr<int> element(new int(12));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<3; ++i)
+    {
+        testQueue.push(element);
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should hold copies of element", 4l, element.use_count());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Clear                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.clear();
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty after clear", testQueue.empty());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cleared elements should be deleted", 1l, element.use_count());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Push and Pop                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(std::make_shared<int>(47));
+    std::shared_ptr<int> popped;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queue should be usable after clear", 47, *popped);
+}
+
+void DwfSpscQueueTest::testProducerConsumer()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue<uint32_t> testQueue(16u);
+    const uint32_t element_nb = 200000u;
+    uint32_t out_of_order_nb = 0u;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                      1 : Spawn consumer thread                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread readingThread([&]()
+    {
+        for(uint32_t expected=0u; expected<element_nb; ++expected)
+        {
+            uint32_t popped = element_nb;
+            testQueue.pop(popped);
+            if(popped != expected)
+            {
+                ++out_of_order_nb;
+            }
+        }
+    });
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(uint32_t i=0u; i<element_nb; ++i)
+    {
+        while(testQueue.full())
+        {
+            std::this_thread::yield();
+        }
+        testQueue.push(i);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Check order                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    readingThread.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All elements should be received in order", 0u, out_of_order_nb);
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty once all elements are popped", testQueue.empty());
+}
+
+void DwfSpscQueueTest::testPopUpTo()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue< std::unique_ptr<int> > testQueue(8u);
+    std::vector< std::unique_ptr<int> > popped;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<5; ++i)
+    {
+        testQueue.push(std::unique_ptr<int>(new int(i)));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            2 : Pop Up To                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Only requested number of elements should be popped", static_cast<size_t>(2u), testQueue.popUpTo(2u, popped));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Remaining elements should stay in queue", static_cast<size_t>(3u), testQueue.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              3 : Pop All                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All remaining elements should be popped", static_cast<size_t>(3u), testQueue.popAll(popped));
+    CPPUNIT_ASSERT_MESSAGE("Queue should be empty", testQueue.empty());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Popped elements should be appended", static_cast<size_t>(5u), popped.size());
+    for(int i=0; i<5; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", i, *popped[i]);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           4 : Blocking pop                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    popped.clear();
+    std::atomic<size_t> popped_nb(42u);
+    std::thread readingThread([&testQueue, &popped, &popped_nb]()
+    {
+        popped_nb = testQueue.popAll(popped);
+    });
+    std::this_thread::sleep_for (std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pop should block while queue is empty", static_cast<size_t>(42u), popped_nb.load());
+    testQueue.push(std::unique_ptr<int>(new int(47)));
+    readingThread.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pushed element should be popped", static_cast<size_t>(1u), popped_nb.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pushed element should be popped", 47, *popped[0]);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          5 : Disable wait                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.push(std::unique_ptr<int>(new int(12)));
+    testQueue.disableWait();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Nothing should be popped when wait is disabled", static_cast<size_t>(0u), testQueue.popUpTo(2u, popped));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Argument should not be modified when wait is disabled", static_cast<size_t>(1u), popped.size());
+}
+
+void DwfSpscQueueTest::testPushBatch()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue< std::unique_ptr<int> > testQueue(4u);
+    std::vector< std::unique_ptr<int> > batch;
+    testQueue.push(std::unique_ptr<int>(new int(0)));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           1 : Push batch                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=1; i<4; ++i)
+    {
+        batch.emplace_back(new int(i));
+    }
+    testQueue.pushBatch(batch);
+    CPPUNIT_ASSERT_MESSAGE("Batch should be cleared once pushed", batch.empty());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All elements should be in queue", static_cast<size_t>(4u), testQueue.size());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       2 : Push batch on full                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    batch.emplace_back(new int(42));
+    CPPUNIT_ASSERT_THROW_MESSAGE("Pushing batch on full queue should raise an exception", testQueue.pushBatch(batch), std::runtime_error);
+    CPPUNIT_ASSERT_MESSAGE("Batch should not be moved if queue is full", batch.size() == 1u && batch[0] != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Check order                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<4; ++i)
+    {
+        std::unique_ptr<int> popped;
+        testQueue.pop(popped);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", i, *popped);
+    }
+}
+
+void DwfSpscQueueTest::testTryPush()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue< std::unique_ptr<int> > testQueue(2u);
+    DwfContainers::DwfSpscQueue<int> copyQueue(1u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(int i=0; i<2; ++i)
+    {
+        std::unique_ptr<int> element(new int(i));
+        CPPUNIT_ASSERT_MESSAGE("Push on not full queue should succeed", DwfContainers::PushStatus::PUSHED == testQueue.tryPush(std::move(element)));
+        CPPUNIT_ASSERT_MESSAGE("Element should be moved", element == nullptr);
+    }
+    CPPUNIT_ASSERT_MESSAGE("Push on not full queue should succeed", DwfContainers::PushStatus::PUSHED == copyQueue.tryPush(12));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Push on full                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> element(new int(42));
+    CPPUNIT_ASSERT_MESSAGE("Push on full queue should report it", DwfContainers::PushStatus::FULL == testQueue.tryPush(std::move(element)));
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if queue is full", element != nullptr);
+    CPPUNIT_ASSERT_MESSAGE("Push on full queue should report it", DwfContainers::PushStatus::FULL == copyQueue.tryPush(13));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           3 : Pop and Push                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> popped;
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_MESSAGE("Push after pop should succeed", DwfContainers::PushStatus::PUSHED == testQueue.tryPush(std::move(element)));
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", 1, *popped);
+    testQueue.pop(popped);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Elements should be popped in push order", 42, *popped);
+}
+
+void DwfSpscQueueTest::testPushFor()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfContainers::DwfSpscQueue< std::unique_ptr<int> > testQueue(1u);
+    testQueue.push(std::unique_ptr<int>(new int(0)));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Push on full queue                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<int> element(new int(42));
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    CPPUNIT_ASSERT_MESSAGE("Push on queue staying full should time out", DwfContainers::PushStatus::TIMEOUT == testQueue.pushFor(std::move(element), std::chrono::milliseconds(50)));
+    CPPUNIT_ASSERT_MESSAGE("Push should wait for timeout", std::chrono::steady_clock::now() - start_time >= std::chrono::milliseconds(50));
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if push timed out", element != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Room is freed                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::thread popper([&testQueue]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        std::unique_ptr<int> popped;
+        testQueue.pop(popped);
+    });
+    CPPUNIT_ASSERT_MESSAGE("Push should succeed once room is freed", DwfContainers::PushStatus::PUSHED == testQueue.pushFor(std::move(element), std::chrono::seconds(5)));
+    CPPUNIT_ASSERT_MESSAGE("Element should be moved", element == nullptr);
+    popper.join();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         3 : Wait is disabled                       ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.disableWait();
+    element.reset(new int(12));
+    start_time = std::chrono::steady_clock::now();
+    CPPUNIT_ASSERT_MESSAGE("Push should not wait when wait is disabled", DwfContainers::PushStatus::TIMEOUT == testQueue.pushFor(std::move(element), std::chrono::seconds(5)));
+    CPPUNIT_ASSERT_MESSAGE("Push should not wait when wait is disabled", std::chrono::steady_clock::now() - start_time < std::chrono::seconds(1));
+    CPPUNIT_ASSERT_MESSAGE("Element should not be moved if push timed out", element != nullptr);
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
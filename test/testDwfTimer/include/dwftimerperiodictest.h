@@ -91,6 +91,8 @@ public:
         CPPUNIT_TEST(testDelete);
         CPPUNIT_TEST(testStartedConfigure);
         CPPUNIT_TEST(testPeriod);
+        CPPUNIT_TEST(testStopInTimeout);
+        CPPUNIT_TEST(testMissedDeadlines);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -168,6 +170,27 @@ public:
     *
     */
     void testPeriod();
+
+    /*!
+    * @brief Check timer can be stopped from its timeout function
+    *
+    * 0) Create a periodic timer whose timeout function stops it on third call.
+    * 1) Start it and let it run during some time.
+    * 2) Check it is stopped and executed three times.
+    *
+    */
+    void testStopInTimeout();
+
+    /*!
+    * @brief Check periodic timer keeps its deadlines and counts missed ones
+    *
+    * 0) Create a periodic timer skipping missed deadlines, whose timeout function overruns two deadlines on first call.
+    * 1) Let it run during some time. Check it executed the required number of times, with no delay accumulated.
+    * 2) Stop it. Check missed deadlines are counted and kept once stopped.
+    * 3) Restart it. Check missed deadlines count is reset.
+    *
+    */
+    void testMissedDeadlines();
 };
 
 #endif // DWF_TIMER_PERIODIC_TEST_H
@@ -87,6 +87,8 @@ class DwfTimerStaticTimersTest : public CPPUNIT_NS::TestFixture
 public:
     CPPUNIT_TEST_SUITE(DwfTimerStaticTimersTest);
         CPPUNIT_TEST(testStaticSingleShot);
+        CPPUNIT_TEST(testCancelSingleShot);
+        CPPUNIT_TEST(testManySingleShots);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -126,10 +128,30 @@ public:
     * @brief Check startSingleShot behavior
     *
     * 0) Start time measurement.
-    * 1) Start timer for 2 seconds and check elapsed time is approximately this.
+    * 1) Start timer for 2 seconds and check it returns before timeout.
+    * 2) Wait for timeout and check elapsed time is approximately 2 seconds.
     *
     */
     void testStaticSingleShot();
+
+    /*!
+    * @brief Check single shot timers can be cancelled through their handle
+    *
+    * 0) Check a default handle cancels nothing.
+    * 1) Start a timer, cancel it and check function is not called.
+    * 2) Check handle of a timer whose function was called no longer cancels anything.
+    *
+    */
+    void testCancelSingleShot();
+
+    /*!
+    * @brief Check many single shot timers can be started without blocking caller
+    *
+    * 0) Start 10000 single shot timers of 500 ms and check they are all started before the first timeout.
+    * 1) Check every function is called once.
+    *
+    */
+    void testManySingleShots();
 };
 
 #endif // DWF_TIMER_STATIC_TIMERS_TEST_H
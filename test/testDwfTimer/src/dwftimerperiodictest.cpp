@@ -269,6 +269,92 @@ void DwfTimerPeriodicTest::testPeriod()
     CPPUNIT_ASSERT_MESSAGE("Number of timeout function execution should be right", (79u <= called) && (called <= 81u));
 }
 
+void DwfTimerPeriodicTest::testStopInTimeout()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic<uint32_t> called(0u); // Number of calls to timeout method
+
+    DwfTime::DwfTimer timer;
+    timer.setSingleShot(false);
+    timer.setPeriod(std::chrono::milliseconds(20));
+    timer.callOnTimeout([&called, &timer]
+    {
+        if(++called == 3u)
+        {
+            timer.stop(); // Must not wait for itself
+        }
+    });
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           1 : Start timer                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    timer.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200)); // Wait about 10 timer periods
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                   2 : Check timer stopped itself                   ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timer should not be started", false, timer.isStarted());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timeout function should not be called once timer is stopped", 3u, called.load());
+}
+
+void DwfTimerPeriodicTest::testMissedDeadlines()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic<uint32_t> called(0u); // Number of calls to timeout method
+
+    DwfTime::DwfTimer timer;
+    timer.setSingleShot(false);
+    timer.setPeriod(std::chrono::milliseconds(40));
+    timer.setOverrunPolicy(DwfTime::OverrunPolicy::SKIP);
+    timer.callOnTimeout([&called]
+    {
+        if(++called == 1u)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Deadlines at 2 and 3 periods pass meanwhile
+        }
+    });
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           1 : Run timer                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    timer.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1020)); // Deadlines at 1 and 4 to 25 periods
+    CPPUNIT_ASSERT_MESSAGE("Number of timeout function execution should be right", (22u <= called) && (called <= 24u));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           2 : Stop timer                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Missed deadlines should be counted", static_cast<uint64_t>(2u), timer.missedDeadlineNb());
+    timer.stop();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Missed deadlines should be kept once stopped", static_cast<uint64_t>(2u), timer.missedDeadlineNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         3 : Restart timer                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    timer.start();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Missed deadlines should be reset on start", static_cast<uint64_t>(0u), timer.missedDeadlineNb());
+    timer.stop();
+}
+
 //  ______________________________
 // |                              |
 // |    ______________________    |
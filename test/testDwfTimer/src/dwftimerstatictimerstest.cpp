@@ -72,6 +72,9 @@ If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
 
 #include "dwftimerstatictimerstest.h"
 #include "dwftimer.h"
+#include <atomic>
+#include <memory>
+#include <thread>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(DwfTimerStaticTimersTest);
 
@@ -104,22 +107,30 @@ public:
     * Inits reference point for elapsed time measurement
     *
     */
-    TimeDelta(std::chrono::seconds timer_duration) : m_start_time(std::chrono::steady_clock::now()), m_timer_duration(timer_duration), m_called(false)
+    TimeDelta() : m_start_time(std::chrono::steady_clock::now()), m_elapsed(0), m_called(false)
     {
     }
 
     /*!
-    * @brief Check elapsed time
+    * @brief Measure elapsed time
     *
-    * Test that elapsed time since object construction is equal to expected timer duration.
+    * Store elapsed time since object construction. Called by a timer worker, so that check is left to test thread.
     *
     */
     void operator()()
     {
-        std::chrono::seconds elapsed=std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now()-m_start_time);
-        m_called=true;
+        m_elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now()-m_start_time).count();
+        m_called = true;
+    }
 
-        CPPUNIT_ASSERT_EQUAL_MESSAGE("Timer duration does not match expected duration", m_timer_duration.count(), elapsed.count());
+    /*!
+    * @brief Get elapsed time between object construction and call
+    * @return Elapsed time in seconds
+    *
+    */
+    std::chrono::seconds elapsed() const
+    {
+        return std::chrono::seconds(m_elapsed);
     }
 
     /*!
@@ -134,8 +145,8 @@ public:
 
 private:
     std::chrono::steady_clock::time_point m_start_time; /*!< Start time for duration measurement.*/
-    std::chrono::seconds m_timer_duration; /*!< Expected timer duration in seconds.*/
-    bool m_called; /*!< Flag indicating that operator() method has been called.*/
+    std::atomic<int64_t> m_elapsed; /*!< Elapsed time between construction and call in seconds.*/
+    std::atomic<bool> m_called; /*!< Flag indicating that operator() method has been called.*/
 };
 
 void DwfTimerStaticTimersTest::testStaticSingleShot()
@@ -146,7 +157,7 @@ void DwfTimerStaticTimersTest::testStaticSingleShot()
     ///                                                                    ///
     //////////////////////////////////////////////////////////////////////////
     std::chrono::seconds timer_duration(2);
-    TimeDelta delta(timer_duration);
+    TimeDelta delta;
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Duration measurement not done", false, delta.wasCalled());
 
     //////////////////////////////////////////////////////////////////////////
@@ -154,8 +165,85 @@ void DwfTimerStaticTimersTest::testStaticSingleShot()
     ///                           1 : Start Timer                          ///
     ///                                                                    ///
     //////////////////////////////////////////////////////////////////////////
-    DwfTime::DwfTimer::startSingleShot(timer_duration, std::ref(delta)); // Pass functor as ref to update member
+    DwfTime::DwfTimerHandle handle = DwfTime::DwfTimer::startSingleShot(timer_duration, std::ref(delta)); // Pass functor as ref to update member
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Start should not wait for timeout", false, delta.wasCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timeout should be pending", true, handle.isPending());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          2 : Wait Timeout                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for(timer_duration + std::chrono::milliseconds(500));
     CPPUNIT_ASSERT_EQUAL_MESSAGE("Duration measurement done", true, delta.wasCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timer duration does not match expected duration", timer_duration.count(), delta.elapsed().count());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timeout should no longer be pending", false, handle.isPending());
+}
+
+void DwfTimerStaticTimersTest::testCancelSingleShot()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         0 : Default handle                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfTime::DwfTimerHandle handle;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Default handle should not be pending", false, handle.isPending());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Default handle should cancel nothing", false, handle.cancel());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                      1 : Cancel pending timer                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic<bool> called(false);
+    handle = DwfTime::DwfTimer::startSingleShot(std::chrono::milliseconds(100), [&called]{called = true;});
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pending timer should be cancelled", true, handle.cancel());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancelled timer should not be pending", false, handle.isPending());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancelled timer should not call its function", false, called.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timer should not be cancelled twice", false, handle.cancel());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                      2 : Cancel after timeout                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    handle = DwfTime::DwfTimer::startSingleShot(std::chrono::milliseconds(20), [&called]{called = true;});
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timer function should be called", true, called.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Timer should not be cancelled after timeout", false, handle.cancel());
+}
+
+void DwfTimerStaticTimersTest::testManySingleShots()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Start timers                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t timer_nb = 10000u;
+    const std::chrono::milliseconds timer_duration(500);
+    std::unique_ptr< std::atomic<uint32_t>[] > called(new std::atomic<uint32_t>[timer_nb]);
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(size_t i = 0u; i < timer_nb; ++i)
+    {
+        called[i] = 0u;
+        std::atomic<uint32_t>& timer_called = called[i];
+        DwfTime::DwfTimer::startSingleShot(timer_duration, [&timer_called]{++timer_called;});
+    }
+    CPPUNIT_ASSERT_MESSAGE("Timers should be started without waiting for timeouts", std::chrono::steady_clock::now() - start_time < timer_duration);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Check calls                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for(timer_duration * 3);
+    for(size_t i = 0u; i < timer_nb; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Every timer function should be called once", 1u, called[i].load());
+    }
 }
 
 //  ______________________________
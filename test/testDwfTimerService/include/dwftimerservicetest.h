@@ -0,0 +1,247 @@
+/*!
+ * @file dwftimerservicetest.h
+ * @brief Unit tests of DwfTimerService class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfTimerService class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef DWF_TIMER_SERVICE_TEST_H
+#define DWF_TIMER_SERVICE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class DwfTimerServiceTest
+* @brief Unit tests of DwfTimerService class
+*
+* Inherits from TestFixture
+*
+*/
+class DwfTimerServiceTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(DwfTimerServiceTest);
+        CPPUNIT_TEST(testSingleShot);
+        CPPUNIT_TEST(testPeriodic);
+        CPPUNIT_TEST(testDeadlineOrder);
+        CPPUNIT_TEST(testCancel);
+        CPPUNIT_TEST(testOverrunPolicy);
+        CPPUNIT_TEST(testArm);
+        CPPUNIT_TEST(testTimerFdBackend);
+        CPPUNIT_TEST(testManyTimers);
+        CPPUNIT_TEST(testLongTask);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the DwfTimerServiceTest class
+    *
+    * Does nothing.
+    *
+    */
+    DwfTimerServiceTest();
+
+    /*!
+    * @brief Desctructor of the DwfTimerServiceTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~DwfTimerServiceTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check single shot tasks are called once at their deadline
+    *
+    * 0) Schedule a single shot task. Check it is counted as scheduled.
+    * 1) Wait for it. Check it is called once, not before its deadline, and removed once called.
+    *
+    */
+    void testSingleShot();
+
+    /*!
+    * @brief Check periodic tasks are called until cancelled
+    *
+    * 0) Schedule a periodic task and let it run during some time. Check it is called the required number of times.
+    * 1) Cancel it. Check it is not called anymore.
+    *
+    */
+    void testPeriodic();
+
+    /*!
+    * @brief Check tasks are called in deadline order whatever their scheduling order
+    *
+    * 0) Schedule tasks on a single worker with deadlines in reverse order.
+    * 1) Check they are called in deadline order.
+    * 2) Schedule a task earlier than the deadline the worker waits for. Check it is called first.
+    *
+    */
+    void testDeadlineOrder();
+
+    /*!
+    * @brief Check cancellation of tasks
+    *
+    * 0) Cancel a pending task. Check it is never called and cannot be cancelled twice.
+    * 1) Cancel a running task. Check cancel waits for task function to return.
+    * 2) Cancel a periodic task from its own function. Check cancel returns and task is not called anymore.
+    *
+    */
+    void testCancel();
+
+    /*!
+    * @brief Check periodic tasks follow their overrun policy when their function overruns
+    *
+    * 0) Schedule a periodic task per overrun policy, whose function overruns two deadlines on second call.
+    * 1) Check SKIP calls task on the next deadline to come, CATCH_UP calls missed deadlines immediately and FIRE_IMMEDIATELY calls task once immediately then one period later.
+    * 2) Check two missed deadlines are counted whatever the policy.
+    *
+    */
+    void testOverrunPolicy();
+
+    /*!
+    * @brief Check persistent tasks can be armed, re-armed and disarmed
+    *
+    * 0) Create a task and check it is not called until armed.
+    * 1) Arm it, re-arm it before deadline and check it is called once, on latest deadline, and kept once called.
+    * 2) Arm it periodically then disarm it and check it is no longer called.
+    * 3) Re-arm it from its own function.
+    * 4) Arm it while its function runs and check arm waits for function to return.
+    * 5) Cancel it and check it can no longer be armed.
+    *
+    */
+    void testArm();
+
+    /*!
+    * @brief Check timerfd backend
+    *
+    * 0) Create a service with timerfd backend. Schedule a single shot task and check it is called on time.
+    * 1) Schedule a late task then an earlier one while a worker waits. Check earlier task is called first, on time.
+    * 2) Run a 1 kHz periodic DwfTimer on timerfd backend and check number of calls.
+    * 3) Destroy service while it waits for a far deadline and check destruction does not wait for it.
+    *
+    */
+    void testTimerFdBackend();
+
+    /*!
+    * @brief Check many timers are serviced by the shared workers
+    *
+    * 0) Start 1000 periodic DwfTimer and let them run during some time.
+    * 1) Check every timer is called the required number of times and all tasks are removed once timers are stopped.
+    *
+    */
+    void testManyTimers();
+
+    /*!
+    * @brief Check a long task does not delay other timeouts while a worker is free
+    *
+    * For each backend :
+    * 0) Create a service with 2 workers. Schedule a task running 1 s then a later short task, while workers wait for an empty heap.
+    * 1) Check short task is called on time by the other worker.
+    *
+    */
+    void testLongTask();
+};
+
+#endif // DWF_TIMER_SERVICE_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
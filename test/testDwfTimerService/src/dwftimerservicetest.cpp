@@ -0,0 +1,604 @@
+/*!
+ * @file dwftimerservicetest.cpp
+ * @brief Unit tests of DwfTimerService class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of DwfTimerService class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "dwftimerservicetest.h"
+#include "dwftimerservice.h"
+#include "dwftimer.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(DwfTimerServiceTest);
+
+DwfTimerServiceTest::DwfTimerServiceTest()
+{
+}
+
+DwfTimerServiceTest::~DwfTimerServiceTest()
+{
+}
+
+void DwfTimerServiceTest::setUp()
+{
+}
+
+void DwfTimerServiceTest::tearDown()
+{
+}
+
+void DwfTimerServiceTest::testSingleShot()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         0 : Schedule task                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfTime::DwfTimerService service(2u);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Service should have requested number of workers", static_cast<size_t>(2u), service.workerNb());
+    std::atomic<uint32_t> called(0u);
+    std::atomic<bool> early(false);
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+    service.schedule(deadline, [&called, &early, deadline]
+    {
+        early = std::chrono::steady_clock::now() < deadline;
+        ++called;
+    });
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be scheduled", static_cast<size_t>(1u), service.taskNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Wait for task                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be called once", 1u, called.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should not be called before its deadline", false, early.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be removed once called", static_cast<size_t>(0u), service.taskNb());
+}
+
+void DwfTimerServiceTest::testPeriodic()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         0 : Periodic calls                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfTime::DwfTimerService service(2u);
+    std::atomic<uint32_t> called(0u);
+    DwfTime::DwfTimerService::TaskID task = service.schedulePeriodic(std::chrono::steady_clock::now() + std::chrono::milliseconds(50), std::chrono::milliseconds(50), DwfTime::OverrunPolicy::FIRE_IMMEDIATELY, [&called]{++called;});
+    std::this_thread::sleep_for(std::chrono::milliseconds(1025)); // Wait about 20 periods
+
+    // Number of executions should be 20. Yet we do not control precisely the time when cancel is called compared to calls so we add a margin to make sure test passes.
+    const uint32_t called_nb = called;
+    CPPUNIT_ASSERT_MESSAGE("Number of task function execution should be right", (19u <= called_nb) && (called_nb <= 21u));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Cancel task                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Scheduled task should be cancelled", true, service.cancel(task));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be removed once cancelled", static_cast<size_t>(0u), service.taskNb());
+    const uint32_t cancelled_nb = called;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancelled task should not be called", cancelled_nb, called.load());
+}
+
+void DwfTimerServiceTest::testDeadlineOrder()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         0 : Reverse order                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfTime::DwfTimerService service(1u);
+    std::mutex order_mutex;
+    std::vector<uint32_t> order;
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    for(uint32_t i = 5u; i > 0u; --i)
+    {
+        service.schedule(start_time + std::chrono::milliseconds(20u * i), [&order_mutex, &order, i]
+        {
+            std::lock_guard<std::mutex> lock(order_mutex);
+            order.push_back(i);
+        });
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Check order                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Every task should be called", static_cast<size_t>(5u), order.size());
+        for(uint32_t i = 0u; i < 5u; ++i)
+        {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE("Tasks should be called in deadline order", i + 1u, order[i]);
+        }
+        order.clear();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        2 : Earlier deadline                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    service.schedule(std::chrono::steady_clock::now() + std::chrono::milliseconds(500), [&order_mutex, &order]
+    {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        order.push_back(2u);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // Let worker wait for first deadline
+    const std::chrono::steady_clock::time_point schedule_time = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point call_time;
+    service.schedule(schedule_time + std::chrono::milliseconds(50), [&order_mutex, &order, &call_time]
+    {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        call_time = std::chrono::steady_clock::now();
+        order.push_back(1u);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    std::lock_guard<std::mutex> lock(order_mutex);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Every task should be called", static_cast<size_t>(2u), order.size());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Earlier task should be called first", 1u, order[0]);
+    CPPUNIT_ASSERT_MESSAGE("Earlier task should be called on its deadline", call_time - schedule_time < std::chrono::milliseconds(200));
+}
+
+void DwfTimerServiceTest::testCancel()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Pending task                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfTime::DwfTimerService service(2u);
+    std::atomic<uint32_t> called(0u);
+    DwfTime::DwfTimerService::TaskID task = service.schedule(std::chrono::steady_clock::now() + std::chrono::milliseconds(50), [&called]{++called;});
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Pending task should be cancelled", true, service.cancel(task));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should not be cancelled twice", false, service.cancel(task));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Unknown task should not be cancelled", false, service.cancel(DwfTime::DwfTimerService::C_NO_TASK));
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancelled task should not be called", 0u, called.load());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Running task                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic<bool> running(false);
+    std::atomic<bool> returned(false);
+    task = service.schedule(std::chrono::steady_clock::now(), [&running, &returned]
+    {
+        running = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        returned = true;
+    });
+    while(!running)
+    {
+        std::this_thread::yield();
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Running task should be cancelled", true, service.cancel(task));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancel should wait for task function to return", true, returned.load());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        2 : Cancel from task                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    called = 0u;
+    std::atomic<DwfTime::DwfTimerService::TaskID> self_task(DwfTime::DwfTimerService::C_NO_TASK);
+    std::atomic<bool> cancelled(false);
+    self_task = service.schedulePeriodic(std::chrono::steady_clock::now() + std::chrono::milliseconds(20), std::chrono::milliseconds(20), DwfTime::OverrunPolicy::FIRE_IMMEDIATELY, [&service, &self_task, &called, &cancelled]
+    {
+        if(++called == 3u)
+        {
+            cancelled = service.cancel(self_task); // Must not wait for itself
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should cancel itself", true, cancelled.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should not be called once cancelled", 3u, called.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be removed once cancelled", static_cast<size_t>(0u), service.taskNb());
+}
+
+void DwfTimerServiceTest::testManyTimers()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Start timers                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t timer_nb = 1000u;
+    std::vector< std::unique_ptr<DwfTime::DwfTimer> > timers;
+    std::unique_ptr< std::atomic<uint32_t>[] > called(new std::atomic<uint32_t>[timer_nb]);
+    for(size_t i = 0u; i < timer_nb; ++i)
+    {
+        called[i] = 0u;
+        timers.emplace_back(new DwfTime::DwfTimer());
+        timers.back()->setSingleShot(false);
+        timers.back()->setPeriod(std::chrono::milliseconds(100));
+        std::atomic<uint32_t>& timer_called = called[i];
+        timers.back()->callOnTimeout([&timer_called]{++timer_called;});
+    }
+    for(std::unique_ptr<DwfTime::DwfTimer>& timer : timers)
+    {
+        timer->start();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1050)); // Wait about 10 periods
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Check calls                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(std::unique_ptr<DwfTime::DwfTimer>& timer : timers)
+    {
+        timer->stop();
+    }
+    for(size_t i = 0u; i < timer_nb; ++i)
+    {
+        // Number of executions should be 10. Yet timers are started and stopped one after the other so we add a margin to make sure test passes.
+        CPPUNIT_ASSERT_MESSAGE("Number of timeout function execution should be right", (9u <= called[i]) && (called[i] <= 11u));
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Stopped timers should not have tasks", static_cast<size_t>(0u), DwfTime::DwfTimerService::instance().taskNb());
+}
+
+void DwfTimerServiceTest::testOverrunPolicy()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       0 : Overrunning tasks                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const std::chrono::milliseconds period(40);
+    DwfTime::DwfTimerService service(3u); // A worker per task so that tasks do not delay each other
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    const std::vector<DwfTime::OverrunPolicy> policies = {DwfTime::OverrunPolicy::SKIP, DwfTime::OverrunPolicy::CATCH_UP, DwfTime::OverrunPolicy::FIRE_IMMEDIATELY};
+    std::mutex call_mutex;
+    std::vector< std::vector<std::chrono::milliseconds> > call_times(policies.size()); // Call times relative to start time
+    std::vector<DwfTime::DwfTimerService::TaskID> tasks;
+    for(size_t i = 0u; i < policies.size(); ++i)
+    {
+        std::vector<std::chrono::milliseconds>& task_call_times = call_times[i];
+        tasks.push_back(service.schedulePeriodic(start_time + period, period, policies[i], [&call_mutex, &task_call_times, start_time, period]
+        {
+            size_t call_nb = 0u;
+            {
+                std::lock_guard<std::mutex> lock(call_mutex);
+                task_call_times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time));
+                call_nb = task_call_times.size();
+            }
+            if(call_nb == 2u) // Deadlines at 3 and 4 periods pass meanwhile
+            {
+                std::this_thread::sleep_for(period * 5 / 2);
+            }
+        }));
+    }
+    std::this_thread::sleep_for(period * 7);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Check calls                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<uint64_t> missed_deadline_nbs;
+    for(DwfTime::DwfTimerService::TaskID task : tasks)
+    {
+        missed_deadline_nbs.push_back(service.missedDeadlineNb(task));
+        service.cancel(task);
+    }
+    std::lock_guard<std::mutex> lock(call_mutex);
+    for(const std::vector<std::chrono::milliseconds>& task_call_times : call_times)
+    {
+        CPPUNIT_ASSERT_MESSAGE("Tasks should be called at least 4 times", task_call_times.size() >= 4u);
+    }
+    // Second call returns at about 4.5 periods
+    CPPUNIT_ASSERT_MESSAGE("SKIP should call task on the next deadline to come", call_times[0][2] >= period * 5);
+    CPPUNIT_ASSERT_MESSAGE("CATCH_UP should call first missed deadline immediately", call_times[1][2] < period * 5);
+    CPPUNIT_ASSERT_MESSAGE("CATCH_UP should call second missed deadline immediately", call_times[1][3] < period * 5);
+    CPPUNIT_ASSERT_MESSAGE("FIRE_IMMEDIATELY should call task once immediately", call_times[2][2] < period * 5);
+    CPPUNIT_ASSERT_MESSAGE("FIRE_IMMEDIATELY should count next deadline from immediate call", call_times[2][3] - call_times[2][2] >= period - std::chrono::milliseconds(5));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     2 : Check missed deadlines                     ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    for(uint64_t missed_deadline_nb : missed_deadline_nbs)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Missed deadlines should be counted once", static_cast<uint64_t>(2u), missed_deadline_nb);
+    }
+}
+
+void DwfTimerServiceTest::testArm()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Create task                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    DwfTime::DwfTimerService service(2u);
+    std::atomic<uint32_t> called(0u);
+    std::atomic<int> behavior(0); // 0 : count calls, 1 : re-arm twice, 2 : block
+    std::atomic<bool> running(false);
+    std::atomic<bool> returned(false);
+    DwfTime::DwfTimerService::TaskID task = DwfTime::DwfTimerService::C_NO_TASK;
+    task = service.createTask([&service, &task, &called, &behavior, &running, &returned]
+    {
+        const uint32_t call_nb = ++called;
+        if(behavior == 1 && call_nb < 3u)
+        {
+            service.arm(task, std::chrono::steady_clock::now() + std::chrono::milliseconds(10)); // Must not wait for itself
+        }
+        else if(behavior == 2)
+        {
+            running = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            returned = true;
+        }
+    });
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Created task should not be armed", static_cast<size_t>(0u), service.taskNb());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Created task should not be called", 0u, called.load());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Arm and re-arm                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be armed", true, service.arm(task, start_time + std::chrono::milliseconds(30)));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Armed task should be counted", static_cast<size_t>(1u), service.taskNb());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be re-armed", true, service.arm(task, start_time + std::chrono::milliseconds(100)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Re-armed task should not be called on previous deadline", 0u, called.load());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Re-armed task should be called once", 1u, called.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Called task should be disarmed", static_cast<size_t>(0u), service.taskNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                  2 : Arm periodically then disarm                  ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    called = 0u;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be kept once called", true, service.armPeriodic(task, std::chrono::steady_clock::now() + std::chrono::milliseconds(20), std::chrono::milliseconds(20), DwfTime::OverrunPolicy::FIRE_IMMEDIATELY));
+    std::this_thread::sleep_for(std::chrono::milliseconds(110));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be disarmed", true, service.disarm(task));
+    const uint32_t call_nb = called;
+    CPPUNIT_ASSERT_MESSAGE("Periodic task should be called several times", call_nb >= 3u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Disarmed task should not be called", call_nb, called.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Disarmed task should not be counted", static_cast<size_t>(0u), service.taskNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        3 : Re-arm from task                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    called = 0u;
+    behavior = 1;
+    service.arm(task, std::chrono::steady_clock::now());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be called until it no longer re-arms itself", 3u, called.load());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       4 : Arm while running                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    behavior = 2;
+    service.arm(task, std::chrono::steady_clock::now());
+    while(!running)
+    {
+        std::this_thread::yield();
+    }
+    behavior = 0;
+    service.arm(task, std::chrono::steady_clock::now() + std::chrono::seconds(10));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Arm should wait for task function to return", true, returned.load());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          5 : Cancel task                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Task should be cancelled", true, service.cancel(task));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancelled task should not be armed", false, service.arm(task, std::chrono::steady_clock::now()));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancelled task should not be disarmed", false, service.disarm(task));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Cancelled task should not be counted", static_cast<size_t>(0u), service.taskNb());
+}
+
+void DwfTimerServiceTest::testTimerFdBackend()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          0 : Single shot                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<DwfTime::DwfTimerService> service(new DwfTime::DwfTimerService(2u, DwfTime::TimerBackend::TIMERFD));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Service should use timerfd backend", true, service->backend() == DwfTime::TimerBackend::TIMERFD);
+    std::atomic<int64_t> call_delay_us(-1);
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(50);
+    service->schedule(deadline, [&call_delay_us, deadline]{call_delay_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - deadline).count();});
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    CPPUNIT_ASSERT_MESSAGE("Task should be called on deadline", call_delay_us >= 0 && call_delay_us < 20000);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        1 : Earlier deadline                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic<uint32_t> early_called(0u);
+    std::atomic<uint32_t> late_called(0u);
+    const DwfTime::DwfTimerService::TaskID late_task = service->schedule(std::chrono::steady_clock::now() + std::chrono::seconds(10), [&late_called]{++late_called;});
+    std::this_thread::sleep_for(std::chrono::milliseconds(20)); // A worker waits for late deadline
+    call_delay_us = -1;
+    deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(30);
+    service->schedule(deadline, [&call_delay_us, &early_called, deadline]
+    {
+        call_delay_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - deadline).count();
+        ++early_called;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(130));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Earlier task should be called", 1u, early_called.load());
+    CPPUNIT_ASSERT_MESSAGE("Earlier task should be called on its deadline", call_delay_us >= 0 && call_delay_us < 20000);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Late task should not be called", 0u, late_called.load());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Late task should be cancelled", true, service->cancel(late_task));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Periodic timer                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::atomic<uint32_t> tick_nb(0u);
+    {
+        DwfTime::DwfTimer timer(DwfTime::TimerBackend::TIMERFD);
+        timer.setSingleShot(false);
+        timer.setPeriod(std::chrono::milliseconds(1));
+        timer.callOnTimeout([&tick_nb]{++tick_nb;});
+        timer.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        timer.stop();
+    }
+    CPPUNIT_ASSERT_MESSAGE("1 kHz timer should be called about 300 times", tick_nb >= 200u && tick_nb <= 305u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          3 : Destruction                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    service->schedule(std::chrono::steady_clock::now() + std::chrono::seconds(10), []{});
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const std::chrono::steady_clock::time_point destruction_start = std::chrono::steady_clock::now();
+    service.reset();
+    CPPUNIT_ASSERT_MESSAGE("Destruction should not wait for pending deadlines", std::chrono::steady_clock::now() - destruction_start < std::chrono::milliseconds(500));
+}
+
+void DwfTimerServiceTest::testLongTask()
+{
+    std::vector<DwfTime::TimerBackend> backends({DwfTime::TimerBackend::CONDITION_VARIABLE});
+#ifdef __linux__
+    backends.push_back(DwfTime::TimerBackend::TIMERFD);
+#endif
+    for(DwfTime::TimerBackend backend : backends)
+    {
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            0 : Schedule                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+        DwfTime::DwfTimerService service(2u, backend);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20)); // Let workers wait for an empty heap
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::atomic<int64_t> short_delay_ms(-1);
+        service.schedule(start + std::chrono::milliseconds(50), []{std::this_thread::sleep_for(std::chrono::seconds(1));});
+        service.schedule(start + std::chrono::milliseconds(100), [&start, &short_delay_ms]
+        {
+            short_delay_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        });
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                        1 : Check short task                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        CPPUNIT_ASSERT_MESSAGE("Short task should be called on time by free worker", (100 <= short_delay_ms.load()) && (short_delay_ms.load() <= 200));
+    }
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,205 @@
+/*!
+ * @file flatstatemachinetest.h
+ * @brief Unit tests of FlatStateMachine class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of FlatStateMachine class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef FLAT_STATE_MACHINE_TEST_H
+#define FLAT_STATE_MACHINE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class FlatStateMachineTest
+* @brief Unit tests of FlatStateMachine class
+*
+* Inherits from TestFixture
+*
+*/
+class FlatStateMachineTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(FlatStateMachineTest);
+        CPPUNIT_TEST(testDeadEndState);
+        CPPUNIT_TEST(testEmptyTransitionMap);
+        CPPUNIT_TEST(testTransitions);
+        CPPUNIT_TEST(testTableSizeLimit);
+        CPPUNIT_TEST(testSameBehaviorAsAbstractStateMachine);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the FlatStateMachineTest class
+    *
+    * Does nothing.
+    *
+    */
+    FlatStateMachineTest();
+
+    /*!
+    * @brief Desctructor of the FlatStateMachineTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~FlatStateMachineTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check behavior when reaching a state without transition map
+    *
+    * 0) Create TestFlatStateMachine.
+    * 1) Start event processing.
+    * 2) Push event to go to dead end state D.
+    * 3) Push events on dead end state, including events with IDs out of transition table.
+    * 4) Check onDeadEndState calls and reported reason.
+    *
+    */
+    void testDeadEndState();
+
+    /*!
+    * @brief Check behavior when reaching a state with an empty transition map
+    *
+    * 0) Create TestFlatStateMachine and start it.
+    * 1) Push event to go to state E.
+    * 2) Push events on this state.
+    * 3) Check events were ignored without calling onDeadEndState.
+    *
+    */
+    void testEmptyTransitionMap();
+
+    /*!
+    * @brief Check transition behavior
+    *
+    * 0) Create TestFlatStateMachine and start it.
+    * 1) Run transitions A->B->A->C a few times
+    * 2) Check transitions counter
+    * 3) Events not trigerring transition, inside and outside of transition table. Check counters are the same.
+    *
+    */
+    void testTransitions();
+
+    /*!
+    * @brief Check transition table size limitation
+    *
+    * 0) Create TestFlatStateMachine with a very high event ID.
+    * 1) Check setupAndStart throws std::length_error.
+    *
+    */
+    void testTableSizeLimit();
+
+    /*!
+    * @brief Check FlatStateMachine dispatches events as AbstractStateMachine does
+    *
+    * 0) Create a MirrorStateMachine of each kind from the same transition map.
+    * 1) Dispatch a sequence of events ending in the state with an empty transition map. Check both machines go through the same states and report the same dead ends.
+    * 2) Dispatch a sequence of events ending in the state without transition map. Check both machines go through the same states and report the same dead ends.
+    *
+    */
+    void testSameBehaviorAsAbstractStateMachine();
+};
+
+#endif // FLAT_STATE_MACHINE_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,217 @@
+/*!
+ * @file mirrorstatemachine.h
+ * @brief Class used to compare FlatStateMachine and AbstractStateMachine.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class template deriving from FlatStateMachine or AbstractStateMachine with the same transition map, used to compare their dispatch.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef MIRROR_STATE_MACHINE_H
+#define MIRROR_STATE_MACHINE_H
+
+#include "abstractstatemachine.h"
+#include "flatstatemachine.h"
+
+/*! @class MirrorStateMachine
+* @brief Class used to compare FlatStateMachine and AbstractStateMachine dispatch
+* @tparam Machine : DwfStateMachine::FlatStateMachine or DwfStateMachine::AbstractStateMachine
+*
+* Inherits from Machine
+* Both kinds are built from the same transition map, with 4 states : A(0), B(1), C(2), D(3) and following transitions :
+* A -> B (Ev1)
+* A -> C (Ev2)
+* A -> A (Ev4, empty transition function)
+* B -> A (Ev3)
+* B -> D (Ev1)
+* C has an empty transition map and D has no transition map.
+* Events are dispatched from calling thread so that both machines can be compared step by step.
+*
+*/
+template<class Machine>
+class MirrorStateMachine : public Machine
+{
+public:
+    enum StatesId
+    {
+        A=0,
+        B=1,
+        C=2,
+        D=3
+    };
+
+    /*!
+    * @brief Constructor of MirrorStateMachine class
+    *
+    * Machine starts in state A.
+    *
+    */
+    MirrorStateMachine() : Machine(DwfStateMachine::DwfState(A)), m_dead_end_nb(0u)
+    {
+    }
+
+    /*!
+    * @brief Process an event from calling thread
+    * @param id : ID of the event
+    * @return ID of current state once event is processed
+    *
+    * Must only be called while no event is pushed to the machine.
+    *
+    */
+    DwfStateMachine::StateID dispatch(EventSystem::EventID id)
+    {
+        this->processEvent(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(id)));
+        return this->m_current_state.getId();
+    }
+
+    /*!
+    * @brief Get dead end counter
+    * @return Number of onDeadEndState calls
+    *
+    */
+    uint32_t deadEndNb() const
+    {
+        return m_dead_end_nb;
+    }
+
+protected:
+    /*!
+    * @brief Fill the transition map
+    *
+    * Virtual method
+    *
+    */
+    virtual void setupTransitionMap()
+    {
+        typename Machine::EventTransitionMap transitionsA({{EventSystem::DwfEvent(1), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(B);}},
+                                                          {EventSystem::DwfEvent(2), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(C);}},
+                                                          {EventSystem::DwfEvent(4), typename Machine::TransitionFunction()}});
+        typename Machine::EventTransitionMap transitionsB({{EventSystem::DwfEvent(3), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(A);}},
+                                                          {EventSystem::DwfEvent(1), [this](std::unique_ptr<EventSystem::DwfEvent>&&){goTo(D);}}});
+        this->m_transition_map.insert({DwfStateMachine::DwfState(A), transitionsA});
+        this->m_transition_map.insert({DwfStateMachine::DwfState(B), transitionsB});
+        this->m_transition_map.insert({DwfStateMachine::DwfState(C), typename Machine::EventTransitionMap()});
+    }
+
+    /*!
+    * @brief Dead end state reaching handler
+    *
+    * Count calls. Required by AbstractStateMachine only.
+    *
+    */
+    virtual void onDeadEndState(const std::exception&)
+    {
+        ++m_dead_end_nb;
+    }
+
+    /*!
+    * @brief Dead end state reaching handler, exception free version
+    *
+    * Count calls.
+    *
+    */
+    virtual void onDeadEndState(DwfStateMachine::DeadEndReason)
+    {
+        ++m_dead_end_nb;
+    }
+
+private:
+    /*!
+    * @brief Go to a state
+    * @param state : ID of the state to go to
+    *
+    */
+    void goTo(StatesId state)
+    {
+        this->m_current_state = DwfStateMachine::DwfState(state);
+    }
+
+    uint32_t m_dead_end_nb; /*!< Counter of onDeadEndState calls.*/
+};
+
+#endif // MIRROR_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
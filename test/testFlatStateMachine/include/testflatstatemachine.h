@@ -0,0 +1,237 @@
+/*!
+ * @file testflatstatemachine.h
+ * @brief Class used to test FlatStateMachine.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class inheriting from FlatStateMachine used to test it.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef TEST_FLAT_STATE_MACHINE_H
+#define TEST_FLAT_STATE_MACHINE_H
+
+#include "flatstatemachine.h"
+#include <mutex>
+#include <condition_variable>
+
+/*! @class TestFlatStateMachine
+* @brief Class used to test FlatStateMachine
+*
+* Inherits from FlatStateMachine
+* The machine has 5 states : A(0), B(1), C(2), D(3), E(4) and following transitions :
+* A -> B (Ev1, transitionAtoB)
+* B -> A (Ev2, transitionToA)
+* A -> C (Ev3, transitionAtoC)
+* C -> A (Ev4, transitionToA)
+* A -> D (Ev5, transitionAtoD)
+* A -> E (Ev6, transitionAtoE)
+* D has no transition map and E has an empty one.
+*
+*/
+class TestFlatStateMachine : public DwfStateMachine::FlatStateMachine
+{
+public:
+    enum StatesId
+    {
+        A=0,
+        B=1,
+        C=2,
+        D=3,
+        E=4
+    };
+
+    /*!
+    * @brief Constructor of TestFlatStateMachine class
+    * @param sparse_ids : If true, a transition with a very high event ID is added from state E so that transition table exceeds size limit.
+    *
+    */
+    TestFlatStateMachine(bool sparse_ids = false);
+
+    DwfStateMachine::DwfState getCurrentState() const;
+
+    /*!
+    * @brief Get counter of onDeadEndState calls with DeadEndReason::NO_TRANSITION_MAP reason
+    * @return Number of times onDeadEndState has been called with DeadEndReason::NO_TRANSITION_MAP reason
+    *
+    */
+    uint32_t noTransitionMapReasonCalled() const;
+
+    /*!
+    * @brief Get transitionAtoB counter
+    * @return Number of times transitionAtoB has been called
+    *
+    */
+    uint32_t transitionAtoBCalled() const;
+
+    /*!
+    * @brief Get transitionAtoC counter
+    * @return Number of times transitionAtoC has been called
+    *
+    */
+    uint32_t transitionAtoCCalled() const;
+
+    /*!
+    * @brief Get transitionBtoA counter
+    * @return Number of times transitionBtoA has been called
+    *
+    */
+    uint32_t transitionBtoACalled() const;
+
+    /*!
+    * @brief Get transitionCtoA counter
+    * @return Number of times transitionCtoA has been called
+    *
+    */
+    uint32_t transitionCtoACalled() const;
+
+    /*!
+    * @brief Wait for a transition to be trigerred
+    *
+    * Blocking call while a transition has not been trigerred.
+    * Resets m_transition_triggered to false
+    *
+    */
+    void waitForTransition();
+
+protected:
+    /*!
+    * @brief Fill the transition map
+    *
+    * Virtual method
+    *
+    */
+    virtual void setupTransitionMap();
+
+    /*!
+    * @brief Dead end state reaching handler
+    * @param reason : reason why current state is a dead end state
+    *
+    * Count calls.
+    *
+    */
+    virtual void onDeadEndState(DwfStateMachine::DeadEndReason reason);
+
+private:
+    /*!
+    * @brief Transition from A to another state
+    * @param state : Reached state
+    * @param counter : Counter of transition calls to increment, if any
+    *
+    */
+    void transitionFromA(StatesId state, std::atomic<uint32_t>* counter);
+
+    /*!
+    * @brief Transition ta A state
+    * @param event : Received event for transition
+    *
+    * Can transiton from B or C state. Event is used to determine state from which transition comes from.
+    *
+    */
+    void transitionToA(std::unique_ptr<EventSystem::DwfEvent>&& event);
+
+    /*!
+    * @brief Signal a transition has been triggered
+    *
+    */
+    void notifyTransition();
+
+    const bool m_sparse_ids; /*!< Flag indicating if a transition with a very high event ID is added.*/
+
+    std::atomic<uint32_t> m_no_transition_map_reason_called; /*!< Counter of onDeadEndState calls with DeadEndReason::NO_TRANSITION_MAP reason.*/
+    std::atomic<uint32_t> m_transition_a_to_b_called; /*!< Counter of transitionAtoB calls.*/
+    std::atomic<uint32_t> m_transition_a_to_c_called; /*!< Counter of transitionAtoC calls.*/
+    std::atomic<uint32_t> m_transition_b_to_a_called; /*!< Counter of transitionToA with Ev2 calls.*/
+    std::atomic<uint32_t> m_transition_c_to_a_called; /*!< Counter of transitionToA with Ev4 calls.*/
+
+    std::atomic<bool> m_transition_triggered; /*!< Flag indicating if a transition has been triggered lately.*/
+
+    mutable std::mutex m_transition_mutex; /*!< Mutex used to protect transition semaphore.*/
+    mutable std::condition_variable m_transition_semaphore; /*!< Condition variable used to wait for a transition to be triggered.*/
+};
+
+#endif // TEST_FLAT_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
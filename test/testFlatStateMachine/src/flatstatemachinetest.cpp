@@ -0,0 +1,339 @@
+/*!
+ * @file flatstatemachinetest.cpp
+ * @brief Unit tests of FlatStateMachine class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of FlatStateMachine class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "flatstatemachinetest.h"
+#include "testflatstatemachine.h"
+#include "mirrorstatemachine.h"
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(FlatStateMachineTest);
+
+FlatStateMachineTest::FlatStateMachineTest()
+{
+}
+
+FlatStateMachineTest::~FlatStateMachineTest()
+{
+}
+
+void FlatStateMachineTest::setUp()
+{
+}
+
+void FlatStateMachineTest::tearDown()
+{
+}
+
+void FlatStateMachineTest::testDeadEndState()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestFlatStateMachine st_mach;
+    CPPUNIT_ASSERT_MESSAGE("Initial state is A", DwfStateMachine::DwfState(TestFlatStateMachine::A) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             1 : Start                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    st_mach.setupAndStart();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(5));
+    st_mach.pushEvent(std::move(ev));
+    st_mach.waitForTransition();
+    CPPUNIT_ASSERT_MESSAGE("Go to state D", DwfStateMachine::DwfState(TestFlatStateMachine::D) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              3 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    uint32_t nb_events=10u;
+    for(uint32_t i=1; i<=nb_events; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> evDeadEnd(new EventSystem::DwfEvent(i*100u)); // Most IDs are out of transition table
+        st_mach.pushEvent(std::move(evDeadEnd));
+        CPPUNIT_ASSERT_MESSAGE("Stay in state D", DwfStateMachine::DwfState(TestFlatStateMachine::D) == st_mach.getCurrentState());
+        std::this_thread::sleep_for (std::chrono::milliseconds(100)); // Wait a little bit for event to be processed
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                    4 : Check onDeadEndState calls                  ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("onDeadEndState should have been called for every event with absence of transition map reason", nb_events, st_mach.noTransitionMapReasonCalled());
+}
+
+void FlatStateMachineTest::testEmptyTransitionMap()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestFlatStateMachine st_mach;
+    st_mach.setupAndStart();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(6));
+    st_mach.pushEvent(std::move(ev));
+    st_mach.waitForTransition();
+    CPPUNIT_ASSERT_MESSAGE("Go to state E", DwfStateMachine::DwfState(TestFlatStateMachine::E) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    uint32_t nb_events=5u;
+    for(uint32_t i=1; i<=nb_events; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> evDeadEnd(new EventSystem::DwfEvent(i));
+        st_mach.pushEvent(std::move(evDeadEnd));
+        std::this_thread::sleep_for (std::chrono::milliseconds(100)); // Wait a little bit for event to be processed
+        CPPUNIT_ASSERT_MESSAGE("Stay in state E", DwfStateMachine::DwfState(TestFlatStateMachine::E) == st_mach.getCurrentState());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                    3 : Check events are ignored                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("onDeadEndState should not have been called with absence of transition map reason", 0u, st_mach.noTransitionMapReasonCalled());
+}
+
+void FlatStateMachineTest::testTransitions()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestFlatStateMachine st_mach;
+    st_mach.setupAndStart();
+    CPPUNIT_ASSERT_MESSAGE("Initial state is A", DwfStateMachine::DwfState(TestFlatStateMachine::A) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Transitions                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    uint32_t nb_loops=10u;
+    for(uint32_t i=1; i<=nb_loops; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> evB(new EventSystem::DwfEvent(1));
+        st_mach.pushEvent(std::move(evB));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state B", DwfStateMachine::DwfState(TestFlatStateMachine::B) == st_mach.getCurrentState());
+
+        std::unique_ptr<EventSystem::DwfEvent> evAB(new EventSystem::DwfEvent(2));
+        st_mach.pushEvent(std::move(evAB));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state A", DwfStateMachine::DwfState(TestFlatStateMachine::A) == st_mach.getCurrentState());
+
+        std::unique_ptr<EventSystem::DwfEvent> evC(new EventSystem::DwfEvent(3));
+        st_mach.pushEvent(std::move(evC));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state C", DwfStateMachine::DwfState(TestFlatStateMachine::C) == st_mach.getCurrentState());
+
+        std::unique_ptr<EventSystem::DwfEvent> evAC(new EventSystem::DwfEvent(4));
+        st_mach.pushEvent(std::move(evAC));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state A", DwfStateMachine::DwfState(TestFlatStateMachine::A) == st_mach.getCurrentState());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     2 : Check transitions calls                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to B", nb_loops, st_mach.transitionAtoBCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to C", nb_loops, st_mach.transitionAtoCCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions B to A", nb_loops, st_mach.transitionBtoACalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions C to A", nb_loops, st_mach.transitionCtoACalled());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         3 : No transition                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> evInTable(new EventSystem::DwfEvent(2)); // In table but no transition from A
+    st_mach.pushEvent(std::move(evInTable));
+    std::unique_ptr<EventSystem::DwfEvent> evOutOfTable(new EventSystem::DwfEvent(42)); // Greater than any event ID of transition map
+    st_mach.pushEvent(std::move(evOutOfTable));
+    std::this_thread::sleep_for (std::chrono::milliseconds(100)); // Wait a little bit for events to be processed
+    CPPUNIT_ASSERT_MESSAGE("Stay in state A", DwfStateMachine::DwfState(TestFlatStateMachine::A) == st_mach.getCurrentState());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to B", nb_loops, st_mach.transitionAtoBCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to C", nb_loops, st_mach.transitionAtoCCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions B to A", nb_loops, st_mach.transitionBtoACalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions C to A", nb_loops, st_mach.transitionCtoACalled());
+}
+
+void FlatStateMachineTest::testTableSizeLimit()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestFlatStateMachine st_mach(true);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         1 : Start fails                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_THROW_MESSAGE("Too sparse IDs should prevent table compilation", st_mach.setupAndStart(), std::length_error);
+}
+
+/*!
+* @brief Dispatch the same events to both kinds of MirrorStateMachine and check they go through the same states
+* @param event_ids : IDs of dispatched events, in order
+* @param dead_end_nb : Expected number of onDeadEndState calls
+*
+*/
+static void checkSameDispatch(const std::vector<EventSystem::EventID>& event_ids, uint32_t dead_end_nb)
+{
+    MirrorStateMachine<DwfStateMachine::FlatStateMachine> flat_st_mach;
+    MirrorStateMachine<DwfStateMachine::AbstractStateMachine> abstract_st_mach;
+    flat_st_mach.setupAndStart();
+    abstract_st_mach.setupAndStart();
+    for(EventSystem::EventID id : event_ids)
+    {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Both machines should reach the same state", abstract_st_mach.dispatch(id), flat_st_mach.dispatch(id));
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Both machines should report the same dead ends", abstract_st_mach.deadEndNb(), flat_st_mach.deadEndNb());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Dead ends should be reported in state without transition map only", dead_end_nb, flat_st_mach.deadEndNb());
+}
+
+void FlatStateMachineTest::testSameBehaviorAsAbstractStateMachine()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const std::vector<EventSystem::EventID> to_empty_map = {4u, 7u, 3u, 1u, 2u, 3u, 2u, 1u, 2u, 3u, 7u};
+    const std::vector<EventSystem::EventID> to_no_map = {1u, 2u, 1u, 1u, 3u, 7u};
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                1 : State with empty transition map                 ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    checkSameDispatch(to_empty_map, 0u);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                  2 : State without transition map                  ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    checkSameDispatch(to_no_map, 3u);
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
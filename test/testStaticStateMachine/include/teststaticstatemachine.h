@@ -0,0 +1,280 @@
+/*!
+ * @file teststaticstatemachine.h
+ * @brief Class used to test StaticStateMachine.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class inheriting from StaticStateMachine used to test it.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef TEST_STATIC_STATE_MACHINE_H
+#define TEST_STATIC_STATE_MACHINE_H
+
+#include "staticstatemachine.h"
+#include <mutex>
+#include <condition_variable>
+
+class TestStaticStateMachine;
+
+/*! @struct TransitionAtoB
+* @brief Action of transition from A to B
+*
+*/
+struct TransitionAtoB
+{
+    void operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&& event) const;
+};
+
+/*! @struct TransitionAtoC
+* @brief Action of transition from A to C
+*
+*/
+struct TransitionAtoC
+{
+    void operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&& event) const;
+};
+
+/*! @struct TransitionToA
+* @brief Action of transitions from B or C to A
+*
+* Event is used to determine state from which transition comes from.
+*
+*/
+struct TransitionToA
+{
+    void operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&& event) const;
+};
+
+/*! @struct TransitionAtoD
+* @brief Action of transition from A to D
+*
+*/
+struct TransitionAtoD
+{
+    void operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&& event) const;
+};
+
+/*! @enum TestStatesId
+* @brief States of TestStaticStateMachine
+*
+*/
+enum TestStatesId : DwfStateMachine::StateID
+{
+    A=0,
+    B=1,
+    C=2,
+    D=3
+};
+
+/*! @typedef TestStaticStateMachineBase
+*  @brief Base class of TestStaticStateMachine
+*/
+using TestStaticStateMachineBase = DwfStateMachine::StaticStateMachine<TestStaticStateMachine,
+                                                                       DwfStateMachine::Transition<A, 1, B, TransitionAtoB>,
+                                                                       DwfStateMachine::Transition<B, 2, A, TransitionToA>,
+                                                                       DwfStateMachine::Transition<A, 3, C, TransitionAtoC>,
+                                                                       DwfStateMachine::Transition<C, 4, A, TransitionToA>,
+                                                                       DwfStateMachine::Transition<A, 5, D, TransitionAtoD>>;
+
+/*! @class TestStaticStateMachine
+* @brief Class used to test StaticStateMachine
+*
+* Inherits from StaticStateMachine
+* The machine has 4 states : A(0), B(1), C(2), D(3) and following transitions :
+* A -> B (Ev1, TransitionAtoB)
+* B -> A (Ev2, TransitionToA)
+* A -> C (Ev3, TransitionAtoC)
+* C -> A (Ev4, TransitionToA)
+* A -> D (Ev5, TransitionAtoD)
+* D has no transition.
+*
+*/
+class TestStaticStateMachine : public TestStaticStateMachineBase
+{
+    friend struct TransitionAtoB;
+    friend struct TransitionAtoC;
+    friend struct TransitionToA;
+    friend struct TransitionAtoD;
+
+public:
+    /*!
+    * @brief Constructor of TestStaticStateMachine class
+    *
+    */
+    TestStaticStateMachine();
+
+    DwfStateMachine::DwfState getCurrentState() const;
+
+    /*!
+    * @brief Get counter of onDeadEndState calls with DeadEndReason::NO_TRANSITION_MAP reason
+    * @return Number of times onDeadEndState has been called with DeadEndReason::NO_TRANSITION_MAP reason
+    *
+    */
+    uint32_t noTransitionMapReasonCalled() const;
+
+    /*!
+    * @brief Get TransitionAtoB counter
+    * @return Number of times TransitionAtoB has been called
+    *
+    */
+    uint32_t transitionAtoBCalled() const;
+
+    /*!
+    * @brief Get TransitionAtoC counter
+    * @return Number of times TransitionAtoC has been called
+    *
+    */
+    uint32_t transitionAtoCCalled() const;
+
+    /*!
+    * @brief Get TransitionToA counter for transitions from B
+    * @return Number of times TransitionToA has been called from B
+    *
+    */
+    uint32_t transitionBtoACalled() const;
+
+    /*!
+    * @brief Get TransitionToA counter for transitions from C
+    * @return Number of times TransitionToA has been called from C
+    *
+    */
+    uint32_t transitionCtoACalled() const;
+
+    /*!
+    * @brief Get counter of actions called while current state was not their source state
+    * @return Number of actions called after current state was updated
+    *
+    */
+    uint32_t actionOutOfSourceStateNb() const;
+
+    /*!
+    * @brief Wait for a transition to be trigerred
+    *
+    * Blocking call while a transition has not been trigerred, then until current state is updated to transition target state.
+    * Resets m_transition_triggered to false
+    *
+    */
+    void waitForTransition();
+
+protected:
+    /*!
+    * @brief Dead end state reaching handler
+    * @param reason : reason why current state is a dead end state
+    *
+    * Count calls.
+    *
+    */
+    virtual void onDeadEndState(DwfStateMachine::DeadEndReason reason);
+
+private:
+    /*!
+    * @brief Signal a transition has been triggered
+    * @param source : ID of the source state of the transition
+    * @param target : ID of the target state of the transition
+    *
+    * Counts calls made while current state is not source state.
+    *
+    */
+    void notifyTransition(DwfStateMachine::StateID source, DwfStateMachine::StateID target);
+
+    std::atomic<uint32_t> m_no_transition_map_reason_called; /*!< Counter of onDeadEndState calls with DeadEndReason::NO_TRANSITION_MAP reason.*/
+    std::atomic<uint32_t> m_transition_a_to_b_called; /*!< Counter of TransitionAtoB calls.*/
+    std::atomic<uint32_t> m_transition_a_to_c_called; /*!< Counter of TransitionAtoC calls.*/
+    std::atomic<uint32_t> m_transition_b_to_a_called; /*!< Counter of TransitionToA with Ev2 calls.*/
+    std::atomic<uint32_t> m_transition_c_to_a_called; /*!< Counter of TransitionToA with Ev4 calls.*/
+    std::atomic<uint32_t> m_action_out_of_source_state_nb; /*!< Counter of actions called while current state was not their source state.*/
+
+    std::atomic<DwfStateMachine::StateID> m_target_state; /*!< Target state of latest triggered transition.*/
+
+    std::atomic<bool> m_transition_triggered; /*!< Flag indicating if a transition has been triggered lately.*/
+
+    mutable std::mutex m_transition_mutex; /*!< Mutex used to protect transition semaphore.*/
+    mutable std::condition_variable m_transition_semaphore; /*!< Condition variable used to wait for a transition to be triggered.*/
+};
+
+#endif // TEST_STATIC_STATE_MACHINE_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
@@ -0,0 +1,265 @@
+/*!
+ * @file staticstatemachinetest.cpp
+ * @brief Unit tests of StaticStateMachine class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of StaticStateMachine class.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "staticstatemachinetest.h"
+#include "teststaticstatemachine.h"
+
+#include <chrono>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(StaticStateMachineTest);
+
+StaticStateMachineTest::StaticStateMachineTest()
+{
+}
+
+StaticStateMachineTest::~StaticStateMachineTest()
+{
+}
+
+void StaticStateMachineTest::setUp()
+{
+}
+
+void StaticStateMachineTest::tearDown()
+{
+}
+
+void StaticStateMachineTest::testDeadEndState()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestStaticStateMachine st_mach;
+    CPPUNIT_ASSERT_MESSAGE("Initial state is A", DwfStateMachine::DwfState(A) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             1 : Start                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    st_mach.setupAndStart();
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              2 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> ev(new EventSystem::DwfEvent(5));
+    st_mach.pushEvent(std::move(ev));
+    st_mach.waitForTransition();
+    CPPUNIT_ASSERT_MESSAGE("Go to state D", DwfStateMachine::DwfState(D) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              3 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    uint32_t nb_events=10u;
+    for(uint32_t i=1; i<=nb_events; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> evDeadEnd(new EventSystem::DwfEvent(i));
+        st_mach.pushEvent(std::move(evDeadEnd));
+        CPPUNIT_ASSERT_MESSAGE("Stay in state D", DwfStateMachine::DwfState(D) == st_mach.getCurrentState());
+        std::this_thread::sleep_for (std::chrono::milliseconds(100)); // Wait a little bit for event to be processed
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                    4 : Check onDeadEndState calls                  ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("onDeadEndState should have been called for every event with absence of transition map reason", nb_events, st_mach.noTransitionMapReasonCalled());
+}
+
+void StaticStateMachineTest::testTransitions()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    TestStaticStateMachine st_mach;
+    st_mach.setupAndStart();
+    CPPUNIT_ASSERT_MESSAGE("Initial state is A", DwfStateMachine::DwfState(A) == st_mach.getCurrentState());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                          1 : Transitions                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    uint32_t nb_loops=10u;
+    for(uint32_t i=1; i<=nb_loops; ++i)
+    {
+        std::unique_ptr<EventSystem::DwfEvent> evB(new EventSystem::DwfEvent(1));
+        st_mach.pushEvent(std::move(evB));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state B", DwfStateMachine::DwfState(B) == st_mach.getCurrentState());
+
+        std::unique_ptr<EventSystem::DwfEvent> evAB(new EventSystem::DwfEvent(2));
+        st_mach.pushEvent(std::move(evAB));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state A", DwfStateMachine::DwfState(A) == st_mach.getCurrentState());
+
+        std::unique_ptr<EventSystem::DwfEvent> evC(new EventSystem::DwfEvent(3));
+        st_mach.pushEvent(std::move(evC));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state C", DwfStateMachine::DwfState(C) == st_mach.getCurrentState());
+
+        std::unique_ptr<EventSystem::DwfEvent> evAC(new EventSystem::DwfEvent(4));
+        st_mach.pushEvent(std::move(evAC));
+        st_mach.waitForTransition();
+        CPPUNIT_ASSERT_MESSAGE("Go to state A", DwfStateMachine::DwfState(A) == st_mach.getCurrentState());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                     2 : Check transitions calls                    ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to B", nb_loops, st_mach.transitionAtoBCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to C", nb_loops, st_mach.transitionAtoCCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions B to A", nb_loops, st_mach.transitionBtoACalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions C to A", nb_loops, st_mach.transitionCtoACalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Actions should be called in source state", 0u, st_mach.actionOutOfSourceStateNb());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         3 : No transition                          ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> evInTable(new EventSystem::DwfEvent(2)); // Known event but no transition from A
+    st_mach.pushEvent(std::move(evInTable));
+    std::unique_ptr<EventSystem::DwfEvent> evOutOfTable(new EventSystem::DwfEvent(42)); // Unknown event
+    st_mach.pushEvent(std::move(evOutOfTable));
+    std::this_thread::sleep_for (std::chrono::milliseconds(100)); // Wait a little bit for events to be processed
+    CPPUNIT_ASSERT_MESSAGE("Stay in state A", DwfStateMachine::DwfState(A) == st_mach.getCurrentState());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to B", nb_loops, st_mach.transitionAtoBCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions A to C", nb_loops, st_mach.transitionAtoCCalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions B to A", nb_loops, st_mach.transitionBtoACalled());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Transitions C to A", nb_loops, st_mach.transitionCtoACalled());
+}
+
+void StaticStateMachineTest::testTransitionTable()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    using Table = TestStaticStateMachine::Table;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       1 : Compile time checks                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    static_assert(Table::hasTransitionFrom(A), "A has transitions");
+    static_assert(!Table::hasTransitionFrom(D), "D has no transition");
+    static_assert(Table::hasTransition(B, 2), "Ev2 triggers transition from B");
+    static_assert(!Table::hasTransition(B, 1), "Ev1 does not trigger transition from B");
+    static_assert(Table::isDeterministic(), "Table is deterministic");
+    static_assert(!DwfStateMachine::TransitionTable<DwfStateMachine::Transition<A, 1, B>, DwfStateMachine::Transition<A, 1, C>>::isDeterministic(), "Two transitions for the same state and event");
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Runtime checks                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_MESSAGE("C has transitions", Table::hasTransitionFrom(C));
+    CPPUNIT_ASSERT_MESSAGE("Unknown state has no transition", !Table::hasTransitionFrom(42));
+    CPPUNIT_ASSERT_MESSAGE("Ev4 triggers transition from C", Table::hasTransition(C, 4));
+    CPPUNIT_ASSERT_MESSAGE("Ev5 does not trigger transition from C", !Table::hasTransition(C, 5));
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
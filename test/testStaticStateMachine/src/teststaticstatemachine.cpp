@@ -0,0 +1,203 @@
+/*!
+ * @file teststaticstatemachine.cpp
+ * @brief Class used to test StaticStateMachine.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Class inheriting from StaticStateMachine used to test it.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "teststaticstatemachine.h"
+#include <thread>
+
+void TransitionAtoB::operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&&) const
+{
+    ++machine.m_transition_a_to_b_called;
+    machine.notifyTransition(A, B);
+}
+
+void TransitionAtoC::operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&&) const
+{
+    ++machine.m_transition_a_to_c_called;
+    machine.notifyTransition(A, C);
+}
+
+void TransitionToA::operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&& event) const
+{
+    if(*event == EventSystem::DwfEvent(2))
+    {
+        ++machine.m_transition_b_to_a_called;
+        machine.notifyTransition(B, A);
+    }
+    else if(*event == EventSystem::DwfEvent(4))
+    {
+        ++machine.m_transition_c_to_a_called;
+        machine.notifyTransition(C, A);
+    }
+}
+
+void TransitionAtoD::operator()(TestStaticStateMachine& machine, std::unique_ptr<EventSystem::DwfEvent>&&) const
+{
+    machine.notifyTransition(A, D);
+}
+
+TestStaticStateMachine::TestStaticStateMachine() : TestStaticStateMachineBase(DwfStateMachine::DwfState(A)),
+    m_no_transition_map_reason_called(0),
+    m_transition_a_to_b_called(0), m_transition_a_to_c_called(0), m_transition_b_to_a_called(0), m_transition_c_to_a_called(0), m_action_out_of_source_state_nb(0),
+    m_target_state(A), m_transition_triggered(false)
+{
+}
+
+DwfStateMachine::DwfState TestStaticStateMachine::getCurrentState() const
+{
+    return m_current_state;
+}
+
+uint32_t TestStaticStateMachine::noTransitionMapReasonCalled() const
+{
+    return m_no_transition_map_reason_called;
+}
+
+uint32_t TestStaticStateMachine::transitionAtoBCalled() const
+{
+    return m_transition_a_to_b_called;
+}
+
+uint32_t TestStaticStateMachine::transitionAtoCCalled() const
+{
+    return m_transition_a_to_c_called;
+}
+
+uint32_t TestStaticStateMachine::transitionBtoACalled() const
+{
+    return m_transition_b_to_a_called;
+}
+
+uint32_t TestStaticStateMachine::transitionCtoACalled() const
+{
+    return m_transition_c_to_a_called;
+}
+
+uint32_t TestStaticStateMachine::actionOutOfSourceStateNb() const
+{
+    return m_action_out_of_source_state_nb;
+}
+
+void TestStaticStateMachine::waitForTransition()
+{
+    std::unique_lock<std::mutex> lk(m_transition_mutex);
+    m_transition_semaphore.wait(lk, [this]{return m_transition_triggered.load();});
+
+    m_transition_triggered=false; // Reset transition
+    while(!(getCurrentState() == DwfStateMachine::DwfState(m_target_state))) // Current state is updated once action returns
+    {
+        std::this_thread::yield();
+    }
+}
+
+void TestStaticStateMachine::onDeadEndState(DwfStateMachine::DeadEndReason reason)
+{
+    if(reason == DwfStateMachine::DeadEndReason::NO_TRANSITION_MAP)
+    {
+        ++m_no_transition_map_reason_called;
+    }
+}
+
+void TestStaticStateMachine::notifyTransition(DwfStateMachine::StateID source, DwfStateMachine::StateID target)
+{
+    if(m_current_state.getId() != source)
+    {
+        ++m_action_out_of_source_state_nb;
+    }
+    m_target_state = target;
+    {
+        std::lock_guard<std::mutex> lk(m_transition_mutex);
+        m_transition_triggered=true;
+    }
+    m_transition_semaphore.notify_one();
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
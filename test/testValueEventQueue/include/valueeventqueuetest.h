@@ -0,0 +1,201 @@
+/*!
+ * @file valueeventqueuetest.h
+ * @brief Unit tests of ValueEventQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of ValueEventQueue class and of value events.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#ifndef VALUE_EVENT_QUEUE_TEST_H
+#define VALUE_EVENT_QUEUE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/Portability.h>
+
+/*! @class ValueEventQueueTest
+* @brief Unit tests of ValueEventQueue class
+*
+* Inherits from TestFixture
+*
+*/
+class ValueEventQueueTest : public CPPUNIT_NS::TestFixture
+{
+public:
+    CPPUNIT_TEST_SUITE(ValueEventQueueTest);
+        CPPUNIT_TEST(testValueEvent);
+        CPPUNIT_TEST(testPushPop);
+        CPPUNIT_TEST(testFull);
+        CPPUNIT_TEST(testCoalesce);
+        CPPUNIT_TEST(testWaitManagement);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*!
+    * @brief Constructor of the ValueEventQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    ValueEventQueueTest();
+
+    /*!
+    * @brief Desctructor of the ValueEventQueueTest class
+    *
+    * Does nothing.
+    *
+    */
+    ~ValueEventQueueTest();
+
+    /*!
+    * @brief Prepare execution environment of every test
+    *
+    * Does nothing.
+    *
+    */
+    void setUp();
+
+    /*!
+    * @brief Cleanup environment after execution of each test
+    *
+    * Does nothing.
+    *
+    */
+    void tearDown();
+
+    /*!
+    * @brief Check value event payload access
+    *
+    * 0) Create a value event without payload. Check id and payload size.
+    * 1) Create a value event with a structure payload. Check payload is copied back and reading it with another type throws an exception.
+    *
+    */
+    void testValueEvent();
+
+    /*!
+    * @brief Check value and polymorphic events keep push order
+    *
+    * 0) Create a queue. Push value and polymorphic events alternately.
+    * 1) Pop slots. Check order and kind of events.
+    * 2) Push events again and pop them as polymorphic events. Check value events are boxed with their payload.
+    *
+    */
+    void testPushPop();
+
+    /*!
+    * @brief Check behavior of a full queue
+    *
+    * 0) Create a queue of size N and fill it.
+    * 1) Push a polymorphic event. Check an exception is thrown and event is not moved.
+    * 2) Try to push a polymorphic event. Check full queue is reported and event is not moved.
+    * 3) Push a value event. Check an exception is thrown.
+    *
+    */
+    void testFull();
+
+    /*!
+    * @brief Check coalescing of value events
+    *
+    * 0) Create a queue of size 2 coalescing events by id.
+    * 1) Push several value events with the same id. Check the latest one replaced the queued one.
+    *
+    */
+    void testCoalesce();
+
+    /*!
+    * @brief Check wait management behavior
+    *
+    * 0) Create a queue.
+    * 1) Spawn a thread waiting for slots.
+    * 2) Disable wait and check thread exits without any slot popped.
+    *
+    */
+    void testWaitManagement();
+};
+
+#endif // VALUE_EVENT_QUEUE_TEST_H
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|
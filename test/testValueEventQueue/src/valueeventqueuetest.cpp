@@ -0,0 +1,294 @@
+/*!
+ * @file valueeventqueuetest.cpp
+ * @brief Unit tests of ValueEventQueue class.
+ * @author SignC0dingDw@rf
+ * @date 17 October 2026
+ *
+ * Unit tests of ValueEventQueue class and of value events.
+ *
+ */
+
+/*
+MIT License
+
+Copyright (c) 2020 SignC0dingDw@rf
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Copywrong (w) 2020 SignC0dingDw@rf. All profits reserved.
+
+This program is dwarven software: you can redistribute it and/or modify
+it provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copywrong
+     notice and this list of conditions and the following disclaimer
+     or you will be chopped to pieces AND eaten alive by a Bolrag.
+
+   * Redistributions in binary form must reproduce the above copywrong
+     notice, this list of conditions and the following disclaimer in
+     the documentation and other materials provided with it or they
+     will be axe-printed on your stupid-looking face.
+
+   * Any commercial use of this program is allowed provided you offer
+     99% of all your benefits to the Dwarven Tax Collection Guild.
+
+   * This software is provided "as is" without any warranty and especially
+     the implied warranty of merchantability or fitness to purport.
+     In the event of any direct, indirect, incidental, special, examplary
+     or consequential damages (including, but not limited to, loss of use;
+     loss of data; beer-drowning; business interruption; goblin invasion;
+     procurement of substitute goods or services; beheading; or loss of profits),
+     the author and all dwarves are not liable of such damages even
+     the ones they inflicted you on purpose.
+
+   * If this program "does not work", that means you are an elf
+     and are therefore too stupid to use this program.
+
+   * If you try to copy this program without respecting the
+     aforementionned conditions, then you're wrong.
+
+You should have received a good beat down along with this program.
+If not, see <http://www.dwarfvesaregonnabeatyoutodeath.com>.
+*/
+
+#include "valueeventqueuetest.h"
+#include "valueeventqueue.h"
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ValueEventQueueTest);
+
+/*! @struct Position
+*  @brief Example of value event payload
+*/
+struct Position
+{
+    int32_t x; /*!< Abscissa.*/
+    int32_t y; /*!< Ordinate.*/
+    double heading; /*!< Heading in radians.*/
+};
+
+ValueEventQueueTest::ValueEventQueueTest()
+{
+}
+
+ValueEventQueueTest::~ValueEventQueueTest()
+{
+}
+
+void ValueEventQueueTest::setUp()
+{
+}
+
+void ValueEventQueueTest::tearDown()
+{
+}
+
+void ValueEventQueueTest::testValueEvent()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                           0 : No payload                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    EventSystem::DwfValueEvent event(12);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Event id is not correct", static_cast<EventSystem::EventID>(12u), event.getId());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Event should have no payload", static_cast<size_t>(0u), event.payloadSize());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             1 : Payload                            ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const Position position = {3, -4, 1.5};
+    EventSystem::DwfValueEvent position_event(13, position);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload size is not correct", sizeof(Position), position_event.payloadSize());
+    Position copy = position_event.payload<Position>();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be copied", 3, copy.x);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be copied", -4, copy.y);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be copied", 1.5, copy.heading);
+    CPPUNIT_ASSERT_THROW_MESSAGE("Payload of another size should not be read", position_event.payload<int32_t>(), std::logic_error);
+}
+
+void ValueEventQueueTest::testPushPop()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    EventSystem::ValueEventQueue testQueue;
+    CPPUNIT_ASSERT_MESSAGE("Queue should store value events", testQueue.storesValues());
+    testQueue.pushValue(EventSystem::DwfValueEvent(1));
+    testQueue.push(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(2)));
+    testQueue.pushValue(EventSystem::DwfValueEvent(3, 42));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                            1 : Pop slots                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<EventSystem::EventSlot> slots;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("All events should be popped", static_cast<size_t>(3u), testQueue.popSlotsUpTo(0u, slots));
+    CPPUNIT_ASSERT_MESSAGE("First event should be a value event", slots[0].byValue() && slots[0].getId() == 1u);
+    CPPUNIT_ASSERT_MESSAGE("Second event should be a polymorphic event", !slots[1].byValue() && slots[1].event() && slots[1].getId() == 2u);
+    CPPUNIT_ASSERT_MESSAGE("Third event should be a value event", slots[2].byValue() && slots[2].getId() == 3u);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Payload should be kept", 42, slots[2].value().payload<int>());
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Pop as pointers                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.pushValue(EventSystem::DwfValueEvent(4, 7));
+    testQueue.push(std::unique_ptr<EventSystem::DwfEvent>(new EventSystem::DwfEvent(5)));
+    std::unique_ptr<EventSystem::DwfEvent> event;
+    testQueue.pop(event);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Boxed event should keep its id", static_cast<EventSystem::EventID>(4u), event->getId());
+    const EventSystem::DwfValueEvent* value = EventSystem::BoxedValueEvent::valueOf(*event);
+    CPPUNIT_ASSERT_MESSAGE("Value event should be boxed", value != nullptr);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Boxed event should keep its payload", 7, value->payload<int>());
+    testQueue.pop(event);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Polymorphic event should be popped", static_cast<EventSystem::EventID>(5u), event->getId());
+    CPPUNIT_ASSERT_MESSAGE("Polymorphic event should not be boxed", EventSystem::BoxedValueEvent::valueOf(*event) == nullptr);
+}
+
+void ValueEventQueueTest::testFull()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    const size_t queue_size = 2u;
+    EventSystem::ValueEventQueue testQueue(queue_size);
+    testQueue.pushValue(EventSystem::DwfValueEvent(1));
+    testQueue.pushValue(EventSystem::DwfValueEvent(2));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                               1 : Push                             ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<EventSystem::DwfEvent> event(new EventSystem::DwfEvent(3));
+    CPPUNIT_ASSERT_THROW_MESSAGE("Push on full queue should throw", testQueue.push(std::move(event)), std::runtime_error);
+    CPPUNIT_ASSERT_MESSAGE("Event should not be moved if queue is full", event != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             2 : Try push                           ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_MESSAGE("Full queue should be reported", DwfContainers::PushStatus::FULL == testQueue.tryPush(std::move(event)));
+    CPPUNIT_ASSERT_MESSAGE("Event should not be moved if queue is full", event != nullptr);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                             3 : Push value                         ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    CPPUNIT_ASSERT_THROW_MESSAGE("Value push on full queue should throw", testQueue.pushValue(EventSystem::DwfValueEvent(4)), std::runtime_error);
+}
+
+void ValueEventQueueTest::testCoalesce()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    EventSystem::ValueEventQueue testQueue(2u, DwfContainers::OverflowPolicy::COALESCE_BY_ID);
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              1 : Push                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.pushValue(EventSystem::DwfValueEvent(1, 10));
+    testQueue.pushValue(EventSystem::DwfValueEvent(2, 20));
+    testQueue.pushValue(EventSystem::DwfValueEvent(1, 11));
+    testQueue.pushValue(EventSystem::DwfValueEvent(1, 12));
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Queued events should be coalesced", static_cast<uint64_t>(2u), testQueue.coalescedEventNb());
+    std::vector<EventSystem::EventSlot> slots;
+    testQueue.popSlotsUpTo(0u, slots);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Coalesced events should not be queued", static_cast<size_t>(2u), slots.size());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Latest event should replace queued one", 12, slots[0].value().payload<int>());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Other events should be kept", 20, slots[1].value().payload<int>());
+}
+
+void ValueEventQueueTest::testWaitManagement()
+{
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                              0 : Init                              ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    EventSystem::ValueEventQueue testQueue;
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                       1 : Spawn popper thread                      ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    std::vector<EventSystem::EventSlot> slots;
+    size_t popped_nb = 1u;
+    std::thread popper([&testQueue, &slots, &popped_nb]()
+    {
+        popped_nb = testQueue.popSlotsUpTo(0u, slots);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    //////////////////////////////////////////////////////////////////////////
+    ///                                                                    ///
+    ///                         2 : Disable Waiting                        ///
+    ///                                                                    ///
+    //////////////////////////////////////////////////////////////////////////
+    testQueue.disableWait();
+    popper.join();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Nothing should be popped when wait is disabled", static_cast<size_t>(0u), popped_nb);
+    CPPUNIT_ASSERT_MESSAGE("Nothing should be popped when wait is disabled", slots.empty());
+}
+
+//  ______________________________
+// |                              |
+// |    ______________________    |
+// |   |                      |   |
+// |   |         Sign         |   |
+// |   |        C0ding        |   |
+// |   |        Dw@rf         |   |
+// |   |         1.0          |   |
+// |   |______________________|   |
+// |                              |
+// |______________________________|
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |  |
+//               |__|